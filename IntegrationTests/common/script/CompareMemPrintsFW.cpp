@@ -0,0 +1,594 @@
+//================================================================
+// Compare .txt files (corresponding to memory content) written
+// by FW with those expected from C++ emulation.
+//
+// Native version of CompareMemPrintsFW.py, with the same options
+// and the same output (console and *_cmp.txt files). Both files
+// are read line by line instead of being loaded completely, and
+// the memories are compared in parallel (-t), which matters for
+// full-sector simulations. Optionally, the results are also
+// written as JSON (-j).
+//
+// Build with the CMake project in the top directory (target
+// CompareMemPrintsFW) or simply with
+//  g++ -O2 -std=c++11 -pthread CompareMemPrintsFW.cpp -o CompareMemPrintsFW
+//
+// Run from IntegrationTests/someChain/script/ with:
+//  CompareMemPrintsFW -p -s
+//
+// Assumes txt files written by FW are in dataOut/
+// & C++ emulation expectations in ../../../emData/
+//================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glob.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// The memory types known to the comparison, as in the ReferenceType enum of
+// CompareMemPrintsFW.py
+struct ReferenceType {
+  const char* name;
+  const char* fullName;
+};
+
+const ReferenceType referenceTypes[] = {
+  {"IL",     "InputStubs"},
+  {"VMSTE",  "VMStubs"},
+  {"VMSME",  "VMStubs"},
+  {"AS",     "AllStubs"},
+  {"SP",     "StubPairs"},
+  {"TPAR",   "TrackletParameters"},
+  {"TPROJ",  "TrackletProjections"},
+  {"VMPROJ", "VMProjections"},
+  {"AP",     "AllProjections"},
+  {"CM",     "CandidateMatches"},
+  {"FM",     "FullMatches"},
+  {"TF",     "TrackFit"},
+  {"CT",     "CleanTrack"}
+};
+
+// Finds the type of MemPrint from the reference file name, e.g.
+// CandidateMatches_CM_L3PHIC17_04.dat or VMProjections_VMPROJ_L3PHIC17_04.dat
+const ReferenceType& findReferenceType(const string& fileName)
+{
+  const string baseName = fileName.substr(fileName.find_last_of('/') + 1);
+
+  string typeName;
+  smatch match;
+  if (regex_search(baseName, match, regex("_[A-Z][A-Z]_"))) {
+    typeName = match.str().substr(1, 2);
+  }
+  else {
+    const size_t begin = baseName.find('_');
+    if (begin == string::npos)
+      throw runtime_error("Unable to determine the reference file type from the file name " + fileName);
+    typeName = baseName.substr(begin + 1, baseName.find('_', begin + 1) - begin - 1);
+  }
+
+  for (const auto& type : referenceTypes) {
+    if (typeName == type.name) return type;
+  }
+  throw runtime_error("Unknown reference file type " + typeName + " of " + fileName);
+}
+
+vector<string> tokenize(const string& line)
+{
+  vector<string> tokens;
+  istringstream sstream(line);
+  string token;
+  while (sstream >> token) tokens.push_back(token);
+  return tokens;
+}
+
+// Hexadecimal data words are compared as "0xABC"
+string normalizeData(string data)
+{
+  for (auto& c : data) c = (c == 'x' || c == 'X') ? 'x' : toupper(c);
+  return data;
+}
+
+// Reads the C++ emulation memory print from emData/ event by event. The events
+// are separated by "BX = ..." lines. Returns the bin & data of each entry, the
+// bin being empty for unbinned memories.
+class ReferenceReader
+{
+public:
+
+  struct Entry {
+    string bin;
+    string data;
+  };
+
+  ReferenceReader(const string& fileName, bool binned): in_(fileName), binned_(binned) {
+    if (not in_) throw runtime_error("Cannot open " + fileName);
+  }
+
+  // Number of events in the file, which is printed before the events are read
+  static int countEvents(const string& fileName) {
+    ifstream in(fileName);
+    if (not in) throw runtime_error("Cannot open " + fileName);
+    int nevents = 1;
+    string line;
+    for (int iline = 0; getline(in, line); ++iline) {
+      if (iline > 0 && isEventHeader(line)) ++nevents;
+    }
+    return nevents;
+  }
+
+  bool readEvent(vector<Entry>& entries) {
+    entries.clear();
+    if (done_) return false;
+
+    string line;
+    while (getline(in_, line)) {
+      if (isEventHeader(line)) {
+        if (iline_++ == 0) continue;
+        return true;
+      }
+      ++iline_;
+
+      const vector<string> tokens = tokenize(line);
+      if (tokens.empty()) continue;
+      entries.push_back({binned_ ? tokens.front() : string(), normalizeData(tokens.back())});
+    }
+
+    done_ = true;
+    return true;
+  }
+
+private:
+
+  static bool isEventHeader(const string& line) {
+    return line.compare(0, 5, "BX = ") == 0;
+  }
+
+  ifstream in_;
+  const bool binned_;
+  int iline_ = 0;
+  bool done_ = false;
+};
+
+// Reads the .txt file written by the FileWriter*.vhd modules, i.e. a line of
+// column headings followed by one line per memory entry, ordered by BX:
+//     TIME (ns)   BX   ADDR   [BIN]   DATA
+class ComparisonReader
+{
+public:
+
+  struct Row {
+    long bx;
+    string addr;
+    long bin;
+    string data;
+  };
+
+  explicit ComparisonReader(const string& fileName): in_(fileName), fileName_(fileName) {
+    string line;
+    if (not in_ || not getline(in_, line))
+      throw runtime_error("Cannot read " + fileName);
+
+    columnNames_ = tokenize(line);
+    for (unsigned int i = 0; i < columnNames_.size(); ++i) {
+      if (columnNames_[i] == "BX") bxColumn_ = i;
+      else if (columnNames_[i] == "ADDR") addrColumn_ = i;
+      else if (columnNames_[i] == "BIN") binColumn_ = i;
+      else if (columnNames_[i] == "DATA") dataColumn_ = i;
+    }
+    if (bxColumn_ < 0 || addrColumn_ < 0 || dataColumn_ < 0)
+      throw runtime_error("Missing BX, ADDR or DATA column in " + fileName);
+
+    pending_ = readRow(row_);
+  }
+
+  bool isBinned() const { return binColumn_ >= 0; }
+
+  const vector<string>& columnNames() const { return columnNames_; }
+
+  // Fills rows with the entries of event bx. The entries of earlier events
+  // that were not asked for are skipped.
+  void readEvent(long bx, vector<Row>& rows) {
+    rows.clear();
+    while (pending_ && row_.bx <= bx) {
+      if (row_.bx == bx) rows.push_back(row_);
+      const long lastBx = row_.bx;
+      pending_ = readRow(row_);
+      if (pending_ && row_.bx < lastBx)
+        throw runtime_error(fileName_ + " is not ordered by BX");
+    }
+  }
+
+private:
+
+  bool readRow(Row& row) {
+    string line;
+    while (getline(in_, line)) {
+      const vector<string> tokens = tokenize(line);
+      if (tokens.empty()) continue;
+      if (tokens.size() != columnNames_.size())
+        throw runtime_error("Malformed line in " + fileName_ + ": " + line);
+
+      row.bx = stol(tokens[bxColumn_]);
+      row.addr = tokens[addrColumn_];
+      row.bin = isBinned() ? stol(tokens[binColumn_]) : 0;
+      row.data = normalizeData(tokens[dataColumn_]);
+      return true;
+    }
+    return false;
+  }
+
+  ifstream in_;
+  const string fileName_;
+  vector<string> columnNames_;
+  int bxColumn_ = -1, addrColumn_ = -1, binColumn_ = -1, dataColumn_ = -1;
+  Row row_;
+  bool pending_;
+};
+
+struct Options {
+  string comparisonFileName = "output.txt";
+  bool failOnError = false;
+  string fileLocation = "./";
+  bool predefined = false;
+  vector<string> referenceFileNames;
+  bool save = false;
+  bool verbose = false;
+  unsigned int nthreads = thread::hardware_concurrency();
+  string jsonFileName;
+};
+
+// Result of the comparison with one reference file
+struct Summary {
+  string comparisonFileName;
+  string referenceFileName;
+  string type;
+  bool binned = false;
+  int events = 0;
+  int goodEvents = 0;
+  int missingEvents = 0;
+  int lengthMismatches = 0;
+  int valueMismatches = 0;
+
+  int failed() const { return events - goodEvents; }
+};
+
+// Result of one call of compare(), i.e. of one comparison file
+struct Result {
+  vector<Summary> summaries;
+  string log;    // what is printed and saved to the *_cmp.txt file
+  string error;  // set if the comparison stopped early
+};
+
+void printResults(ostream& out, const Summary& s)
+{
+  out << "\nResults\n" << string(7, '=') << "\n";
+  out << "Good events: " << s.goodEvents << "\n";
+  out << "Bad events: " << s.failed() << "\n";
+  out << "\tMissing events: " << s.missingEvents << "\n";
+  out << "\tLength mismatches: " << s.lengthMismatches << "\n";
+  out << "\tValue mismatches: " << s.valueMismatches << "\n\n\n";
+}
+
+// Reports a mismatch, or stops the comparison if failOnError is set
+void mismatch(ostream& out, const Options& options, const string& indent, string message)
+{
+  if (options.failOnError) throw runtime_error(message);
+  for (size_t pos = 0; (pos = message.find('\n', pos)) != string::npos; pos += indent.size() + 1)
+    message.insert(pos + 1, indent);
+  out << indent << message << "\n";
+}
+
+Summary compareReference(ostream& out, const Options& options, const string& comparisonFileName,
+                         const string& referenceFileName)
+{
+  Summary s;
+  s.comparisonFileName = comparisonFileName;
+  s.referenceFileName = referenceFileName;
+  s.type = findReferenceType(referenceFileName).name;
+
+  out << "Comparing TB results to ref. file " << referenceFileName << " ... \n";
+
+  ComparisonReader comparison(options.fileLocation + "/" + comparisonFileName);
+  s.binned = comparison.isBinned();
+  if (options.verbose) {
+    out << "[";
+    for (unsigned int i = 0; i < comparison.columnNames().size(); ++i)
+      out << (i ? ", '" : "'") << comparison.columnNames()[i] << "'";
+    out << "]\n";
+  }
+
+  const string referencePath = options.fileLocation + "/" + referenceFileName;
+  s.events = ReferenceReader::countEvents(referencePath);
+  ReferenceReader reference(referencePath, s.binned);
+
+  vector<ReferenceReader::Entry> event;
+  vector<ComparisonReader::Row> rows;
+  for (int ievent = 0; reference.readEvent(event); ++ievent) {
+    out << "Doing event " << ievent + 1 << "/" << s.events << " ... \n";
+    bool good = true;
+
+    // Select the correct event from the comparison data
+    comparison.readEvent(ievent, rows);
+    if (rows.empty() && not event.empty()) {
+      good = false;
+      s.missingEvents++;
+      mismatch(out, options, "\t", "Event " + to_string(ievent + 1) + " does not exist in the comparison data!");
+    }
+
+    // Check the length of the two sets
+    if (rows.size() != event.size()) {
+      good = false;
+      s.lengthMismatches++;
+      mismatch(out, options, "\t", "The number of entries in the comparison data doesn't match the number of entries in the reference data for event "
+               + to_string(ievent + 1) + "!\n\treference=" + to_string(event.size()) + " comparison=" + to_string(rows.size()));
+    }
+
+    // In case there are fewer entries in the comparison data than in the reference data
+    const size_t nentries = min(rows.size(), event.size());
+    for (size_t i = 0; i < nentries; ++i) {
+      // The values for a given entry must match
+      if (rows[i].data != event[i].data) {
+        good = false;
+        s.valueMismatches++;
+        mismatch(out, options, "\t\t", "The values for event " + to_string(ievent) + " address " + rows[i].addr
+                 + " do not match!\n\treference=" + event[i].data + " comparison=" + rows[i].data);
+      }
+      // As must the bin number
+      else if (s.binned && rows[i].bin != stol(event[i].bin)) {
+        good = false;
+        s.valueMismatches++;
+        mismatch(out, options, "\t\t", "The bin for event " + to_string(ievent) + " stub " + rows[i].data
+                 + " do not match!\n\treference=" + event[i].bin + " comparison=" + to_string(rows[i].bin));
+      }
+    }
+
+    s.goodEvents += good;
+  }
+
+  printResults(out, s);
+  return s;
+}
+
+// Compares one comparison file with its reference files. Nothing is printed,
+// so that several comparisons can run at the same time.
+Result compare(const Options& options, const string& comparisonFileName, const vector<string>& referenceFileNames)
+{
+  Result result;
+  ostringstream out;
+  try {
+    if (referenceFileNames.empty())
+      throw runtime_error("No reference files were specified (-r). At least one reference file is needed to run the comparison.");
+
+    for (const auto& referenceFileName : referenceFileNames)
+      result.summaries.push_back(compareReference(out, options, comparisonFileName, referenceFileName));
+  }
+  catch (const exception& e) {
+    result.error = e.what();
+    out << "ERROR: " << result.error << "\n";
+  }
+  result.log = out.str();
+
+  // Set the output filename
+  if (options.save) {
+    const size_t slash = comparisonFileName.find_last_of('/');
+    const size_t dot = comparisonFileName.find_last_of('.');
+    const bool hasExtension = dot != string::npos && (slash == string::npos || dot > slash);
+    const string cmpFileName = hasExtension ? comparisonFileName.substr(0, dot) + "_cmp" + comparisonFileName.substr(dot)
+                                            : comparisonFileName + "_cmp";
+    ofstream cmp(cmpFileName);
+    cmp << result.log;
+    if (not cmp.good() && result.error.empty())
+      result.error = "Cannot write " + cmpFileName;
+  }
+
+  return result;
+}
+
+vector<string> globFiles(const string& pattern)
+{
+  vector<string> files;
+  glob_t globResult;
+  if (glob(pattern.c_str(), 0, nullptr, &globResult) == 0) {
+    for (size_t i = 0; i < globResult.gl_pathc; ++i)
+      files.push_back(globResult.gl_pathv[i]);
+  }
+  globfree(&globResult);
+  return files;
+}
+
+bool isDirectory(const string& path)
+{
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+string jsonString(const string& s)
+{
+  string escaped = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') escaped += '\\';
+    escaped += c;
+  }
+  return escaped + "\"";
+}
+
+bool writeJson(const string& fileName, const vector<Result>& results, int failed)
+{
+  ofstream json(fileName);
+  json << "{\n  \"comparisons\": [";
+  bool first = true;
+  for (const auto& result : results) {
+    for (const auto& s : result.summaries) {
+      json << (first ? "\n" : ",\n");
+      first = false;
+      json << "    {\n"
+           << "      \"comparison\": " << jsonString(s.comparisonFileName) << ",\n"
+           << "      \"reference\": " << jsonString(s.referenceFileName) << ",\n"
+           << "      \"type\": " << jsonString(s.type) << ",\n"
+           << "      \"binned\": " << (s.binned ? "true" : "false") << ",\n"
+           << "      \"events\": " << s.events << ",\n"
+           << "      \"good_events\": " << s.goodEvents << ",\n"
+           << "      \"bad_events\": " << s.failed() << ",\n"
+           << "      \"missing_events\": " << s.missingEvents << ",\n"
+           << "      \"length_mismatches\": " << s.lengthMismatches << ",\n"
+           << "      \"value_mismatches\": " << s.valueMismatches << "\n"
+           << "    }";
+    }
+  }
+  json << "\n  ],\n  \"errors\": [";
+  first = true;
+  for (const auto& result : results) {
+    if (result.error.empty()) continue;
+    json << (first ? "" : ", ") << jsonString(result.error);
+    first = false;
+  }
+  json << "],\n  \"failed\": " << failed << "\n}\n";
+  return json.good();
+}
+
+void usage()
+{
+  cout <<
+    "Compare reference files to the output of the testbench.\n"
+    "\n"
+    "Options:\n"
+    "  -c, --comparison_filename FILE  The filename of the testbench output file (default = output.txt)\n"
+    "  -f, --fail_on_error             Stop on the first error as opposed to simply printing a message\n"
+    "  -l, --file_location DIR         Location of the input files (default = ./)\n"
+    "  -p, --predefined                Run predefined comparisons using the output files in ./dataOut. Make sure\n"
+    "                                  that the reference files are located in ../../../emData/MemPrints/\n"
+    "  -r, --reference_filenames FILE [FILE ...]  A list of filenames for the reference files\n"
+    "  -s, --save                      Save the output to a file (<comparison file>_cmp.txt)\n"
+    "  -v, --verbose                   Print extra information to the console\n"
+    "  -t, --threads N                 Number of memories compared in parallel (default = number of cores)\n"
+    "  -j, --json FILE                 Also write the results to FILE as JSON\n"
+    "\n"
+    "Examples:\n"
+    "  CompareMemPrintsFW -l testData/ -r CandidateMatches_CM_L3PHIC17_04.dat -c CM_L3PHIC17.txt\n"
+    "  CompareMemPrintsFW -l testData/ -r VMProjections_VMPROJ_L3PHIC17_04.dat -c VMPROJ_L3PHIC17.txt\n"
+    "  CompareMemPrintsFW -p -s -j dataOut/comparison.json\n";
+}
+
+bool parseArguments(int argc, char* argv[], Options& options)
+{
+  for (int i = 1; i < argc; ++i) {
+    const string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "-h" || arg == "--help") { usage(); exit(0); }
+    else if ((arg == "-c" || arg == "--comparison_filename") && hasValue) options.comparisonFileName = argv[++i];
+    else if (arg == "-f" || arg == "--fail_on_error") options.failOnError = true;
+    else if ((arg == "-l" || arg == "--file_location") && hasValue) options.fileLocation = argv[++i];
+    else if (arg == "-p" || arg == "--predefined") options.predefined = true;
+    else if (arg == "-r" || arg == "--reference_filenames") {
+      while (i + 1 < argc && argv[i + 1][0] != '-') options.referenceFileNames.push_back(argv[++i]);
+    }
+    else if (arg == "-s" || arg == "--save") options.save = true;
+    else if (arg == "-v" || arg == "--verbose") options.verbose = true;
+    else if ((arg == "-t" || arg == "--threads") && hasValue) options.nthreads = atoi(argv[++i]);
+    else if ((arg == "-j" || arg == "--json") && hasValue) options.jsonFileName = argv[++i];
+    else {
+      cerr << "Unknown or incomplete argument " << arg << endl;
+      usage();
+      return false;
+    }
+  }
+  if (options.nthreads == 0) options.nthreads = 1;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (not parseArguments(argc, argv, options)) return 2;
+
+  // The comparisons to run: a comparison file and its reference files
+  vector<pair<string, vector<string> > > jobs;
+
+  if (options.predefined) {
+    const string comparisonDir = "./dataOut/";
+    const string referenceDir = "../../../emData/MemPrints/";
+
+    // Make sure the default directories exists
+    if (not isDirectory(comparisonDir) || not isDirectory(referenceDir)) {
+      cerr << "Please make sure that the directories " << comparisonDir << " and " << referenceDir
+           << " exist from where this program is run with the predefined (-p) flag" << endl;
+      return 2;
+    }
+
+    // Remove debug and comparison files from file list
+    for (const auto& comparisonFileName : globFiles(comparisonDir + "*.txt")) {
+      if (comparisonFileName.find("debug") != string::npos || comparisonFileName.find("cmp") != string::npos)
+        continue;
+
+      // Remove file extension and replace TEO/TEI with TE
+      string name = comparisonFileName.substr(comparisonFileName.find_last_of('/') + 1);
+      name = name.substr(0, name.find('.'));
+      name = regex_replace(name, regex("TE[OI]"), "TE");
+
+      // Find the corresponding reference filename
+      const vector<string> referenceFileNames = globFiles(referenceDir + "*/*" + name + "*.dat");
+      if (referenceFileNames.empty()) {
+        cerr << "Could not find matching reference file for comparison file " << comparisonFileName << endl;
+        return 2;
+      }
+      jobs.push_back(make_pair(comparisonFileName, vector<string>(1, referenceFileNames.front())));
+    }
+  }
+  else {
+    jobs.push_back(make_pair(options.comparisonFileName, options.referenceFileNames));
+  }
+
+  // Compare the memories on a pool of threads; the output is printed in the
+  // same order as the comparisons are listed
+  vector<promise<Result> > promises(jobs.size());
+  atomic<unsigned int> nextJob(0);
+  auto processJobs = [&]() {
+    for (unsigned int i = nextJob++; i < jobs.size(); i = nextJob++)
+      promises[i].set_value(compare(options, jobs[i].first, jobs[i].second));
+  };
+
+  vector<thread> threads;
+  for (unsigned int i = 0; i < min<size_t>(options.nthreads, jobs.size()); ++i)
+    threads.emplace_back(processJobs);
+
+  vector<Result> results;
+  int failed = 0;
+  bool error = false;
+  for (auto& p : promises) {
+    results.push_back(p.get_future().get());
+    cout << results.back().log << flush;
+    for (const auto& s : results.back().summaries) failed += s.failed();
+    if (not results.back().error.empty()) {
+      cerr << results.back().error << endl;
+      error = true;
+    }
+  }
+  for (auto& t : threads)
+    t.join();
+
+  if (options.predefined)
+    cout << "Accumulated number of errors = " << failed << endl;
+
+  if (not options.jsonFileName.empty() && not writeJson(options.jsonFileName, results, failed)) {
+    cerr << "Could not write " << options.jsonFileName << endl;
+    error = true;
+  }
+
+  if (error) return 1;
+  // The exit code only has 8 bits, so that e.g. 256 failed events would pass
+  return min(failed, 255);
+}
@@ -0,0 +1,76 @@
+// Replacement of the global allocation functions for the benchmarks, see
+// Benchmark.h. Compiled once and linked into every *_bench executable, so that
+// the allocations of the whole executable are counted. All the forms of
+// operator new count and allocate with malloc (or aligned_alloc), and all the
+// forms of operator delete release with free. Benchmark.h is not included, as
+// the functions of FileReadUtility.h are defined in every file including it.
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+std::atomic<unsigned long> nBenchmarkAllocations(0);
+
+namespace {
+
+void* benchmarkAllocate(std::size_t size)
+{
+  ++nBenchmarkAllocations;
+  return std::malloc(size ? size : 1);
+}
+
+void* benchmarkAllocateOrThrow(std::size_t size)
+{
+  void* ptr = benchmarkAllocate(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+}
+
+void* operator new(std::size_t size) { return benchmarkAllocateOrThrow(size); }
+void* operator new[](std::size_t size) { return benchmarkAllocateOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return benchmarkAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return benchmarkAllocate(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+#ifdef __cpp_aligned_new
+namespace {
+
+void* benchmarkAllocateAligned(std::size_t size, std::align_val_t alignment)
+{
+  ++nBenchmarkAllocations;
+  // aligned_alloc needs a size that is a multiple of the alignment
+  const std::size_t align = static_cast<std::size_t>(alignment);
+  return std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align);
+}
+
+void* benchmarkAllocateAlignedOrThrow(std::size_t size, std::align_val_t alignment)
+{
+  void* ptr = benchmarkAllocateAligned(size, alignment);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) { return benchmarkAllocateAlignedOrThrow(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return benchmarkAllocateAlignedOrThrow(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return benchmarkAllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return benchmarkAllocateAligned(size, alignment); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+#endif
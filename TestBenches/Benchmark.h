@@ -0,0 +1,145 @@
+// Throughput benchmark of the top functions in C simulation. The test vectors
+// are read once, then the top function is run over all events a number of
+// times. Only the top function itself is timed: the input memories are
+// written and the output memories cleared between the measurements.
+//
+// For every benchmark the time per event, the number of events per second,
+// the time per input (stub, projection, ... entering the module) and the
+// number of heap allocations per event are reported, optionally also as JSON
+// so that they can be tracked from one release to the next.
+//
+// Usage: <benchmark> [repetitions] [JSON file]
+//
+// The allocations are counted by the replacement of the global operator new
+// in Benchmark.cpp, which is linked into every benchmark.
+#ifndef TestBenches_Benchmark_h
+#define TestBenches_Benchmark_h
+
+#include "FileReadUtility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Allocations made by the benchmark executable, counted in Benchmark.cpp
+extern std::atomic<unsigned long> nBenchmarkAllocations;
+
+class ModuleBenchmark
+{
+public:
+
+  typedef std::vector<std::vector<std::string> > EventLines;
+
+  ModuleBenchmark(const std::string& name, int argc, char* argv[]):
+    name_(name),
+    repetitions_((argc > 1) ? std::max(atoi(argv[1]), 1) : 10),
+    jsonFile_((argc > 2) ? argv[2] : ""),
+    nevents_(-1)
+  {}
+
+  // Reads a memory print file, split by event. The number of events run is
+  // that of the shortest file read.
+  EventLines readEvents(const std::string& fileName) {
+    std::ifstream fin;
+    if (not openDataFile(fin, fileName)) std::exit(-1);
+    return readEvents(fin);
+  }
+
+  EventLines readEvents(std::ifstream& fin) {
+    EventLines events = readEventsFromFile(fin);
+    if (nevents_ < 0 || (int)events.size() < nevents_) nevents_ = events.size();
+    return events;
+  }
+
+  // All files matching the query, in the order of TBHelper::files
+  std::vector<EventLines> readEvents(TBHelper& tb, const std::string& query) {
+    std::vector<EventLines> events;
+    for (auto& fin : tb.files(query))
+      events.push_back(readEvents(fin));
+    return events;
+  }
+
+  // Runs process(ievt) over all events. Before each call, setup(ievt) writes
+  // the input memories of the event, clears the output memories and returns
+  // the number of inputs of the event. The first pass over the events is not
+  // measured, so that LUTs, caches etc. are loaded.
+  template<class Setup, class Process>
+  void run(Setup setup, Process process) {
+    const int nevents = std::max(nevents_, 0);
+    for (int ievt = 0; ievt < nevents; ++ievt) {
+      setup(ievt);
+      process(ievt);
+    }
+
+    for (int irep = 0; irep < repetitions_; ++irep) {
+      for (int ievt = 0; ievt < nevents; ++ievt) {
+        ninputs_ += setup(ievt);
+
+        const unsigned long nallocs = nBenchmarkAllocations;
+        const auto start = std::chrono::steady_clock::now();
+        process(ievt);
+        const auto stop = std::chrono::steady_clock::now();
+
+        nallocs_ += nBenchmarkAllocations - nallocs;
+        time_ += std::chrono::duration<double, std::nano>(stop - start).count();
+        ++nrun_;
+      }
+    }
+  }
+
+  // Prints the results and writes them to the JSON file, if any
+  int report() const {
+    if (nrun_ == 0) {
+      std::cerr << name_ << ": no events were run" << std::endl;
+      return -1;
+    }
+
+    const double nsPerEvent = time_ / nrun_;
+    const double nsPerInput = ninputs_ ? time_ / ninputs_ : 0.;
+    const double inputsPerEvent = (double)ninputs_ / nrun_;
+    const double allocsPerEvent = (double)nallocs_ / nrun_;
+
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-28s %10s %14s %14s %14s %14s %14s",
+                  "Benchmark", "Events", "ns/event", "events/s", "inputs/event", "ns/input", "allocs/event");
+    std::cout << line << std::endl;
+    std::snprintf(line, sizeof(line), "%-28s %10lu %14.1f %14.1f %14.2f %14.2f %14.2f",
+                  name_.c_str(), nrun_, nsPerEvent, 1e9 / nsPerEvent, inputsPerEvent, nsPerInput, allocsPerEvent);
+    std::cout << line << std::endl;
+
+    if (jsonFile_.empty()) return 0;
+
+    std::ofstream json(jsonFile_);
+    json << "{\n"
+         << "  \"benchmark\": \"" << name_ << "\",\n"
+         << "  \"events\": " << nrun_ << ",\n"
+         << "  \"repetitions\": " << repetitions_ << ",\n"
+         << "  \"ns_per_event\": " << nsPerEvent << ",\n"
+         << "  \"events_per_second\": " << 1e9 / nsPerEvent << ",\n"
+         << "  \"inputs_per_event\": " << inputsPerEvent << ",\n"
+         << "  \"ns_per_input\": " << nsPerInput << ",\n"
+         << "  \"allocations_per_event\": " << allocsPerEvent << "\n"
+         << "}" << std::endl;
+    if (not json.good()) {
+      std::cerr << "Could not write " << jsonFile_ << std::endl;
+      return -1;
+    }
+    return 0;
+  }
+
+private:
+
+  const std::string name_;
+  const int repetitions_;
+  const std::string jsonFile_;
+
+  int nevents_;                 // events in the shortest input file
+  unsigned long nrun_ = 0;      // events run
+  unsigned long ninputs_ = 0;   // inputs of the events run
+  unsigned long nallocs_ = 0;   // allocations made by the top function
+  double time_ = 0.;            // time spent in the top function [ns]
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Test bench for the binary memory prints
+//
+// Checks that the events of the binary memory prints written by
+// emData/convert_memprints.py fill the memories exactly as the text memory
+// prints do with writeMemFromFile, for unbinned, binned and binned CM
+// memories, and for data words of up to 64 bits and of more than 64 bits.
+// Also checks that a memory print whose events are all empty, which the
+// converter writes with 0-bit data words, loads as empty events.
+// Run from emData after converting the memory prints below:
+//   ./convert_memprints.py PR/PR_L3PHIC ME/ME_L3PHIC20 MP/MP_L3PHIC FT/FT_L1L2
+//   BinaryMemPrint_test
+#include "AllProjectionMemory.h"
+#include "VMStubMEMemory.h"
+#include "VMStubMEMemoryCM.h"
+#include "TrackletParameterMemory.h"
+#include "FileReadUtility.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+// Binned memories: the entries of each bin and the whole memory
+template<class MemType>
+auto compareEntries(const MemType& text, const MemType& binary, BXType bx, int)
+  -> decltype(text.getNBins(), int())
+{
+  int err = 0;
+  for (unsigned int ibin = 0; ibin < text.getNBins(); ++ibin)
+    err += (text.getEntries(bx, ibin) != binary.getEntries(bx, ibin));
+  return err;
+}
+
+template<class MemType>
+int compareEntries(const MemType& text, const MemType& binary, BXType bx, long)
+{
+  return text.getEntries(bx) != binary.getEntries(bx);
+}
+
+template<class MemType>
+int compareData(const MemType& text, const MemType& binary, BXType bx)
+{
+  int err = 0;
+  for (unsigned int i = 0; i < text.getDepth(); ++i)
+    err += (text.read_mem(bx, i).raw() != binary.read_mem(bx, i).raw());
+  return err;
+}
+
+template<class DataType, unsigned int NBIT_BX, unsigned int NBIT_ADDR, unsigned int NBIT_BIN, unsigned int NCOPY>
+int compareData(const MemoryTemplateBinnedCM<DataType, NBIT_BX, NBIT_ADDR, NBIT_BIN, NCOPY>& text,
+                const MemoryTemplateBinnedCM<DataType, NBIT_BX, NBIT_ADDR, NBIT_BIN, NCOPY>& binary, BXType bx)
+{
+  int err = 0;
+  for (unsigned int icopy = 0; icopy < NCOPY; ++icopy)
+    for (unsigned int i = 0; i < text.getDepth(); ++i)
+      err += (text.read_mem(icopy, bx, i).raw() != binary.read_mem(icopy, bx, i).raw());
+  return err;
+}
+
+template<class MemType>
+int roundTrip(const string& fileName)
+{
+  static MemType text, binary;
+
+  ifstream fin;
+  if (not openDataFile(fin, fileName + ".dat")) return 1;
+  const auto events = readEventsFromFile(fin);
+  const BinaryMemPrint memprint(fileName + ".bin");
+  if (not memprint.good()) return 1;
+  if (events.size() != memprint.nEvents()) {
+    cerr << fileName << ": " << events.size() << " events in the text and " << memprint.nEvents() << " in the binary memory print" << endl;
+    return 1;
+  }
+
+  int err = 0;
+  for (unsigned int ievt = 0; ievt < events.size(); ++ievt) {
+    writeMemFromEvent(text, events[ievt], ievt);
+    if (not memprint.writeMem(binary, ievt)) {
+      ++err;
+      continue;
+    }
+    const BXType bx = ievt;
+    err += compareEntries(text, binary, bx, 0) + compareData(text, binary, bx);
+  }
+  cout << fileName << ": " << events.size() << " events, " << err << " errors" << endl;
+  return err;
+}
+
+static_assert(not std::is_copy_constructible<BinaryMemPrint>::value, "A copy of BinaryMemPrint would unmap its file twice");
+
+// Memory print of nevents empty events, as written by the converter
+int emptyEvents(unsigned int nevents)
+{
+  char fileName[] = "/tmp/BinaryMemPrint_testXXXXXX";
+  const int fd = mkstemp(fileName);
+  if (fd < 0) return 1;
+  close(fd);
+  {
+    ofstream fout(fileName, ios::binary);
+    const uint32_t header[4] = {0, 0, 0, nevents};
+    fout.write("MEMPRBIN", 8);
+    fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+    const vector<uint64_t> offsets(nevents + 1, 0);
+    fout.write(reinterpret_cast<const char*>(offsets.data()), 8 * offsets.size());
+  }
+
+  int err = 0;
+  {
+    const BinaryMemPrint memprint(fileName);
+    static AllProjectionMemory<BARRELPS> binary;
+    if (not memprint.good() || memprint.nEvents() != nevents) {
+      ++err;
+    } else {
+      for (unsigned int ievt = 0; ievt < nevents; ++ievt)
+        err += (not memprint.writeMem(binary, ievt)) || binary.getEntries(BXType(ievt)) != 0;
+    }
+  }
+  remove(fileName);
+  cout << "Empty memory print: " << nevents << " events, " << err << " errors" << endl;
+  return err;
+}
+
+int main()
+{
+  int err = emptyEvents(3);
+  err += roundTrip<AllProjectionMemory<BARRELPS> >("PR/PR_L3PHIC/AllProj_AP_L3PHIC_04");
+  err += roundTrip<VMStubMEMemory<BARRELPS, 3> >("ME/ME_L3PHIC20/VMStubs_VMSME_L3PHIC20n1_04");
+  err += roundTrip<VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEngines> >("MP/MP_L3PHIC/VMStubs_VMSME_L3PHICn1_04");
+  err += roundTrip<TrackletParameterMemory>("FT/FT_L1L2/TrackletParameters_TPAR_L1L2A_04");
+  return err;
+}
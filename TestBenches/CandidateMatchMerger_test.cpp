@@ -0,0 +1,95 @@
+// Test bench for the merger tree of the MatchCalculator
+//
+// Fills NInputs candidate match memories with random candidate matches, each
+// memory sorted by projection index, and checks that CandidateMatchMerger
+// outputs each of them once, sorted by projection index, for trees of 1 to 16
+// inputs, of which the tree of 8 inputs of MC_L3PHIC:
+//   CandidateMatchMerger_test [number of events per tree]
+#include "MatchCalculator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Maximum number of candidate matches per memory, so that the candidate
+// matches of all the memories are merged within the kMaxProc clocks
+const int kMaxNCM = 6;
+
+static CandidateMatchMemory match[16];
+
+template<int NInputs>
+int testMerger(int nevents, mt19937& rng)
+{
+  int err = 0;
+
+  for (int ievt = 0; ievt < nevents; ++ievt) {
+    const BXType bx = ievt;
+
+    // input candidate matches, with a different (nonzero) stub index each
+    vector<unsigned int> input;
+    for (int i = 0; i < NInputs; ++i) {
+      match[i].clear();
+      vector<unsigned int> projindex(rng() % (kMaxNCM + 1));
+      for (auto& id : projindex) id = rng() % (1 << kNBits_MemAddr);
+      sort(projindex.begin(), projindex.end());
+      for (unsigned int k = 0; k < projindex.size(); ++k) {
+        const CandidateMatch cm(projindex[k], i * kMaxNCM + k + 1);
+        match[i].write_mem(bx, cm, k);
+        input.push_back(cm.raw());
+      }
+    }
+
+    // the output holds its value while no candidate match comes out
+    CandidateMatchMerger<NInputs> merger;
+    vector<unsigned int> output;
+    CandidateMatch last;
+    for (int istep = 0; istep < kMaxProc - kMaxProcOffset(module::MC); ++istep) {
+      merger.step(bx, match);
+      const CandidateMatch& cm = merger.getOutput();
+      if (merger.getValid() && cm.raw() != last.raw()) {
+        if (!output.empty() && cm.getProjIndex() < last.getProjIndex()) {
+          cout << NInputs << " inputs, event " << ievt << ": projection " << cm.getProjIndex()
+               << " after " << last.getProjIndex() << " <=== ERROR" << endl;
+          err++;
+        }
+        output.push_back(cm.raw());
+        last = cm;
+      }
+    }
+
+    sort(input.begin(), input.end());
+    sort(output.begin(), output.end());
+    if (output != input) {
+      cout << NInputs << " inputs, event " << ievt << ": " << output.size() << " candidate matches out of "
+           << input.size() << " <=== ERROR" << endl;
+      err++;
+    }
+  }
+
+  cout << NInputs << " inputs (" << CandidateMatchMerger<NInputs>::kNLevels << " levels): "
+       << err << " errors" << endl;
+  return err;
+}
+
+int main(int argc, char* argv[])
+{
+  const int nevents = (argc > 1) ? atoi(argv[1]) : 100;
+  mt19937 rng(1);
+
+  int err = 0;
+  err += testMerger<1>(nevents, rng);
+  err += testMerger<2>(nevents, rng);
+  err += testMerger<3>(nevents, rng);
+  err += testMerger<5>(nevents, rng);
+  err += testMerger<8>(nevents, rng);
+  err += testMerger<12>(nevents, rng);
+  err += testMerger<16>(nevents, rng);
+
+  // This is necessary because HLS seems to only return an 8-bit error count, so if err%256==0, the test bench can falsely pass
+  if (err > 255) err = 255;
+  return err;
+}
@@ -0,0 +1,245 @@
+// Test bench for the DuplicateRemoval of L1L2: the TrackFit tracks of the
+// emulation memory prints are given to DuplicateRemoval_L1L2 in the
+// TrackBuilder output format, and the clean tracks are compared with the
+// CleanTrack memory of the emulation. The emulation also removes the L1L2
+// tracks duplicated by the tracks of other seeds, and chooses among duplicates
+// in its own way, so each clean track of the emulation must either be a clean
+// track or share at least kMinNSharedStubs stubs with a clean track that has as
+// many stubs or more. The tracks of each kind are counted. The same tracks are
+// also given twice, as two seeds, to DuplicateRemoval<2>, which must give the
+// same first kMaxNCompTracks clean tracks: the tracks of the second seed are
+// duplicates of those of the first one, and lose the tie. The clean tracks
+// after them are not compared with each other, so these tracks are written
+// twice, and the later clean tracks of one seed must be among those of the two,
+// unless the tracks written twice fill the output.
+#include "DuplicateRemovalTop.h"
+
+#include "FileReadUtility.h"
+#include "Constants.h"
+
+#include <vector>
+
+const int nevents = 100;  //number of events to run
+
+using namespace std;
+
+// Track and stub words of a TrackFit
+struct Track {
+  TrackFit::TrackWord trackWord;
+  TrackFit::BarrelStubWord barrelStubWords[TrackFit::kNBarrelStubs];
+  TrackFit::DiskStubWord diskStubWords[TrackFit::kNDiskStubs];
+};
+
+// Valid bit and index of stub j of a track
+bool stubValid(const Track& track, unsigned int j)
+{
+  return (j < TrackFit::kNBarrelStubs) ?
+    track.barrelStubWords[j][TrackFit::kBarrelStubSize - 1] :
+    track.diskStubWords[j - TrackFit::kNBarrelStubs][TrackFit::kDiskStubSize - 1];
+}
+
+unsigned int stubIndex(const Track& track, unsigned int j)
+{
+  const unsigned int lsb = TrackFit::kTFStubIndexLSB(j) - TrackFit::kTFStubRZResidLSB(j);
+  return (j < TrackFit::kNBarrelStubs) ?
+    track.barrelStubWords[j].range(lsb + TrackFit::kTFStubIndexSize - 1, lsb).to_uint() :
+    track.diskStubWords[j - TrackFit::kNBarrelStubs].range(lsb + TrackFit::kTFStubIndexSize - 1, lsb).to_uint();
+}
+
+unsigned int nStubs(const Track& track)
+{
+  unsigned int n = 0;
+  for (unsigned int j = 0; j < TrackFit::kNStubs; ++j)
+    n += stubValid(track, j);
+  return n;
+}
+
+unsigned int nSharedStubs(const Track& a, const Track& b)
+{
+  unsigned int n = 0;
+  for (unsigned int j = 0; j < TrackFit::kNStubs; ++j)
+    n += (stubValid(a, j) && stubValid(b, j) && stubIndex(a, j) == stubIndex(b, j));
+  return n;
+}
+
+Track readTrack(const TrackFit& tf)
+{
+  Track track = {};
+  track.trackWord = tf.getTrackWord();
+  track.barrelStubWords[0] = tf.getBarrelStubWord<0>();
+  track.barrelStubWords[1] = tf.getBarrelStubWord<1>();
+  track.barrelStubWords[2] = tf.getBarrelStubWord<2>();
+  track.barrelStubWords[3] = tf.getBarrelStubWord<3>();
+  track.diskStubWords[0] = tf.getDiskStubWord<4>();
+  track.diskStubWords[1] = tf.getDiskStubWord<5>();
+  track.diskStubWords[2] = tf.getDiskStubWord<6>();
+  track.diskStubWords[3] = tf.getDiskStubWord<7>();
+  return track;
+}
+
+bool sameTrack(const Track& a, const Track& b)
+{
+  bool same = (a.trackWord == b.trackWord);
+  for (unsigned int j = 0; j < TrackFit::kNBarrelStubs; ++j)
+    same &= (a.barrelStubWords[j] == b.barrelStubWords[j]);
+  for (unsigned int j = 0; j < TrackFit::kNDiskStubs; ++j)
+    same &= (a.diskStubWords[j] == b.diskStubWords[j]);
+  return same;
+}
+
+int main()
+{
+  // error counts
+  int err = 0;
+
+  ///////////////////////////
+  // input memories
+  static TrackFitMemory tracks;
+  static TrackFitMemory cleanTracksEmu;
+  static TrackFit::TrackWord trackWord[2][kMaxProc];
+  static TrackFit::BarrelStubWord barrelStubWords[2][TrackFit::kNBarrelStubs][kMaxProc];
+  static TrackFit::DiskStubWord diskStubWords[2][TrackFit::kNDiskStubs][kMaxProc];
+
+  // output memories
+  static Track cleanTracks[2][kMaxProc];
+  static TrackFit::TrackWord cleanTrackWord[kMaxProc];
+  static TrackFit::BarrelStubWord cleanBarrelStubWords[TrackFit::kNBarrelStubs][kMaxProc];
+  static TrackFit::DiskStubWord cleanDiskStubWords[TrackFit::kNDiskStubs][kMaxProc];
+
+  ///////////////////////////
+  // open input files
+  cout << "Open files..." << endl;
+
+  ifstream fin_tracks;
+  if (not openDataFile(fin_tracks, "PD/TrackFit_TF_L1L2_04.dat")) return -1;
+
+  ifstream fin_cleanTracks;
+  if (not openDataFile(fin_cleanTracks, "PD/CleanTrack_CT_L1L2_04.dat")) return -1;
+
+  // tracks on which the clean tracks agree and differ, over all events
+  int nSame = 0, nReplaced = 0, nExtra = 0;
+
+  ///////////////////////////
+  // loop over events
+  cout << "Start event loop ..." << endl;
+  for (unsigned int ievt = 0; ievt < nevents; ++ievt) {
+    cout << "Event: " << dec << ievt << endl;
+
+    // read event and write to memories
+    tracks.clear();
+    writeMemFromFile<TrackFitMemory>(tracks, fin_tracks, ievt);
+    cleanTracksEmu.clear();
+    writeMemFromFile<TrackFitMemory>(cleanTracksEmu, fin_cleanTracks, ievt);
+
+    BXType bx = ievt;
+    BXType bx_o;
+
+    for (unsigned short i = 0; i < kMaxProc; i++) {
+      const Track track = (i < tracks.getEntries(bx)) ? readTrack(tracks.read_mem(bx, i)) : Track();
+      // The same tracks for both seeds, except those with too few stubs to be
+      // duplicates of themselves
+      for (unsigned short s = 0; s < 2; s++) {
+        if (s == 1 && nStubs(track) < kMinNSharedStubs) {
+          trackWord[s][i] = TrackFit::TrackWord(0);
+          continue;
+        }
+        trackWord[s][i] = track.trackWord;
+        for (unsigned short j = 0; j < TrackFit::kNBarrelStubs; j++)
+          barrelStubWords[s][j][i] = track.barrelStubWords[j];
+        for (unsigned short j = 0; j < TrackFit::kNDiskStubs; j++)
+          diskStubWords[s][j][i] = track.diskStubWords[j];
+      }
+    }
+
+    // Units Under Test, with one seed and with the tracks given twice
+    for (unsigned short s = 0; s < 2; s++) {
+      for (unsigned short i = 0; i < kMaxProc; i++) {
+        cleanTrackWord[i] = TrackFit::TrackWord(0);
+        for (unsigned short j = 0; j < TrackFit::kNBarrelStubs; j++)
+          cleanBarrelStubWords[j][i] = TrackFit::BarrelStubWord(0);
+        for (unsigned short j = 0; j < TrackFit::kNDiskStubs; j++)
+          cleanDiskStubWords[j][i] = TrackFit::DiskStubWord(0);
+      }
+
+      if (s == 0)
+        DuplicateRemoval_L1L2(bx, trackWord, barrelStubWords, diskStubWords,
+          bx_o, cleanTrackWord, cleanBarrelStubWords, cleanDiskStubWords);
+      else
+        DuplicateRemoval<2>(bx, trackWord, barrelStubWords, diskStubWords,
+          bx_o, cleanTrackWord, cleanBarrelStubWords, cleanDiskStubWords);
+
+      for (unsigned short i = 0; i < kMaxProc; i++) {
+        cleanTracks[s][i].trackWord = cleanTrackWord[i];
+        for (unsigned short j = 0; j < TrackFit::kNBarrelStubs; j++)
+          cleanTracks[s][i].barrelStubWords[j] = cleanBarrelStubWords[j][i];
+        for (unsigned short j = 0; j < TrackFit::kNDiskStubs; j++)
+          cleanTracks[s][i].diskStubWords[j] = cleanDiskStubWords[j][i];
+      }
+    }
+
+    // compare the clean tracks of one seed with those of the emulation
+    int nerr = 0;
+    vector<bool> matched(kMaxProc, false);
+    for (unsigned short k = 0; k < cleanTracksEmu.getEntries(bx); k++) {
+      const Track emu = readTrack(cleanTracksEmu.read_mem(bx, k));
+      bool same = false, replaced = false;
+      for (unsigned short i = 0; i < kMaxProc; i++) {
+        const Track& clean = cleanTracks[0][i];
+        if (!clean.trackWord[TrackFit::kTrackWordSize - 1]) continue;
+        if (sameTrack(clean, emu)) {
+          same = true;
+          matched[i] = true;
+        }
+        replaced |= (nSharedStubs(clean, emu) >= kMinNSharedStubs && nStubs(clean) >= nStubs(emu));
+      }
+      if (same) {
+        nSame++;
+      } else if (replaced) {
+        nReplaced++;
+      } else {
+        cout << "Clean track " << k << " of the emulation: " << hex << emu.trackWord << dec
+             << " neither kept nor replaced <=== ERROR" << endl;
+        nerr++;
+      }
+    }
+    for (unsigned short i = 0; i < kMaxProc; i++)
+      nExtra += (cleanTracks[0][i].trackWord[TrackFit::kTrackWordSize - 1] && !matched[i]);
+
+    // the tracks given twice give the same clean tracks
+    for (unsigned short i = 0; i < kMaxNCompTracks; i++) {
+      if (!sameTrack(cleanTracks[1][i], cleanTracks[0][i])) {
+        cout << "Track " << i << " of 2 seeds: " << hex << cleanTracks[1][i].trackWord
+             << " expected " << cleanTracks[0][i].trackWord << dec << " <=== ERROR" << endl;
+        nerr++;
+      }
+    }
+    const bool full = cleanTracks[1][kMaxProc - 1].trackWord[TrackFit::kTrackWordSize - 1];
+    for (unsigned short i = kMaxNCompTracks; i < kMaxProc && !full; i++) {
+      if (!cleanTracks[0][i].trackWord[TrackFit::kTrackWordSize - 1]) continue;
+      bool found = false;
+      for (unsigned short k = kMaxNCompTracks; k < kMaxProc; k++)
+        found |= sameTrack(cleanTracks[1][k], cleanTracks[0][i]);
+      if (!found) {
+        cout << "Track " << i << ": " << hex << cleanTracks[0][i].trackWord << dec
+             << " not found with 2 seeds <=== ERROR" << endl;
+        nerr++;
+      }
+    }
+    if (bx_o != bx) {
+      cout << "BX " << bx_o << " expected " << bx << " <=== ERROR" << endl;
+      nerr++;
+    }
+    cout << "Tracks: " << tracks.getEntries(bx) << ", clean tracks of the emulation: "
+         << cleanTracksEmu.getEntries(bx) << ", errors: " << nerr << endl;
+    err += nerr;
+
+  } // end of event loop
+
+  cout << "Clean tracks of the emulation: " << nSame << " kept, " << nReplaced
+       << " replaced by a duplicate; other clean tracks: " << nExtra << endl;
+
+  // This is necessary because HLS seems to only return an 8-bit error count, so if err%256==0, the test bench can falsely pass
+  if (err > 255) err = 255;
+  return err;
+
+}
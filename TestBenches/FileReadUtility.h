@@ -11,6 +11,10 @@
 #include <cstring>
 #include <cerrno>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdint.h>
 #include <vector>
 #include <bitset>
 #include <map>
@@ -48,6 +52,15 @@ std::vector<std::string> split(const std::string& s, char delimiter)
   return tokens;
 }
 
+// Name of the memory of a memory print, as used by the emulation, e.g.
+// "VMPROJ_L3PHIC17" for PR_L3PHIC/VMProjections_VMPROJ_L3PHIC17_04.dat
+std::string memoryName(const std::string& file_name)
+{
+  std::string name = file_name.substr(file_name.find_last_of('/') + 1);
+  name = name.substr(name.find('_') + 1);
+  return name.substr(0, name.find_last_of('_'));
+}
+
 
 // S.S. Storey 
 // added because the IR 
@@ -94,6 +107,18 @@ void writeArrayFromFile(DataType* hData, std::ifstream& pInputStream, int pEvent
   }while( pInputStream.good() && cEventCounter <= pEvent);
 }
 
+// Writes one line of a memory print file into the memory
+template<class MemType>
+void writeMemFromLine(MemType& memory, const std::string& line, int ievt, int base=16)
+{
+  if (split(line,' ').size()==4) {
+    memory.write_mem(ievt, line, base);
+  } else {
+    const std::string datastr = split(line, ' ').back();
+    memory.write_mem(ievt, datastr, base);
+  }
+}
+
 template<class MemType>
 void writeMemFromFile(MemType& memory, std::ifstream& fin, int ievt, int base=16)
 {
@@ -114,17 +139,180 @@ void writeMemFromFile(MemType& memory, std::ifstream& fin, int ievt, int base=16
     if (line.find("Event") != std::string::npos) {
       return;
     } else {
-      if (split(line,' ').size()==4) {
-       memory.write_mem(ievt, line, base);
-      } else {
-	const std::string datastr = split(line, ' ').back();
-	memory.write_mem(ievt, datastr, base);
-      }
+      writeMemFromLine<MemType>(memory, line, ievt, base);
     }	
   }
   
 }
 
+// Reads all events of a memory print file in one go. Returns, for each event,
+// the lines with the memory contents, which can then be written to memories
+// with writeMemFromEvent as many times, and from as many threads, as needed.
+std::vector<std::vector<std::string> > readEventsFromFile(std::ifstream& fin)
+{
+  std::vector<std::vector<std::string> > events;
+  std::string line;
+
+  while (getline(fin, line)) {
+    if (!fin.good()) break;
+
+    if (line.find("Event") != std::string::npos) {
+      events.emplace_back();
+    } else if (!events.empty()) {
+      events.back().push_back(line);
+    }
+  }
+
+  return events;
+}
+
+template<class MemType>
+void writeMemFromEvent(MemType& memory, const std::vector<std::string>& lines, int ievt, int base=16)
+{
+  memory.clear();
+
+  for (const auto& line : lines) {
+    writeMemFromLine<MemType>(memory, line, ievt, base);
+  }
+}
+
+// Memory print in the binary format written by emData/convert_memprints.py.
+// The file is memory mapped and the events are written directly into the
+// memories, without any text parsing. All numbers are little endian:
+//   char     magic[8]            "MEMPRBIN"
+//   uint32_t nbits               width of the data words
+//   uint32_t nwords              number of 64-bit words per data word
+//   uint32_t binned              1 if each entry is preceded by its bin
+//   uint32_t nevents
+//   uint64_t offsets[nevents+1]  index of the first entry of each event
+// followed by the entries, each (binned + nwords) 64-bit words long with the
+// least significant data word first.
+class BinaryMemPrint {
+  public:
+    BinaryMemPrint(const std::string& fileName) :
+      data_(nullptr), size_(0), nbits_(0), nwords_(0), binned_(0), nevents_(0),
+      offsets_(nullptr), entries_(nullptr)
+    {
+      const int fd = open(fileName.c_str(), O_RDONLY);
+      struct stat st;
+      if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < kHeaderSize) {
+        std::cerr << "Open of file " << fileName << " failed with error: " << std::strerror(errno) << std::endl;
+        if (fd >= 0) close(fd);
+        return;
+      }
+      size_ = st.st_size;
+      void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (data == MAP_FAILED) {
+        std::cerr << "Mapping of file " << fileName << " failed with error: " << std::strerror(errno) << std::endl;
+        size_ = 0;
+        return;
+      }
+      data_ = static_cast<const char*>(data);
+
+      if (std::memcmp(data_, "MEMPRBIN", 8) != 0) {
+        std::cerr << fileName << " is not a binary memory print" << std::endl;
+        return;
+      }
+      std::memcpy(&nbits_, data_ + 8, 4);
+      std::memcpy(&nwords_, data_ + 12, 4);
+      std::memcpy(&binned_, data_ + 16, 4);
+      std::memcpy(&nevents_, data_ + 20, 4);
+      // The offset table must be in the file before its last offset, which is
+      // the number of entries, can be read
+      const uint64_t entriesStart = kHeaderSize + 8 * (uint64_t(nevents_) + 1);
+      if (entriesStart > size_) {
+        std::cerr << fileName << " is truncated" << std::endl;
+        return;
+      }
+      const uint64_t* offsets = reinterpret_cast<const uint64_t*>(data_ + kHeaderSize);
+      // A memory print whose events are all empty has no data words and no
+      // entries
+      const uint64_t entrySize = 8 * (uint64_t(binned_) + nwords_);
+      const bool empty = (offsets[nevents_] == 0 && size_ == entriesStart);
+      if (not empty && (entrySize == 0 || (size_ - entriesStart) % entrySize != 0 ||
+                        (size_ - entriesStart) / entrySize != offsets[nevents_])) {
+        std::cerr << fileName << " is truncated" << std::endl;
+        return;
+      }
+      if (offsets[0] != 0) {
+        std::cerr << fileName << " has a corrupted offset table" << std::endl;
+        return;
+      }
+      for (unsigned int ievt = 0; ievt < nevents_; ++ievt) {
+        if (offsets[ievt] > offsets[ievt + 1]) {
+          std::cerr << fileName << " has a corrupted offset table" << std::endl;
+          return;
+        }
+      }
+      offsets_ = offsets;
+      entries_ = offsets_ + nevents_ + 1;
+    }
+
+    ~BinaryMemPrint() {
+      if (data_) munmap(const_cast<char*>(data_), size_);
+    }
+
+    // The mapping is released once, by the owner
+    BinaryMemPrint(const BinaryMemPrint&) = delete;
+    BinaryMemPrint& operator=(const BinaryMemPrint&) = delete;
+
+    bool good() const {return offsets_ != nullptr;}
+    unsigned int nEvents() const {return nevents_;}
+    unsigned int nEntries(int ievt) const {return offsets_[ievt+1] - offsets_[ievt];}
+
+    // Clears the memory and writes the entries of event ievt to it
+    template<class MemType>
+    bool writeMem(MemType& memory, int ievt) const
+    {
+      constexpr int width = MemType::getWidth();
+      memory.clear();
+      if (!good() || ievt < 0 || ievt >= (int)nevents_) return false;
+      if (nEntries(ievt) == 0) return true;
+      if (nwords_ != (width + 63) / 64 || (int)nbits_ > width) {
+        std::cerr << "Binary memory print with " << nbits_ << "-bit words does not fit a memory of width " << width << std::endl;
+        return false;
+      }
+
+      const uint64_t* entry = entries_ + offsets_[ievt] * (binned_ + nwords_);
+      for (unsigned int i = 0; i < nEntries(ievt); ++i, entry += binned_ + nwords_) {
+        ap_uint<width> raw = 0;
+        for (unsigned int j = 0; j < nwords_; ++j) {
+          const int lsb = 64 * j;
+          const int msb = std::min(lsb + 63, width - 1);
+          raw.range(msb, lsb) = entry[binned_ + j];
+        }
+        writeMemEntry(memory, ievt, entry[0], raw, 0);
+      }
+      return true;
+    }
+
+  private:
+    static constexpr int kHeaderSize = 24;
+
+    const char* data_;
+    size_t size_;
+    uint32_t nbits_, nwords_, binned_, nevents_;
+    const uint64_t* offsets_;
+    const uint64_t* entries_;
+
+    // binned memories, which are the ones with getNBins()
+    template<class MemType, class RawType>
+    static auto writeMemEntry(MemType& memory, int ievt, uint64_t bin, const RawType& raw, int)
+      -> decltype(memory.getNBins(), bool())
+    {
+      typedef decltype(memory.read_mem(0,0,0)) DataType;
+      return memory.write_mem(ievt, bin, DataType(raw));
+    }
+
+    template<class MemType, class RawType>
+    static bool writeMemEntry(MemType& memory, int ievt, uint64_t, const RawType& raw, long)
+    {
+      typedef decltype(memory.read_mem(0,0)) DataType;
+      return memory.write_mem(ievt, DataType(raw));
+    }
+};
+
 template<class MemType, int InputBase=16, int OutputBase=16, int LSB=-1, int MSB=-1>
 unsigned int compareMemWithFile(const MemType& memory, std::ifstream& fout,
                                 int ievt, const std::string& label,
@@ -296,6 +484,84 @@ unsigned int compareBinnedMemCMWithFile(const MemType& memory,
 
 }
 
+// Byte offsets of the events in a memory print file, so that any event can be
+// read directly instead of scanning through all the previous ones. The index
+// is cached on disk next to the file (as <file name>.idx) and rebuilt when the
+// size or modification time of the file changes.
+class EventIndex {
+  public:
+    EventIndex(const std::string &fileName) : fileName_(fileName) {
+      struct stat st;
+      if (stat(fileName_.c_str(), &st) != 0) return;
+      size_ = st.st_size;
+      mtime_ = st.st_mtime;
+      if (!readCache()) {
+        build();
+        writeCache();
+      }
+    }
+
+    unsigned nEvents() const {return offsets_.size();}
+
+    // Positions the stream such that the next call to writeMemFromFile (or
+    // compareMemWithFile) with the same ievt reads event ievt
+    bool seek(std::ifstream &fin, int ievt) const {
+      if (ievt < 0 || ievt >= (int)offsets_.size()) return false;
+      fin.clear();
+      // writeMemFromFile skips the header line itself for the first event
+      fin.seekg(ievt == 0 ? std::streamoff(0) : offsets_.at(ievt));
+      return fin.good();
+    }
+
+  private:
+    std::string fileName_;
+    long long size_ = -1;
+    long long mtime_ = -1;
+    std::vector<std::streamoff> offsets_; // start of the data of each event
+
+    std::string cacheName() const {return fileName_ + ".idx";}
+
+    void build() {
+      std::ifstream fin(fileName_);
+      std::string line;
+      while (getline(fin, line)) {
+        if (line.find("Event") != std::string::npos)
+          offsets_.push_back(fin.tellg());
+      }
+    }
+
+    bool readCache() {
+      std::ifstream fin(cacheName());
+      long long size, mtime;
+      unsigned n;
+      if (!(fin >> size >> mtime >> n) || size != size_ || mtime != mtime_) return false;
+      offsets_.resize(n);
+      for (auto &offset : offsets_) {
+        long long value;
+        if (!(fin >> value)) {
+          offsets_.clear();
+          return false;
+        }
+        offset = value;
+      }
+      return true;
+    }
+
+    // Written to a temporary file first, so that several processes sharing
+    // the same memory prints never see a partially written index
+    void writeCache() const {
+      const std::string tmpName = cacheName() + "." + std::to_string(getpid());
+      std::ofstream fout(tmpName);
+      if (!fout) return;
+      fout << size_ << " " << mtime_ << " " << offsets_.size() << std::endl;
+      for (const auto &offset : offsets_)
+        fout << (long long)offset << std::endl;
+      fout.close();
+      if (!fout || rename(tmpName.c_str(), cacheName().c_str()) != 0)
+        unlink(tmpName.c_str());
+    }
+};
+
 // Class designed to help organize test-bench input and output files. The
 // member methods each take in a string that can contain glob-style wildcards,
 // e.g.:
@@ -334,10 +600,38 @@ class TBHelper {
       return fileNames_.at(query);
     }
 
+    // returns number of events in the first file matching given string
+    unsigned nEvents(const std::string &query) {
+      processQuery(query);
+      const auto &names = fileNames_.at(query);
+      return names.empty() ? 0 : index(names.front()).nEvents();
+    }
+
+    // positions the input streams of all files matching given string such
+    // that event ievt is the next one to be read, so that the events can be
+    // processed in any order (or split among several processes)
+    bool seekEvent(const std::string &query, int ievt) {
+      processQuery(query);
+      bool success = true;
+      const auto &names = fileNames_.at(query);
+      auto &files = files_.at(query);
+      for (unsigned i = 0; i < names.size(); i++)
+        success &= index(names.at(i)).seek(files.at(i), ievt);
+      return success;
+    }
+
   private:
     std::string baseDir_;
     std::map<std::string, std::vector<std::ifstream> > files_;
     std::map<std::string, std::vector<std::string> > fileNames_;
+    std::map<std::string, EventIndex> indices_;
+
+    const EventIndex &index(const std::string &fileName) {
+      auto it = indices_.find(fileName);
+      if (it == indices_.end())
+        it = indices_.emplace(fileName, EventIndex(fileName)).first;
+      return it->second;
+    }
 
     // private method for processing the given string using glob
     void processQuery(const std::string &query) {
@@ -347,8 +641,13 @@ class TBHelper {
         glob_t globbuf;
         globbuf.gl_offs = 0;
         glob((baseDir_ + "/" + query).c_str(), 0, nullptr, &globbuf);
-        for (unsigned i = 0; i < globbuf.gl_pathc; i++)
-          fileNames.emplace_back(globbuf.gl_pathv[i]);
+        // only the memory prints themselves, not e.g. the .idx files of
+        // EventIndex or the .bin files of convert_memprints.py
+        const std::regex memPrint(".*\\.dat$");
+        for (unsigned i = 0; i < globbuf.gl_pathc; i++) {
+          if (std::regex_match(globbuf.gl_pathv[i], memPrint))
+            fileNames.emplace_back(globbuf.gl_pathv[i]);
+        }
 
         // function for padding single-digit numbers in the file name with a
         // leading zero
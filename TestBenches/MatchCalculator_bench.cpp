@@ -0,0 +1,47 @@
+// Throughput benchmark of the MatchCalculator (L3PHIC), see Benchmark.h
+#include "MatchCalculatorTop.h"
+
+#include "Benchmark.h"
+#include "Constants.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("MatchCalculator_L3PHIC", argc, argv);
+
+  // input memories
+  static CandidateMatchMemory           match[maxMatchCopies];
+  static AllStubMemory<BARRELPS>        allstub;
+  static AllProjectionMemory<BARRELPS>  allproj;
+
+  // output memories
+  static FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies];
+
+  auto fin_as = bench.readEvents("MC/MC_L3PHIC/AllStubs_AS_L3PHICn1_04.dat");
+  auto fin_ap = bench.readEvents("MC/MC_L3PHIC/AllProj_AP_L3PHIC_04.dat");
+  ModuleBenchmark::EventLines fin_cm[8];
+  for (unsigned int i = 0; i < 8; i++)
+    fin_cm[i] = bench.readEvents("MC/MC_L3PHIC/CandidateMatches_CM_L3PHIC" + to_string(17 + i) + "_04.dat");
+
+  BXType bx_out;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      fullmatch[0].clear();
+      fullmatch[3].clear();
+      writeMemFromEvent(allstub, fin_as[ievt], ievt);
+      writeMemFromEvent(allproj, fin_ap[ievt], ievt);
+      for (unsigned int i = 0; i < 8; i++) {
+        writeMemFromEvent(match[i], fin_cm[i][ievt], ievt);
+        ninputs += fin_cm[i][ievt].size();
+      }
+      return ninputs;
+    },
+    [&](int ievt) {
+      MatchCalculatorTop(ievt, match, &allstub, &allproj, bx_out, fullmatch);
+    });
+
+  return bench.report();
+}
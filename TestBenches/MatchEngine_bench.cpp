@@ -0,0 +1,45 @@
+// Throughput benchmark of the MatchEngine, see Benchmark.h
+#include "MatchEngine.h"
+
+#include "Benchmark.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+#if LAYER == 1
+  const string me = "L1PHIE20";
+#elif LAYER == 3
+  const string me = "L3PHIC20";
+#elif LAYER == 4
+  const string me = "L4PHIB12";
+#else
+  #error "No test vectors for this layer"
+#endif
+  ModuleBenchmark bench("MatchEngine_" + me, argc, argv);
+
+  // input memories
+  static VMProjectionMemory<PROJECTIONTYPE> inputvmprojs;
+  static VMStubMEMemory<MODULETYPE, NBITBIN> inputvmstubs;
+
+  // output memories
+  static CandidateMatchMemory outputcandmatches;
+
+  auto fin_vmproj = bench.readEvents("ME/ME_" + me + "/VMProjections_VMPROJ_" + me + "_04.dat");
+  auto fin_vmstub = bench.readEvents("ME/ME_" + me + "/VMStubs_VMSME_" + me + "n1_04.dat");
+
+  BXType bx_out;
+
+  bench.run(
+    [&](int ievt) {
+      outputcandmatches.clear();
+      writeMemFromEvent(inputvmprojs, fin_vmproj[ievt], ievt);
+      writeMemFromEvent(inputvmstubs, fin_vmstub[ievt], ievt);
+      return fin_vmproj[ievt].size();
+    },
+    [&](int ievt) {
+      MatchEngineTop(ievt&0x7, bx_out, inputvmstubs, inputvmprojs, outputcandmatches);
+    });
+
+  return bench.report();
+}
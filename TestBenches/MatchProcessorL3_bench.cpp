@@ -0,0 +1,55 @@
+// Throughput benchmark of the MatchProcessor (L3PHIC), see Benchmark.h. With
+// -DCSIM_UNCACHED_LUTS (MP_L3PHIC_uncached_bench) the LUTs of
+// MatchProcessor_parameters.h are rebuilt on every call, as before they were
+// cached.
+#include "MatchProcessorTopL3.h"
+
+#include "Benchmark.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+#ifdef CSIM_UNCACHED_LUTS
+  ModuleBenchmark bench("MatchProcessor_L3PHIC_uncached", argc, argv);
+#else
+  ModuleBenchmark bench("MatchProcessor_L3PHIC", argc, argv);
+#endif
+
+  // input memories
+  static TrackletProjectionMemory<BARRELPS> tproj[maxTrackletProjections];
+  static AllStubMemory<BARRELPS> allstub;
+  static VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEnginesL3> inputvmstubs;
+
+  // output memories
+  static FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies];
+
+  const string tprojNames[maxTrackletProjections] = {"L1L2E", "L1L2F", "L1L2G", "L1L2H", "L1L2I",
+                                                     "L1L2J", "L1L2K", "L5L6B", "L5L6C", "L5L6D"};
+  ModuleBenchmark::EventLines fin_tproj[maxTrackletProjections];
+  for (int i = 0; i < maxTrackletProjections; i++)
+    fin_tproj[i] = bench.readEvents("MP_L3PHIC/TrackletProjections_TPROJ_" + tprojNames[i] + "_L3PHIC_04.dat");
+  auto fin_vmstub = bench.readEvents("MP_L3PHIC/VMStubs_VMSME_L3PHICn1_04.dat");
+  auto fin_as = bench.readEvents("MP_L3PHIC/AllStubs_AS_L3PHICn1_04.dat");
+
+  BXType bx_out;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      fullmatch[0].clear();
+      fullmatch[3].clear();
+      for (int i = 0; i < maxTrackletProjections; i++) {
+        writeMemFromEvent(tproj[i], fin_tproj[i][ievt], ievt);
+        ninputs += fin_tproj[i][ievt].size();
+      }
+      writeMemFromEvent(allstub, fin_as[ievt], ievt);
+      writeMemFromEvent(inputvmstubs, fin_vmstub[ievt], ievt);
+      return ninputs;
+    },
+    [&](int ievt) {
+      MatchProcessorTopL3(ievt, tproj, inputvmstubs, &allstub, bx_out, fullmatch);
+    });
+
+  return bench.report();
+}
@@ -0,0 +1,172 @@
+// Study of the number of match engine units of the MatchProcessor (L3PHIC)
+//
+// Runs MatchProcessorL3 with 1 to 8 match engine units over the events of the
+// MatchProcessorL3 test bench and reports, for each number of units:
+//   * the full matches found, missing and extra compared with the emulation,
+//   * the events with missing matches, i.e. truncated by the MatchProcessor,
+//   * a rough estimate, labelled as unvalidated in the output, of the
+//     resources that depend on the number of units: the BRAMs of the VMStubME
+//     memory copies (one per unit), the bits of the bend-rinv tables (one per
+//     unit) and the track ID comparators that pick the unit with the smallest
+//     track ID (one per pair of units).
+// Run from the MP directory of emData:
+//   MatchProcessorL3_study [number of events]
+// The loops can be studied further with LOOP_STATISTICS=<file>.csv, in which
+// MatchProcessor::PROC_LOOP has one line per event and number of units.
+#include "MatchProcessorTopL3.h"
+#include "FileReadUtility.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+typedef vector<vector<string> > EventLines;
+
+// Emulation events, read once for all the numbers of units
+struct Events {
+  EventLines tproj[maxTrackletProjections];
+  EventLines vmstub;
+  EventLines allstub;
+  EventLines fm[2];     // L1L2 and L5L6 seeds
+  unsigned int nevents;
+};
+
+// Full matches of the two seeds of the emulation in fullmatch[0] and [3]
+const int kFMCopies[2] = {0, 3};
+
+struct StudyResult {
+  unsigned int nunits;
+  unsigned long found = 0, missing = 0, extra = 0;
+  unsigned int truncated = 0;
+  unsigned int memoryBRAM18 = 0;
+  unsigned int tableBits = 0;
+  unsigned int comparators = 0;
+};
+
+// Raw full matches of a memory, sorted
+template<class MemType>
+vector<unsigned long long> sortedEntries(const MemType& memory, BXType bx)
+{
+  vector<unsigned long long> entries;
+  for (unsigned int i = 0; i < memory.getEntries(bx); ++i)
+    entries.push_back(memory.read_mem(bx, i).raw().to_uint64());
+  sort(entries.begin(), entries.end());
+  return entries;
+}
+
+template<unsigned int NMatchEngines>
+StudyResult study(const Events& events)
+{
+  typedef VMStubMEMemoryCM<BARRELPS, 3, 3, NMatchEngines> VMStubMemory;
+
+  static TrackletProjectionMemory<BARRELPS> tproj[maxTrackletProjections];
+  static AllStubMemory<BARRELPS> allstub;
+  static VMStubMemory vmstub;
+  static FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies];
+  static FullMatchMemory<BARREL> fullmatchRef;
+
+  StudyResult result;
+  result.nunits = NMatchEngines;
+
+  for (unsigned int ievt = 0; ievt < events.nevents; ++ievt) {
+    for (int i = 0; i < maxTrackletProjections; ++i)
+      writeMemFromEvent(tproj[i], events.tproj[i][ievt], ievt);
+    writeMemFromEvent(allstub, events.allstub[ievt], ievt);
+    writeMemFromEvent(vmstub, events.vmstub[ievt], ievt);
+    for (auto& fm : fullmatch) fm.clear();
+
+    BXType bx = ievt;
+    BXType bx_out;
+    MatchProcessorL3<NMatchEngines>(bx, tproj, vmstub, &allstub, bx_out, fullmatch);
+
+    bool truncated = false;
+    for (unsigned int iseed = 0; iseed < 2; ++iseed) {
+      writeMemFromEvent(fullmatchRef, events.fm[iseed][ievt], ievt);
+      const auto ref = sortedEntries(fullmatchRef, bx);
+      const auto com = sortedEntries(fullmatch[kFMCopies[iseed]], bx_out);
+      vector<unsigned long long> common;
+      set_intersection(ref.begin(), ref.end(), com.begin(), com.end(), back_inserter(common));
+      result.found += common.size();
+      result.missing += ref.size() - common.size();
+      result.extra += com.size() - common.size();
+      truncated |= (common.size() < ref.size());
+    }
+    result.truncated += truncated;
+  }
+
+  // One copy of the VMStubME memory per unit, in 18 kb BRAMs of at most
+  // 36 bits x 512 words
+  const unsigned int width = VMStubMemory::getWidth();
+  const unsigned int words = vmstub.getNBX() * vmstub.getDepth();
+  const unsigned int bramWidth = (width <= 9) ? 9 : (width <= 18) ? 18 : 36;
+  const unsigned int bramDepth = 18 * 1024 / bramWidth;
+  result.memoryBRAM18 = NMatchEngines * ((words + bramDepth - 1) / bramDepth) * ((width + bramWidth - 1) / bramWidth);
+
+  const MatchProcessorContext<TF::L3, NMatchEngines>* context = nullptr;
+  typedef typename std::remove_reference<decltype(context->table[0][0])>::type TableEntry;
+  result.tableBits = sizeof(context->table) / sizeof(context->table[0][0]) * TableEntry::width;
+
+  result.comparators = NMatchEngines * (NMatchEngines - 1) / 2;
+
+  return result;
+}
+
+int main(int argc, char* argv[])
+{
+  const string tprojNames[maxTrackletProjections] = {"L1L2E", "L1L2F", "L1L2G", "L1L2H", "L1L2I",
+                                                     "L1L2J", "L1L2K", "L5L6B", "L5L6C", "L5L6D"};
+
+  // read the events of all the files
+  cout << "Open files..." << endl;
+  Events events;
+  ifstream fin;
+  for (int i = 0; i < maxTrackletProjections; i++) {
+    if (not openDataFile(fin, "MP_L3PHIC/TrackletProjections_TPROJ_" + tprojNames[i] + "_L3PHIC_04.dat")) return -1;
+    events.tproj[i] = readEventsFromFile(fin);
+    fin.close();
+  }
+  if (not openDataFile(fin, "MP_L3PHIC/VMStubs_VMSME_L3PHICn1_04.dat")) return -1;
+  events.vmstub = readEventsFromFile(fin);
+  fin.close();
+  if (not openDataFile(fin, "MP_L3PHIC/AllStubs_AS_L3PHICn1_04.dat")) return -1;
+  events.allstub = readEventsFromFile(fin);
+  fin.close();
+  if (not openDataFile(fin, "MP_L3PHIC/FullMatches_FM_L1L2_L3PHIC_04.dat")) return -1;
+  events.fm[0] = readEventsFromFile(fin);
+  fin.close();
+  if (not openDataFile(fin, "MP_L3PHIC/FullMatches_FM_L5L6_L3PHIC_04.dat")) return -1;
+  events.fm[1] = readEventsFromFile(fin);
+  fin.close();
+
+  size_t nevents = events.vmstub.size();
+  for (const auto& tproj : events.tproj) nevents = min(nevents, tproj.size());
+  nevents = min(nevents, events.allstub.size());
+  nevents = min(nevents, min(events.fm[0].size(), events.fm[1].size()));
+  if (argc > 1) nevents = min(nevents, size_t(atoi(argv[1])));
+  events.nevents = nevents;
+
+  cout << "Run " << nevents << " events..." << endl;
+  const StudyResult results[] = {
+    study<1>(events), study<2>(events), study<3>(events), study<4>(events),
+    study<5>(events), study<6>(events), study<7>(events), study<8>(events)
+  };
+
+  cout << endl << "Units   Found  Missing  Extra  Truncated events  VMStubME BRAM18*  Bend table bits*  TrkID comparators*" << endl;
+  for (const auto& r : results) {
+    cout << setw(5) << r.nunits << setw(8) << r.found << setw(9) << r.missing << setw(7) << r.extra
+         << setw(18) << r.truncated << setw(18) << r.memoryBRAM18 << setw(18) << r.tableBits
+         << setw(20) << r.comparators
+         << ((r.nunits == kNMatchEnginesL3) ? "  <- MatchProcessorTopL3" : "") << endl;
+  }
+  cout << "* Unvalidated estimates: counts of the memory words, table entries and unit" << endl
+       << "  pairs, not synthesis results. The study has not been checked against the" << endl
+       << "  emulation events of emData." << endl;
+
+  return 0;
+}
@@ -27,7 +27,7 @@ int main() {
   static TrackletProjectionMemory<BARRELPS> tproj[maxTrackletProjections];
   static AllStubMemory<BARRELPS>        allstub;
 
-  VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEngines> inputvmstubs;
+  VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEnginesL3> inputvmstubs;
 
   // declare output memory array to be filled by hls simulation
   static FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies];
@@ -89,7 +89,7 @@ int main() {
       writeMemFromFile<TrackletProjectionMemory<BARRELPS> >(tproj[i], fin_tproj[i], ievt);
     writeMemFromFile<AllStubMemory<BARRELPS> >(allstub, fin_as, ievt);
 
-    writeMemFromFile<VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEngines> >(inputvmstubs, fin_vmstub, ievt);
+    writeMemFromFile<VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEnginesL3> >(inputvmstubs, fin_vmstub, ievt);
 
     //set bunch crossing
     BXType bx=ievt;
@@ -0,0 +1,126 @@
+// Test bench for the native memory words
+//
+// Checks that getBits, setBits, toMemoryWord and fromMemoryWord on the native
+// words of the C simulation (TrackletAlgorithm/MemoryWord.h) give the same
+// results as range() on an ap_uint, for words of 1, 32, 63, 64, 70 and 128
+// bits and fields at both ends and in the middle of the words. The values
+// written are of the width of the field, wider, signed (also negative and
+// narrower than the field, which are sign extended) and plain integers:
+//   MemoryWord_test [number of random words per field]
+#ifndef CSIM_NATIVE_MEMORY_WORDS
+#define CSIM_NATIVE_MEMORY_WORDS
+#endif
+#include "MemoryWord.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+using namespace std;
+
+static_assert(std::is_same<MemoryWord<64>::type, uint64_t>::value, "The memory words are not native");
+
+template<int W>
+ap_uint<W> randomWord(mt19937_64& rng)
+{
+  ap_uint<W> word = 0;
+  for (int lsb = 0; lsb < W; lsb += 64) {
+    const int msb = (lsb + 63 < W) ? lsb + 63 : W - 1;
+    word.range(msb, lsb) = ap_uint<64>(rng()).range(msb - lsb, 0);
+  }
+  return word;
+}
+
+// Random negative value of W bits
+template<int W>
+ap_int<W> negative(mt19937_64& rng)
+{
+  ap_uint<W> word = randomWord<W>(rng);
+  word[W - 1] = 1;
+  return ap_int<W>(word);
+}
+
+// Writes value to the field of a copy of word, with range() and with setBits
+template<int W, int MSB, int LSB, class T>
+int checkSetBits(const ap_uint<W>& word, const T& value)
+{
+  ap_uint<W> expected = word;
+  expected.range(MSB, LSB) = value;
+
+  typename MemoryWord<W>::type native = toMemoryWord<W>(word);
+  setBits<MSB, LSB>(native, value);
+  return fromMemoryWord<W>(native) != expected;
+}
+
+template<int W, int MSB, int LSB>
+int checkField(mt19937_64& rng, int nwords)
+{
+  static_assert(MSB < W && LSB <= MSB, "The field is not in the word");
+  constexpr int kWidth = MSB - LSB + 1;
+  // Signed values narrower than the field, which are sign extended
+  constexpr int kNarrowWidth = (kWidth > 1) ? kWidth - 1 : 1;
+
+  int nerrors = 0;
+  for (int i = 0; i < nwords; ++i) {
+    const ap_uint<W> word = randomWord<W>(rng);
+    const typename MemoryWord<W>::type native = toMemoryWord<W>(word);
+
+    nerrors += (fromMemoryWord<W>(native) != word);
+    nerrors += (getBits<MSB, LSB>(native) != ap_uint<kWidth>(word.range(MSB, LSB)));
+
+    nerrors += checkSetBits<W, MSB, LSB>(word, randomWord<kWidth>(rng));
+    nerrors += checkSetBits<W, MSB, LSB>(word, randomWord<kWidth + 8>(rng));
+    nerrors += checkSetBits<W, MSB, LSB>(word, ap_int<kWidth>(randomWord<kWidth>(rng)));
+    nerrors += checkSetBits<W, MSB, LSB>(word, negative<kNarrowWidth>(rng));
+    nerrors += checkSetBits<W, MSB, LSB>(word, -int(rng() % 1000) - 1);
+    nerrors += checkSetBits<W, MSB, LSB>(word, static_cast<unsigned int>(rng()));
+    nerrors += checkSetBits<W, MSB, LSB>(word, static_cast<uint64_t>(rng()));
+  }
+
+  if (nerrors > 0)
+    cout << "Word of " << W << " bits, field [" << MSB << ":" << LSB << "]: " << nerrors << " errors" << endl;
+  return nerrors;
+}
+
+int main(int argc, char *argv[])
+{
+  const int nwords = (argc > 1) ? atoi(argv[1]) : 10000;
+  mt19937_64 rng(12345);
+
+  int nerrors = 0;
+  nerrors += checkField<1, 0, 0>(rng, nwords);
+
+  nerrors += checkField<32, 0, 0>(rng, nwords);
+  nerrors += checkField<32, 31, 31>(rng, nwords);
+  nerrors += checkField<32, 31, 0>(rng, nwords);
+  nerrors += checkField<32, 20, 5>(rng, nwords);
+
+  nerrors += checkField<63, 0, 0>(rng, nwords);
+  nerrors += checkField<63, 62, 62>(rng, nwords);
+  nerrors += checkField<63, 62, 0>(rng, nwords);
+  nerrors += checkField<63, 62, 31>(rng, nwords);
+  nerrors += checkField<63, 40, 3>(rng, nwords);
+
+  nerrors += checkField<64, 0, 0>(rng, nwords);
+  nerrors += checkField<64, 63, 63>(rng, nwords);
+  nerrors += checkField<64, 63, 0>(rng, nwords);
+  nerrors += checkField<64, 63, 32>(rng, nwords);
+  nerrors += checkField<64, 40, 3>(rng, nwords);
+
+  nerrors += checkField<70, 0, 0>(rng, nwords);
+  nerrors += checkField<70, 69, 69>(rng, nwords);
+  nerrors += checkField<70, 69, 0>(rng, nwords);
+  nerrors += checkField<70, 63, 0>(rng, nwords);
+  nerrors += checkField<70, 69, 64>(rng, nwords);
+  nerrors += checkField<70, 66, 60>(rng, nwords);
+
+  nerrors += checkField<128, 0, 0>(rng, nwords);
+  nerrors += checkField<128, 127, 127>(rng, nwords);
+  nerrors += checkField<128, 127, 0>(rng, nwords);
+  nerrors += checkField<128, 127, 64>(rng, nwords);
+  nerrors += checkField<128, 64, 64>(rng, nwords);
+  nerrors += checkField<128, 100, 30>(rng, nwords);
+
+  cout << nerrors << " errors" << endl;
+  return nerrors > 0;
+}
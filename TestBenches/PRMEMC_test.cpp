@@ -0,0 +1,187 @@
+// Test bench for the PR -> ME -> MC chain of L3PHIC, i.e. the C simulation
+// counterpart of IntegrationTests/PRMEMC. The top functions are linked in
+// memory, so only the TrackletProjections and VMStubsME entering the chain and
+// the AllStubs used by the MatchCalculator are read from file; the outputs of
+// every step are compared with the emulation. Events are processed
+// concurrently, one chain of memories per thread.
+//
+// Usage: PRMEMC_test [number of threads]
+#include "ProjectionRouterTop.h"
+#include "MatchCalculatorTop.h"
+#include "MatchEngine.h"
+
+#include "FileReadUtility.h"
+#include "Constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+const int nevents = 100;  // number of events to run
+const bool truncation = false; // compare results to truncated emulation
+
+constexpr unsigned int nTProj = 8; // TrackletProjection inputs of the PR
+constexpr unsigned int nVM = 8; // VMs in L3PHIC, one ME each
+
+using namespace std;
+
+// The emulation memory prints for one file, split by event
+typedef vector<vector<string> > EventLines;
+
+// Memories of one instance of the chain
+struct PRMEMCMemories {
+  TrackletProjectionMemory<BARRELPS> tproj[nTProj];
+  AllProjectionMemory<BARRELPS> allproj;
+  VMProjectionMemory<BARREL> vmproj[nVM];
+  VMStubMEMemory<MODULETYPE, NBITBIN> vmstubs[nVM];
+  CandidateMatchMemory match[maxMatchCopies];
+  AllStubMemory<BARRELPS> allstub;
+  FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies];
+};
+
+// Counts the entries of the memory that differ from the emulation. Nothing is
+// printed so that several threads can compare at the same time.
+template<class MemType>
+unsigned int countErrors(const MemType& memory, const vector<string>& lines, BXType bx)
+{
+  unique_ptr<MemType> memory_ref(new MemType());
+  writeMemFromEvent<MemType>(*memory_ref, lines, bx);
+
+  unsigned int err_count = 0;
+  for (int i = 0; i < memory_ref->getDepth(); ++i) {
+    auto data_ref = memory_ref->read_mem(bx,i).raw();
+    auto data_com = memory.read_mem(bx,i).raw();
+    if (data_com == 0 && data_ref == 0) continue;
+    if (data_com == 0 && truncation) continue;
+    if (data_com != data_ref) err_count++;
+  }
+  return err_count;
+}
+
+EventLines readFile(const string& file_name, bool& valid)
+{
+  ifstream fin;
+  if (not openDataFile(fin, file_name)) {
+    valid = false;
+    return EventLines();
+  }
+  auto events = readEventsFromFile(fin);
+  if (events.size() < nevents) {
+    cerr << file_name << " contains only " << events.size() << " events" << endl;
+    valid = false;
+  }
+  return events;
+}
+
+int main(int argc, char* argv[])
+{
+  unsigned int nthreads = (argc > 1) ? atoi(argv[1]) : thread::hardware_concurrency();
+  if (nthreads == 0) nthreads = 1;
+
+  ///////////////////////////
+  // read all input and reference files
+  cout << "Read files..." << endl;
+  bool valid = true;
+
+  const string tprojNames[nTProj] = {"L1L2F", "L1L2G", "L1L2H", "L1L2I", "L1L2J", "L5L6B", "L5L6C", "L5L6D"};
+  EventLines fin_tproj[nTProj];
+  for (unsigned int i = 0; i < nTProj; i++)
+    fin_tproj[i] = readFile("PR/PR_L3PHIC/TrackletProjections_TPROJ_" + tprojNames[i] + "_L3PHIC_04.dat", valid);
+
+  EventLines fin_vmstubs[nVM], fout_vmproj[nVM], fout_match[nVM];
+  for (unsigned int i = 0; i < nVM; i++) {
+    const string vm = "L3PHIC" + to_string(17 + i);
+    fin_vmstubs[i] = readFile("MemPrints/VMStubsME/VMStubs_VMSME_" + vm + "n1_04.dat", valid);
+    fout_vmproj[i] = readFile("PR/PR_L3PHIC/VMProjections_VMPROJ_" + vm + "_04.dat", valid);
+    fout_match[i] = readFile("MC/MC_L3PHIC/CandidateMatches_CM_" + vm + "_04.dat", valid);
+  }
+
+  EventLines fin_allstub = readFile("MC/MC_L3PHIC/AllStubs_AS_L3PHICn1_04.dat", valid);
+  EventLines fout_allproj = readFile("PR/PR_L3PHIC/AllProj_AP_L3PHIC_04.dat", valid);
+
+  // only the L1L2 and L5L6 seeds project to L3PHIC
+  const unsigned int fmIndices[] = {0, 3};
+  EventLines fout_fullmatch[maxFullMatchCopies];
+  fout_fullmatch[0] = readFile("MC/MC_L3PHIC/FullMatches_FM_L1L2_L3PHIC_04.dat", valid);
+  fout_fullmatch[3] = readFile("MC/MC_L3PHIC/FullMatches_FM_L5L6_L3PHIC_04.dat", valid);
+
+  if (not valid) return -1;
+
+  ///////////////////////////
+  // process the events on a pool of threads, each with its own memories
+  cout << "Start event loop on " << nthreads << " threads ..." << endl;
+
+  unsigned int errPR[nevents] = {0}, errME[nevents] = {0}, errMC[nevents] = {0};
+  atomic<int> nextEvent(0);
+
+  auto processEvents = [&]() {
+    unique_ptr<PRMEMCMemories> mem(new PRMEMCMemories());
+
+    for (int ievt = nextEvent++; ievt < nevents; ievt = nextEvent++) {
+      BXType bx = ievt;
+      BXType bx_out;
+
+      // read event and write to input memories
+      for (unsigned int i = 0; i < nTProj; i++)
+        writeMemFromEvent(mem->tproj[i], fin_tproj[i][ievt], ievt);
+      for (unsigned int i = 0; i < nVM; i++)
+        writeMemFromEvent(mem->vmstubs[i], fin_vmstubs[i][ievt], ievt);
+      writeMemFromEvent(mem->allstub, fin_allstub[ievt], ievt);
+
+      // clear output memories
+      mem->allproj.clear();
+      for (unsigned int i = 0; i < nVM; i++) {
+        mem->vmproj[i].clear();
+        mem->match[i].clear();
+      }
+      for (auto i : fmIndices) mem->fullmatch[i].clear();
+
+      // ProjectionRouter
+      ProjectionRouterTop(bx, mem->tproj, bx_out, mem->allproj, mem->vmproj);
+      errPR[ievt] += countErrors(mem->allproj, fout_allproj[ievt], bx_out);
+      for (unsigned int i = 0; i < nVM; i++)
+        errPR[ievt] += countErrors(mem->vmproj[i], fout_vmproj[i][ievt], bx_out);
+
+      // MatchEngines
+      BXType bx_me = bx_out;
+      for (unsigned int i = 0; i < nVM; i++) {
+        MatchEngineTop(bx_me, bx_out, mem->vmstubs[i], mem->vmproj[i], mem->match[i]);
+        errME[ievt] += countErrors(mem->match[i], fout_match[i][ievt], bx_out);
+      }
+
+      // MatchCalculator
+      BXType bx_mc = bx_out;
+      MatchCalculatorTop(bx_mc, mem->match, &mem->allstub, &mem->allproj, bx_out, mem->fullmatch);
+      for (auto i : fmIndices)
+        errMC[ievt] += countErrors(mem->fullmatch[i], fout_fullmatch[i][ievt], bx_out);
+    }
+  };
+
+  const auto start = chrono::steady_clock::now();
+  vector<thread> threads;
+  for (unsigned int i = 0; i < nthreads; i++)
+    threads.emplace_back(processEvents);
+  for (auto& t : threads)
+    t.join();
+  const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+  ///////////////////////////
+  // summary
+  int err = 0;
+  for (unsigned int ievt = 0; ievt < nevents; ++ievt) {
+    if (errPR[ievt] || errME[ievt] || errMC[ievt]) {
+      cout << "Event: " << dec << ievt << "\tPR errors: " << errPR[ievt]
+           << "\tME errors: " << errME[ievt] << "\tMC errors: " << errMC[ievt] << endl;
+    }
+    err += errPR[ievt] + errME[ievt] + errMC[ievt];
+  }
+  cout << "Processed " << nevents << " events in " << elapsed.count() << " s ("
+       << nevents / elapsed.count() << " events/s)" << endl;
+
+  // This is necessary because HLS seems to only return an 8-bit error count, so if err%256==0, the test bench can falsely pass
+  if (err > 255) err = 255;
+  return err;
+}
@@ -0,0 +1,44 @@
+// Throughput benchmark of the ProjectionRouter (L3PHIC), see Benchmark.h
+#include "ProjectionRouterTop.h"
+
+#include "Benchmark.h"
+#include "Constants.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("ProjectionRouter_L3PHIC", argc, argv);
+
+  // input memories
+  static TrackletProjectionMemory<BARRELPS> tprojarray[8];
+
+  // output memories
+  static AllProjectionMemory<BARRELPS> allproj;
+  static VMProjectionMemory<BARREL> vmprojarray[8];
+
+  const string tprojNames[8] = {"L1L2F", "L1L2G", "L1L2H", "L1L2I", "L1L2J", "L5L6B", "L5L6C", "L5L6D"};
+  ModuleBenchmark::EventLines fin_tproj[8];
+  for (unsigned int i = 0; i < 8; i++)
+    fin_tproj[i] = bench.readEvents("PR_L3PHIC/TrackletProjections_TPROJ_" + tprojNames[i] + "_L3PHIC_04.dat");
+
+  BXType bx_out;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      for (unsigned int i = 0; i < 8; i++) {
+        writeMemFromEvent(tprojarray[i], fin_tproj[i][ievt], ievt);
+        ninputs += fin_tproj[i][ievt].size();
+      }
+      allproj.clear();
+      for (unsigned int i = 0; i < 8; i++)
+        vmprojarray[i].clear();
+      return ninputs;
+    },
+    [&](int ievt) {
+      ProjectionRouterTop(ievt, tprojarray, bx_out, allproj, vmprojarray);
+    });
+
+  return bench.report();
+}
@@ -24,6 +24,11 @@ int main()
   static AllProjectionMemory<BARRELPS> allproj;
   static VMProjectionMemory<BARREL> vmprojarray[8];
 
+  // occupancy of the output memories, written to $MEMORY_STATISTICS
+  allproj.collectStatistics("AP_L3PHIC");
+  for (unsigned int imem = 0; imem < 8; imem++)
+    vmprojarray[imem].collectStatistics("VMPROJ_L3PHIC" + to_string(17 + imem));
+
   ///////////////////////////
   // open input files
   cout << "Open files..." << endl;
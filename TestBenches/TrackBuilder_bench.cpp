@@ -0,0 +1,61 @@
+// Throughput benchmark of the TrackBuilder (L1L2), see Benchmark.h
+#include "TrackBuilderTop.h"
+
+#include "Benchmark.h"
+#include "Constants.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("TrackBuilder_L1L2", argc, argv);
+
+  // input memories
+  static TrackletParameterMemory trackletParameters[12];
+  static FullMatchMemory<BARREL> barrelFullMatches[16];
+  static FullMatchMemory<DISK> diskFullMatches[16];
+
+  // output memories
+  static TrackFit::TrackWord trackWord[kMaxProc];
+  static TrackFit::BarrelStubWord barrelStubWords[4][kMaxProc];
+  static TrackFit::DiskStubWord diskStubWords[4][kMaxProc];
+
+  const string dir = "FT_L1L2";
+  const string phiRegions = "ABCD";
+  ModuleBenchmark::EventLines fin_tpar[12], fin_barrelFM[16], fin_diskFM[16];
+  for (unsigned int i = 0; i < 12; i++)
+    fin_tpar[i] = bench.readEvents(dir + "/TrackletParameters_TPAR_L1L2" + string(1, 'A' + i) + "_04.dat");
+  for (unsigned int i = 0; i < 16; i++) {
+    const string phi = "PHI" + string(1, phiRegions[i % 4]);
+    fin_barrelFM[i] = bench.readEvents(dir + "/FullMatches_FM_L1L2_L" + to_string(3 + i / 4) + phi + "_04.dat");
+    fin_diskFM[i] = bench.readEvents(dir + "/FullMatches_FM_L1L2_D" + to_string(1 + i / 4) + phi + "_04.dat");
+  }
+
+  BXType bx_o;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      for (unsigned short i = 0; i < kMaxProc; i++) {
+        trackWord[i] = TrackFit::TrackWord(0);
+        for (unsigned short j = 0; j < 4; j++) {
+          barrelStubWords[j][i] = TrackFit::BarrelStubWord(0);
+          diskStubWords[j][i] = TrackFit::DiskStubWord(0);
+        }
+      }
+      for (unsigned int i = 0; i < 12; i++)
+        writeMemFromEvent(trackletParameters[i], fin_tpar[i][ievt], ievt);
+      for (unsigned int i = 0; i < 16; i++) {
+        writeMemFromEvent(barrelFullMatches[i], fin_barrelFM[i][ievt], ievt);
+        writeMemFromEvent(diskFullMatches[i], fin_diskFM[i][ievt], ievt);
+        ninputs += fin_barrelFM[i][ievt].size() + fin_diskFM[i][ievt].size();
+      }
+      return ninputs;
+    },
+    [&](int ievt) {
+      TrackBuilder_L1L2(ievt, trackletParameters, barrelFullMatches, diskFullMatches,
+                        bx_o, trackWord, barrelStubWords, diskStubWords);
+    });
+
+  return bench.report();
+}
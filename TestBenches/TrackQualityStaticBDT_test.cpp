@@ -0,0 +1,70 @@
+// Test bench for the track quality BDT compiled from code
+//
+// Checks that bdt_static (TrackQuality/parameters_static.h), which
+// TrackQualityTop evaluates, gives the same score and tree scores as the node
+// arrays of bdt (TrackQuality/parameters.h) written by conifer. The feature
+// vectors are random values of input_t, with each feature set with
+// probability 1/2 to one of the thresholds it is compared with, or to the value
+// one LSB above or below it:
+//   TrackQualityStaticBDT_test [number of feature vectors]
+#include "parameters_static.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+constexpr int kNFracBits = input_t::width - input_t::iwidth;
+
+int main(int argc, char *argv[])
+{
+  const int nvectors = (argc > 1) ? atoi(argv[1]) : 200000;
+  mt19937 rng(12345);
+
+  // Thresholds each feature is compared with
+  vector<input_t> thresholds[n_features];
+  for (int i = 0; i < n_trees; i++)
+    for (int j = 0; j < BDT::fn_classes(n_classes); j++) {
+      const auto& tree = bdt.trees[i][j];
+      for (int n = 0; n < BDT::fn_nodes(max_depth); n++)
+        if (tree.children_left[n] != -1) thresholds[tree.feature[n]].push_back(tree.threshold[n]);
+    }
+
+  const input_t lsb = ldexp(1.0, -kNFracBits);
+  uniform_int_distribution<int> value(-(1 << (input_t::width - 1)), (1 << (input_t::width - 1)) - 1);
+  uniform_int_distribution<int> shift(-1, 1);
+
+  int nerrors = 0;
+  for (int ivector = 0; ivector < nvectors; ivector++) {
+    input_arr_t x;
+    for (int f = 0; f < n_features; f++) {
+      if ((rng() & 1) && not thresholds[f].empty())
+        x[f] = thresholds[f][rng() % thresholds[f].size()] + shift(rng) * lsb;
+      else
+        x[f] = ldexp(double(value(rng)), -kNFracBits);
+    }
+
+    score_arr_t score, score_static;
+    score_t tree_scores[BDT::fn_classes(n_classes) * n_trees], tree_scores_static[BDT::fn_classes(n_classes) * n_trees];
+    bdt.decision_function(x, score, tree_scores);
+    bdt_static.decision_function(x, score_static, tree_scores_static);
+
+    bool error = false;
+    for (int j = 0; j < BDT::fn_classes(n_classes); j++)
+      error |= (score[j] != score_static[j]);
+    for (int k = 0; k < BDT::fn_classes(n_classes) * n_trees; k++)
+      error |= (tree_scores[k] != tree_scores_static[k]);
+
+    if (error && nerrors++ < 10) {
+      cout << "Features";
+      for (int f = 0; f < n_features; f++) cout << " " << x[f];
+      cout << ": score " << score[0] << " and " << score_static[0] << " with the static trees" << endl;
+    }
+  }
+
+  cout << nvectors << " feature vectors, " << nerrors << " errors" << endl;
+  return nerrors > 0;
+}
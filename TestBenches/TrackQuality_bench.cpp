@@ -0,0 +1,38 @@
+// Throughput benchmark of the TrackQuality, see Benchmark.h. The inputs are
+// the tracks of each event.
+#include "TrackQualityTop.h"
+#include "TrackQualityMemory.h"
+#include "parameters.h"
+#include "BDT.h"
+
+#include "Benchmark.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("TrackQuality", argc, argv);
+
+  auto fin_tracks = bench.readEvents("TQ/hls_hex.dat");
+
+  // the tracks are decoded once, outside of the measurement
+  vector<vector<TTTrack> > tracks(fin_tracks.size());
+  for (unsigned int ievt = 0; ievt < fin_tracks.size(); ievt++) {
+    for (const auto& line : fin_tracks[ievt])
+      tracks[ievt].emplace_back(split(line, '|')[0]);
+  }
+
+  score_arr_t score;
+  score_t tree_scores[BDT::fn_classes(n_classes) * n_trees];
+
+  bench.run(
+    [&](int ievt) {
+      return tracks[ievt].size();
+    },
+    [&](int ievt) {
+      for (const auto& track : tracks[ievt])
+        TrackQualityTop(track, score, tree_scores);
+    });
+
+  return bench.report();
+}
@@ -5,6 +5,7 @@
 #include "parameters.h"
 #include "FileReadUtility.h"
 #include "BDT.h"
+#include "BDTBatch.h"
 
 #include <fstream>
 #include <iostream>
@@ -17,6 +18,78 @@
 const int nevents = 5;  // number of events to run
 using namespace std;
 
+// Checks that BDT::decision_function_batch gives the scores of TrackQualityTop
+// for the tracks of an event, scored as one block. Returns the number of
+// inconsistent tracks.
+int checkBatch(const BXType bx, const TrackQualityMemory& tracks, int event_count)
+{
+  static input_t x[n_features][kMemDepth];
+  static score_t batch_score[BDT::fn_classes(n_classes)][kMemDepth];
+  const unsigned int ntracks = tracks.getEntries(bx);
+  for (unsigned int i = 0; i < ntracks; i++) {
+    input_arr_t features;
+    FeatureTransform(tracks.read_mem(bx, i), features);
+    for (int f = 0; f < n_features; f++) x[f][i] = features[f];
+  }
+  BDT::decision_function_batch<kMemDepth>(bdt, x, batch_score);
+
+  int err_count = 0;
+  for (unsigned int i = 0; i < ntracks; i++) {
+    score_arr_t score{};
+    score_t tree_scores[BDT::fn_classes(n_classes) * n_trees]{};
+    TrackQualityTop(tracks.read_mem(bx, i), score, tree_scores);
+    if (batch_score[0][i] != score[0]) {
+      std::cout << "\t" << "<=== INCONSISTENT BATCH\n";
+      std::cout << "Event: " << event_count << " Track: " << i + 1 << std::endl;
+      std::cout << "Batch: " << (float)batch_score[0][i] << " HLS Prediction: " << (float)score[0] << std::endl;
+      err_count++;
+    }
+  }
+  return err_count;
+}
+
+// Checks that TrackQualityMemoryTop writes the tracks of an event with the
+// MVATQ of the score of TrackQualityTop and their other bits unchanged. The
+// MVATQ is the bin of the probability 1/(1+exp(-score)) with lower edges 0,
+// 0.6, 0.7, 0.75, 0.8, 0.85, 0.9 and 0.95. Returns the number of inconsistent
+// tracks.
+int checkMemoryTop(const BXType bx, const TrackQualityMemory& tracks, int event_count)
+{
+  static TrackQualityMemory scoredTracks;
+  scoredTracks.clear();
+  BXType bx_o;
+  TrackQualityMemoryTop(bx, &tracks, bx_o, &scoredTracks);
+
+  int err_count = 0;
+  if (bx_o != bx) err_count++;
+  if (scoredTracks.getEntries(bx) != std::min<unsigned int>(tracks.getEntries(bx), kMaxProc)) {
+    std::cout << "Event: " << event_count << " " << scoredTracks.getEntries(bx) << " scored tracks for "
+              << tracks.getEntries(bx) << " tracks" << std::endl;
+    err_count++;
+  }
+  for (unsigned int i = 0; i < tracks.getEntries(bx) && i < kMaxProc; i++) {
+    const TTTrack track = tracks.read_mem(bx, i);
+    score_arr_t score{};
+    score_t tree_scores[BDT::fn_classes(n_classes) * n_trees]{};
+    TrackQualityTop(track, score, tree_scores);
+    const double probability = 1 / (1 + exp(-score[0].to_double()));
+    const double edges[] = {0.6, 0.7, 0.75, 0.8, 0.85, 0.9, 0.95};
+    int mvatq = 0;
+    for (double edge : edges) mvatq += (probability >= edge);
+    TTTrack expected(track.raw());
+    expected.setMVATQ(mvatq);
+
+    const TTTrack scored = scoredTracks.read_mem(bx, i);
+    if (scored.raw() != expected.raw()) {
+      std::cout << "\t" << "<=== INCONSISTENT MEMORY TOP\n";
+      std::cout << "Event: " << event_count << " Track: " << i + 1 << std::endl;
+      std::cout << "Memory top: " << scored.raw().to_string(16) << " Expected: " << expected.raw().to_string(16) << std::endl;
+      err_count++;
+    }
+  }
+  return err_count;
+}
+
 int main()
 {
   //load input data from text file
@@ -33,12 +106,18 @@ int main()
   int err_count = 0;
   int event_count = 0;
   int track_count = 0;
+  TrackQualityMemory tracks;  // tracks of the current event, for TrackQualityMemoryTop
 
   while (event_count < nevents) {
     
     std::getline(fin_tracks,trk_line);
     
     if (trk_line.find("Event") != std::string::npos){
+      if (event_count > 0) {
+        err_count += checkMemoryTop(event_count, tracks, event_count);
+        err_count += checkBatch(event_count, tracks, event_count);
+      }
+      tracks.clear();
       event_count ++;
       track_count = 0;
       continue;
@@ -51,6 +130,7 @@ int main()
       std::vector<std::string> splitline = split(trk_line, pDelimeter);
 
       TTTrack inputTrack(splitline[0]); //Construct TTTrack representation
+      tracks.write_mem(event_count, inputTrack);
 
       score_arr_t score{};
       score_t tree_scores[BDT::fn_classes(n_classes) * n_trees]{};  //Setup score arrays
@@ -0,0 +1,61 @@
+// Throughput benchmark of the TrackletCalculator (L1L2E), see Benchmark.h
+#include "TrackletCalculatorTop.h"
+
+#include "Benchmark.h"
+#include "Constants.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("TrackletCalculator_L1L2E", argc, argv);
+
+  TBHelper tb("TC/TC_L1L2E");
+  const string innerStubPattern = "AllStubs*_L1*";
+  const string outerStubPattern = "AllStubs*_L2*";
+
+  auto fin_innerStubs = bench.readEvents(tb, innerStubPattern);
+  auto fin_outerStubs = bench.readEvents(tb, outerStubPattern);
+  auto fin_stubPairs = bench.readEvents(tb, "StubPairs*");
+
+  // input memories
+  vector<AllStubMemory<BARRELPS> > innerStubs(fin_innerStubs.size());
+  vector<AllStubMemory<BARRELPS> > outerStubs(fin_outerStubs.size());
+  vector<StubPairMemory> stubPairs(fin_stubPairs.size());
+
+  // output memories
+  static TrackletParameterMemory tpar;
+  static TrackletProjectionMemory<BARRELPS> tproj_barrel_ps[TC::N_PROJOUT_BARRELPS];
+  static TrackletProjectionMemory<BARREL2S> tproj_barrel_2s[TC::N_PROJOUT_BARREL2S];
+  static TrackletProjectionMemory<DISK> tproj_disk[TC::N_PROJOUT_DISK];
+
+  BXType bx_o;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      for (unsigned i = 0; i < innerStubs.size(); i++)
+        writeMemFromEvent(innerStubs[i], fin_innerStubs[i][ievt], ievt);
+      for (unsigned i = 0; i < outerStubs.size(); i++)
+        writeMemFromEvent(outerStubs[i], fin_outerStubs[i][ievt], ievt);
+      for (unsigned i = 0; i < stubPairs.size(); i++) {
+        writeMemFromEvent(stubPairs[i], fin_stubPairs[i][ievt], ievt);
+        ninputs += fin_stubPairs[i][ievt].size();
+      }
+
+      tpar.clear();
+      for (unsigned i = 0; i < TC::N_PROJOUT_BARRELPS; i++)
+        tproj_barrel_ps[i].clear();
+      for (unsigned i = 0; i < TC::N_PROJOUT_BARREL2S; i++)
+        tproj_barrel_2s[i].clear();
+      for (unsigned i = 0; i < TC::N_PROJOUT_DISK; i++)
+        tproj_disk[i].clear();
+      return ninputs;
+    },
+    [&](int ievt) {
+      TrackletCalculator_L1L2E(ievt, innerStubs.data(), outerStubs.data(), stubPairs.data(), bx_o,
+                               &tpar, tproj_barrel_ps, tproj_barrel_2s, tproj_disk);
+    });
+
+  return bench.report();
+}
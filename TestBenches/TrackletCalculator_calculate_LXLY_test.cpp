@@ -0,0 +1,244 @@
+// Test bench for the native versions of TC::calculate_LXLY
+//
+// Checks that TC::calculate_LXLY_native, used by the C simulation of the
+// TrackletCalculator and TrackletProcessor, and TC::calculate_LXLY_batch, used
+// by the C simulation of the TrackletCalculator, give the same results as
+// TC::calculate_LXLY, used by the synthesis, for the L1L2, L3L4 and L5L6
+// seeds. The stub pairs tested are all pairs of radii with random phi and z,
+// the extreme values of phi and z, and random stubs:
+//   TrackletCalculator_calculate_LXLY_test [number of random stub pairs per seed]
+#include "TrackletCalculator.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Outputs of calculate_LXLY, as 64-bit integers
+typedef vector<long long> Outputs;
+
+// Stub pairs per batch of calculate_LXLY_batch. It is not a power of 2, so that
+// each group of stub pairs below ends with a partial batch.
+const int kNBatch = 7;
+
+// The radii of the two seeding layers and of the four projection layers, as in
+// TC::seedingRadii
+template<TF::seed Seed>
+int seedingRadii(TC::Types::rmean rproj[4])
+{
+  const int innerLayer = (Seed == TF::L1L2) ? TF::L1 : ((Seed == TF::L3L4) ? TF::L3 : TF::L5);
+  for (int layer = TF::L1, i = 0; layer <= TF::L6; layer++)
+    if (layer != innerLayer && layer != innerLayer + 1) rproj[i++] = rmean[layer];
+  return innerLayer;
+}
+
+template<TF::seed Seed, bool Native>
+Outputs calculate(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<OuterRegion<Seed>()> &outerStub)
+{
+  TC::Types::rmean rproj[4];
+  const int innerLayer = seedingRadii<Seed>(rproj);
+
+  TC::Types::rinv rinv;
+  TrackletParameters::PHI0PAR phi0;
+  TrackletParameters::TPAR t;
+  TC::Types::z0 z0;
+  TC::Types::phiL phiL[4];
+  TC::Types::zL zL[4];
+  TC::Types::der_phiL der_phiL;
+  TC::Types::der_zL der_zL;
+  TC::Types::phiD phiD[4];
+  TC::Types::rD rD[4];
+  TC::Types::der_phiD der_phiD;
+  TC::Types::der_rD der_rD;
+
+  auto calculate_LXLY = Native ? &TC::calculate_LXLY_native<Seed, InnerRegion<Seed>(), OuterRegion<Seed>()>
+                               : &TC::calculate_LXLY<Seed, InnerRegion<Seed>(), OuterRegion<Seed>()>;
+  calculate_LXLY(innerStub.getR(), innerStub.getPhi(), innerStub.getZ(),
+                 outerStub.getR(), outerStub.getPhi(), outerStub.getZ(),
+                 rmean[innerLayer], rmean[innerLayer + 1], rproj[0], rproj[1], rproj[2], rproj[3],
+                 zmean[TF::D1], zmean[TF::D2], zmean[TF::D3], zmean[TF::D4],
+                 &rinv, &phi0, &t, &z0,
+                 &phiL[0], &phiL[1], &phiL[2], &phiL[3], &zL[0], &zL[1], &zL[2], &zL[3], &der_phiL, &der_zL,
+                 &phiD[0], &phiD[1], &phiD[2], &phiD[3], &rD[0], &rD[1], &rD[2], &rD[3], &der_phiD, &der_rD);
+
+  Outputs outputs = {rinv.to_int64(), phi0.to_int64(), t.to_int64(), z0.to_int64(),
+                     der_phiL.to_int64(), der_zL.to_int64(), der_phiD.to_int64(), der_rD.to_int64()};
+  for (int i = 0; i < 4; i++) {
+    outputs.push_back(phiL[i].to_int64());
+    outputs.push_back(zL[i].to_int64());
+    outputs.push_back(phiD[i].to_int64());
+    outputs.push_back(rD[i].to_int64());
+  }
+  return outputs;
+}
+
+// Outputs of calculate_LXLY_batch for n <= kNBatch stub pairs, the unused
+// entries of the batch repeating the last one as in TC::processStubPairs
+template<TF::seed Seed>
+vector<Outputs> calculateBatch(const AllStub<InnerRegion<Seed>()> innerStub[], const AllStub<OuterRegion<Seed>()> outerStub[], int n)
+{
+  TC::Types::rmean rproj[4];
+  const int innerLayer = seedingRadii<Seed>(rproj);
+
+  int64_t r1[kNBatch], phi1[kNBatch], z1[kNBatch], r2[kNBatch], phi2[kNBatch], z2[kNBatch];
+  for (int i = 0; i < kNBatch; i++) {
+    const int j = (i < n) ? i : n - 1;
+    r1[i] = innerStub[j].getR();
+    phi1[i] = innerStub[j].getPhi();
+    z1[i] = innerStub[j].getZ();
+    r2[i] = outerStub[j].getR();
+    phi2[i] = outerStub[j].getPhi();
+    z2[i] = outerStub[j].getZ();
+  }
+
+  int64_t rinv[kNBatch], phi0[kNBatch], t[kNBatch], z0[kNBatch];
+  int64_t phiL[4][kNBatch], zL[4][kNBatch], der_phiL[kNBatch], der_zL[kNBatch];
+  int64_t phiD[4][kNBatch], rD[4][kNBatch], der_phiD[kNBatch], der_rD[kNBatch];
+
+  TC::calculate_LXLY_batch<Seed, InnerRegion<Seed>(), OuterRegion<Seed>(), kNBatch>(
+      r1, phi1, z1, r2, phi2, z2,
+      rmean[innerLayer], rmean[innerLayer + 1], rproj[0], rproj[1], rproj[2], rproj[3],
+      zmean[TF::D1], zmean[TF::D2], zmean[TF::D3], zmean[TF::D4],
+      rinv, phi0, t, z0,
+      phiL[0], phiL[1], phiL[2], phiL[3], zL[0], zL[1], zL[2], zL[3], der_phiL, der_zL,
+      phiD[0], phiD[1], phiD[2], phiD[3], rD[0], rD[1], rD[2], rD[3], der_phiD, der_rD);
+
+  // The outputs are converted to the types of the outputs of calculate_LXLY, as
+  // in TC::processStubPairs
+  vector<Outputs> outputs;
+  for (int i = 0; i < n; i++) {
+    outputs.push_back({TC::Types::rinv(rinv[i]).to_int64(), TrackletParameters::PHI0PAR(phi0[i]).to_int64(),
+                       TrackletParameters::TPAR(t[i]).to_int64(), TC::Types::z0(z0[i]).to_int64(),
+                       TC::Types::der_phiL(der_phiL[i]).to_int64(), TC::Types::der_zL(der_zL[i]).to_int64(),
+                       TC::Types::der_phiD(der_phiD[i]).to_int64(), TC::Types::der_rD(der_rD[i]).to_int64()});
+    for (int j = 0; j < 4; j++) {
+      outputs.back().push_back(TC::Types::phiL(phiL[j][i]).to_int64());
+      outputs.back().push_back(TC::Types::zL(zL[j][i]).to_int64());
+      outputs.back().push_back(TC::Types::phiD(phiD[j][i]).to_int64());
+      outputs.back().push_back(TC::Types::rD(rD[j][i]).to_int64());
+    }
+  }
+  return outputs;
+}
+
+template<TF::seed Seed>
+class Checker
+{
+public:
+
+  typedef AllStub<InnerRegion<Seed>()> InnerStub;
+  typedef AllStub<OuterRegion<Seed>()> OuterStub;
+
+  Checker(const char* name): name_(name), rng_(Seed) {}
+
+  // Returns the number of stub pairs giving different results
+  unsigned int run(unsigned int nRandom) {
+    // All pairs of radii
+    for (int r1 = 0; r1 < (1 << InnerStub::kASRSize); r1++) {
+      for (int r2 = 0; r2 < (1 << OuterStub::kASRSize); r2++) {
+        InnerStub innerStub = randomStub<InnerStub>();
+        OuterStub outerStub = randomStub<OuterStub>();
+        innerStub.setR(r1);
+        outerStub.setR(r2);
+        check(innerStub, outerStub);
+      }
+    }
+    checkBatch();
+
+    // Extreme values of phi and z
+    const int nExtreme = 4;
+    for (int i = 0; i < nExtreme * nExtreme * nExtreme * nExtreme * 16; i++) {
+      InnerStub innerStub = randomStub<InnerStub>();
+      OuterStub outerStub = randomStub<OuterStub>();
+      innerStub.setPhi(extreme<typename InnerStub::ASPHI>(i % nExtreme));
+      outerStub.setPhi(extreme<typename OuterStub::ASPHI>(i / nExtreme % nExtreme));
+      innerStub.setZ(extreme<typename InnerStub::ASZ>(i / (nExtreme * nExtreme) % nExtreme));
+      outerStub.setZ(extreme<typename OuterStub::ASZ>(i / (nExtreme * nExtreme * nExtreme) % nExtreme));
+      check(innerStub, outerStub);
+    }
+    checkBatch();
+
+    for (unsigned int i = 0; i < nRandom; i++)
+      check(randomStub<InnerStub>(), randomStub<OuterStub>());
+    checkBatch();
+
+    cout << name_ << ": " << nchecked_ << " stub pairs, " << nerrors_ << " differences" << endl;
+    return nerrors_;
+  }
+
+private:
+
+  template<class Stub>
+  Stub randomStub() {
+    return Stub(typename Stub::AllStubData(rng_()));
+  }
+
+  // Bit patterns of a field giving its smallest and largest values, whether
+  // it is signed or not: all bits 0, all bits 1, only the highest bit 1, and
+  // only the highest bit 0
+  template<class T>
+  static T extreme(int i) {
+    ap_uint<T::width> bits = 0;
+    if (i == 1 || i == 3) bits = ~bits;
+    if (i >= 2) bits[T::width - 1] = !bits[T::width - 1];
+    return T(bits);
+  }
+
+  void check(const InnerStub &innerStub, const OuterStub &outerStub) {
+    const Outputs expected = calculate<Seed, false>(innerStub, outerStub);
+    nchecked_++;
+    compare("native", innerStub, outerStub, calculate<Seed, true>(innerStub, outerStub), expected);
+
+    // The batch version is checked once the batch is full
+    innerBatch_[nBatch_] = innerStub;
+    outerBatch_[nBatch_] = outerStub;
+    expectedBatch_[nBatch_] = expected;
+    if (++nBatch_ == kNBatch) checkBatch();
+  }
+
+  void checkBatch() {
+    if (nBatch_ == 0) return;
+    const vector<Outputs> batch = calculateBatch<Seed>(innerBatch_, outerBatch_, nBatch_);
+    for (int i = 0; i < nBatch_; i++)
+      compare("batch", innerBatch_[i], outerBatch_[i], batch[i], expectedBatch_[i]);
+    nBatch_ = 0;
+  }
+
+  void compare(const char* version, const InnerStub &innerStub, const OuterStub &outerStub,
+               const Outputs &outputs, const Outputs &expected) {
+    if (outputs == expected) return;
+    if (nerrors_++ < 10) {
+      cout << name_ << ": different " << version << " results for stubs " << innerStub.raw().to_string(16) << " "
+           << outerStub.raw().to_string(16) << ":";
+      for (unsigned int i = 0; i < expected.size(); i++) {
+        if (outputs[i] != expected[i]) cout << " output " << i << " " << outputs[i] << " instead of " << expected[i];
+      }
+      cout << endl;
+    }
+  }
+
+  const char* name_;
+  mt19937_64 rng_;
+  unsigned int nchecked_ = 0;
+  unsigned int nerrors_ = 0;
+
+  // Stub pairs of the batch being filled, and their expected outputs
+  InnerStub innerBatch_[kNBatch];
+  OuterStub outerBatch_[kNBatch];
+  Outputs expectedBatch_[kNBatch];
+  int nBatch_ = 0;
+};
+
+int main(int argc, char *argv[])
+{
+  const unsigned int nRandom = (argc > 1) ? atoi(argv[1]) : 100000;
+
+  unsigned int nerrors = 0;
+  nerrors += Checker<TF::L1L2>("L1L2").run(nRandom);
+  nerrors += Checker<TF::L3L4>("L3L4").run(nRandom);
+  nerrors += Checker<TF::L5L6>("L5L6").run(nRandom);
+
+  return nerrors > 0;
+}
@@ -23,8 +23,13 @@ const int nevents = 100;  //number of events to run
 
 using namespace std;
 
-int main()
+// Optionally, only a range of events is run:
+//   TrackletCalculator_test [first event] [number of events]
+int main(int argc, char *argv[])
 {
+  const unsigned int firstEvent = (argc > 1) ? atoi(argv[1]) : 0;
+  const unsigned int lastEvent = (argc > 2) ? min(firstEvent + atoi(argv[2]), (unsigned int) nevents) : nevents;
+
   // these need to be customized according to the specific TC being tested
 #if SEED_ == L1L2_
   const auto InnerStubType = BARRELPS;
@@ -97,9 +102,20 @@ int main()
   TrackletProjectionMemory<BARREL2S> tproj_barrel_2s[TC::N_PROJOUT_BARREL2S];
   TrackletProjectionMemory<DISK> tproj_disk[TC::N_PROJOUT_DISK];
 
+  // skip directly to the first event
+  if (firstEvent > 0) {
+    for (const auto &query : {innerStubPattern, outerStubPattern, string("StubPairs*"),
+                              string("TrackletParameters*"), string("TrackletProjections*")}) {
+      if (!tb.seekEvent(query, firstEvent)) {
+        cerr << "Event " << firstEvent << " not found in " << query << endl;
+        return -1;
+      }
+    }
+  }
+
   // loop over events
   cout << "Start event loop ..." << endl;
-  for (unsigned int ievt = 0; ievt < nevents; ++ievt) {
+  for (unsigned int ievt = firstEvent; ievt < lastEvent; ++ievt) {
     cout << "Event: " << dec << ievt << endl;
 
     // read event and write to memories
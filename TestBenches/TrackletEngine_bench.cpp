@@ -0,0 +1,42 @@
+// Throughput benchmark of the TrackletEngine (L1PHIE18_L2PHIC17), see Benchmark.h
+#include "TrackletEngineTop.h"
+
+#include "Benchmark.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  ModuleBenchmark bench("TrackletEngine_L1PHIE18_L2PHIC17", argc, argv);
+
+  // input memories
+  static VMStubTEInnerMemory<BARRELPS> inputvmstubsinner;
+  static VMStubTEOuterMemory<BARRELPS> inputvmstubsouter;
+
+  // output memories
+  static StubPairMemory outputstubpairs;
+
+  auto fin_vmstubsinner = bench.readEvents("TE/TE_L1PHIE18_L2PHIC17/VMStubs_VMSTE_L1PHIE18n2_04.dat");
+  auto fin_vmstubsouter = bench.readEvents("TE/TE_L1PHIE18_L2PHIC17/VMStubs_VMSTE_L2PHIC17n4_04.dat");
+
+  ap_uint<1> bendinnertable[256] =
+#include "../emData/TE/tables/TE_L1PHIE18_L2PHIC17_stubptinnercut.tab"
+  ap_uint<1> bendoutertable[256] =
+#include "../emData/TE/tables/TE_L1PHIE18_L2PHIC17_stubptoutercut.tab"
+
+  BXType bx_o;
+
+  bench.run(
+    [&](int ievt) {
+      outputstubpairs.clear();
+      writeMemFromEvent(inputvmstubsinner, fin_vmstubsinner[ievt], ievt);
+      writeMemFromEvent(inputvmstubsouter, fin_vmstubsouter[ievt], ievt);
+      return fin_vmstubsinner[ievt].size();
+    },
+    [&](int ievt) {
+      TrackletEngineTop(ievt&0x7, inputvmstubsinner, inputvmstubsouter, bendinnertable, bendoutertable,
+                        bx_o, outputstubpairs);
+    });
+
+  return bench.report();
+}
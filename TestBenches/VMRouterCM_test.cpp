@@ -76,6 +76,18 @@ int main() {
   static VMStubMEMemoryCM<outputType, rzSizeME, phiRegSize, kNMatchEngines> memoryME;
   static VMStubTEOuterMemoryCM<outputType, rzSizeTE, phiRegSize, kNTEUnits> memoriesTEO[numTEOCopies];
 
+  // Occupancy of the output memories, written to $MEMORY_STATISTICS
+  for (unsigned int i = 0; i < numASCopies; i++) {
+    memoriesAS[i].collectStatistics(memoryName(tb.fileNames(allStubPattern)[i]));
+  }
+  for (unsigned int i = 0; i < nASInnerCopies; i++) {
+    memoriesASInner[i].collectStatistics(memoryName(tb.fileNames(allStubInnerPattern)[i]));
+  }
+  memoryME.collectStatistics(memoryName(tb.fileNames(mePattern)[0]));
+  for (unsigned int i = 0; i < nVMSTE; i++) {
+    memoriesTEO[i].collectStatistics(memoryName(tb.fileNames(tePattern)[i]));
+  }
+
 
   ///////////////////////////
   // Loop over events
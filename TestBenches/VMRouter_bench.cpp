@@ -0,0 +1,81 @@
+// Throughput benchmark of the VMRouter, for the region selected in
+// VMRouterTop.h, see Benchmark.h
+#include "VMRouterTop.h"
+
+#include "Benchmark.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+  const string vmrID = ((kLAYER) ? "L" + to_string(kLAYER) : "D" + to_string(kDISK)) + "PHI" + static_cast<char>(phiRegion);
+  ModuleBenchmark bench("VMRouter_" + vmrID, argc, argv);
+
+  TBHelper tb("VMR/VMR_" + vmrID);
+  const string inputPattern = (kLAYER) ? "InputStubs*" : "InputStubs*PS*";
+  const string inputDisk2SPattern = "InputStubs*_D*2S*";
+
+  auto fin_inputstubs = bench.readEvents(tb, inputPattern);
+  auto fin_inputstubs_disk2s = bench.readEvents(tb, inputDisk2SPattern);
+  assert(fin_inputstubs.size() == numInputs && fin_inputstubs_disk2s.size() == numInputsDisk2S);
+
+  // input memories
+  static InputStubMemory<inputType> inputStubs[numInputs];
+  static InputStubMemory<DISK2S> inputStubsDisk2S[numInputsDisk2S];
+
+  // output memories
+  static AllStubMemory<outputType> memoriesAS[maxASCopies];
+  static VMStubMEMemory<outputType, nbitsbin> memoriesME[nvmME];
+  static VMStubTEInnerMemory<outputType> memoriesTEI[nvmTEI][maxTEICopies];
+  static VMStubTEInnerMemory<BARRELOL> memoriesOL[nvmOL][maxOLCopies];
+  static VMStubTEOuterMemory<outputType> memoriesTEO[nvmTEO][maxTEOCopies];
+
+  BXType bx_out;
+
+  bench.run(
+    [&](int ievt) {
+      unsigned int ninputs = 0;
+      for (int i = 0; i < maxASCopies; ++i)
+        memoriesAS[i].clear();
+      for (int i = 0; i < nvmME; ++i)
+        memoriesME[i].clear();
+      for (int i = 0; i < nvmTEI; ++i)
+        for (int j = 0; j < maxTEICopies; j++)
+          memoriesTEI[i][j].clear();
+      for (int i = 0; i < nvmOL; ++i)
+        for (int j = 0; j < maxOLCopies; j++)
+          memoriesOL[i][j].clear();
+      for (int i = 0; i < nvmTEO; ++i)
+        for (int j = 0; j < maxTEOCopies; j++)
+          memoriesTEO[i][j].clear();
+
+      for (unsigned int i = 0; i < numInputs; i++) {
+        writeMemFromEvent(inputStubs[i], fin_inputstubs[i][ievt], ievt);
+        ninputs += fin_inputstubs[i][ievt].size();
+      }
+      for (unsigned int i = 0; i < numInputsDisk2S; i++) {
+        writeMemFromEvent(inputStubsDisk2S[i], fin_inputstubs_disk2s[i][ievt], ievt);
+        ninputs += fin_inputstubs_disk2s[i][ievt].size();
+      }
+      return ninputs;
+    },
+    [&](int ievt) {
+      VMRouterTop(ievt, bx_out, inputStubs
+#if kDISK > 0
+          , inputStubsDisk2S
+#endif
+          , memoriesAS, memoriesME
+#if kLAYER == 1 || kLAYER == 2 || kLAYER == 3 || kLAYER == 5 || kDISK == 1 || kDISK == 3
+          , memoriesTEI
+#endif
+#if kLAYER == 1 || kLAYER == 2
+          , memoriesOL
+#endif
+#if kLAYER == 2 || kLAYER == 3 || kLAYER == 4 || kLAYER == 6 || kDISK == 1 || kDISK == 2 || kDISK == 4
+          , memoriesTEO
+#endif
+      );
+    });
+
+  return bench.report();
+}
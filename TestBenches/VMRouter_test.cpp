@@ -107,6 +107,29 @@ int main() {
   static VMStubTEInnerMemory<BARRELOL> memoriesOL[nvmOL][maxOLCopies];
   static VMStubTEOuterMemory<outputType> memoriesTEO[nvmTEO][maxTEOCopies];
 
+  // Occupancy of the output memories, written to $MEMORY_STATISTICS
+  for (unsigned int i = 0; i < maxASCopies; i++) {
+    memoriesAS[i].collectStatistics(memoryName(tb.fileNames(allStubPattern)[i]));
+  }
+  for (unsigned int i = 0; i < nvmME; i++) {
+    memoriesME[i].collectStatistics(memoryName(tb.fileNames(mePattern)[i]));
+  }
+  for (unsigned int i = 0, k = 0; nVMSTEI && i < nvmTEI; i++) {
+    for (unsigned int j = 0; j < numCopiesTEI[i]; j++) {
+      memoriesTEI[i][j].collectStatistics(memoryName(tb.fileNames(teiPattern)[k++]));
+    }
+  }
+  for (unsigned int i = 0, k = 0; nVMSTEOL && i < nvmOL; i++) {
+    for (unsigned int j = 0; j < numCopiesOL[i]; j++) {
+      memoriesOL[i][j].collectStatistics(memoryName(tb.fileNames(teolPattern)[k++]));
+    }
+  }
+  for (unsigned int i = 0, k = 0; nVMSTEO && i < nvmTEO; i++) {
+    for (unsigned int j = 0; j < numCopiesTEO[i]; j++) {
+      memoriesTEO[i][j].collectStatistics(memoryName(tb.fileNames(teoPattern)[k++]));
+    }
+  }
+
 
   ///////////////////////////
   // Loop over events
@@ -0,0 +1,106 @@
+#ifndef BDT_BATCH_H__
+#define BDT_BATCH_H__
+
+// Scoring of blocks of inputs by a BDT::BDT in C simulation, for validation
+// and tuning on many tracks. It is kept apart from BDT.h, which conifer
+// regenerates.
+#ifndef __SYNTHESIS__
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "BDT.h"
+
+namespace BDT{
+
+// Same scores as bdt.decision_function for N inputs given as a structure of
+// arrays: x[f][k] is feature f of input k, and score[j][k] is the score of
+// class j of input k. Each node of each tree is evaluated for all the inputs
+// at once with branchless comparisons and masks, in loops over k that the
+// compiler vectorizes. The features and thresholds are compared as floats, or
+// doubles if they are wider than 24 bits, which hold them exactly. The leaf
+// values are added up in 32-bit integer units of the LSB of score_t, wrapped to
+// its width at the end as the additions of decision_function wrap (score_t has
+// the default AP_WRAP overflow mode).
+template<int N, int n_trees, int max_depth, int n_classes, class input_t, class score_t, class threshold_t>
+void decision_function_batch(
+	const BDT<n_trees, max_depth, n_classes, input_t, score_t, threshold_t>& bdt,
+	const typename std::remove_extent<input_t>::type x[][N],
+	score_t score[fn_classes(n_classes)][N]){
+
+	typedef typename std::remove_extent<input_t>::type feature_t;
+	typedef typename std::conditional<(feature_t::width <= 24 && threshold_t::width <= 24), float, double>::type real_t;
+	constexpr int n_features = std::extent<input_t>::value;
+	constexpr int n_nodes = fn_nodes(max_depth);
+	constexpr int n_scores = fn_classes(n_classes);
+	constexpr int score_width = score_t::width;
+	static_assert(score_width <= 32, "The scores are added up in 32-bit integers");
+	const double lsb = std::ldexp(1.0, score_t::iwidth - score_t::width);
+
+	std::vector<real_t> features(n_features * N);
+	for(int f = 0; f < n_features; f++){
+		for(int k = 0; k < N; k++){
+			features[f * N + k] = real_t(x[f][k].to_double());
+		}
+	}
+
+	std::vector<uint32_t> sum(n_scores * N);
+	for(int j = 0; j < n_scores; j++){
+		const uint32_t init = std::llround(bdt.init_predict[j].to_double() / lsb);
+		for(int k = 0; k < N; k++){
+			sum[j * N + k] = init;
+		}
+	}
+
+	// Masks (0 or all bits set) of the comparisons and activations of the nodes
+	std::vector<uint32_t> comparison(n_nodes * N), activation(n_nodes * N);
+	for(int i = 0; i < n_trees; i++){
+		for(int j = 0; j < n_scores; j++){
+			const Tree<max_depth, input_t, score_t, threshold_t>& tree = bdt.trees[i][j];
+			uint32_t* const s = &sum[j * N];
+			for(int n = 0; n < n_nodes; n++){
+				uint32_t* const a = &activation[n * N];
+				uint32_t* const c = &comparison[n * N];
+				const int p = tree.parent[n];
+				if(n == 0){
+					for(int k = 0; k < N; k++) a[k] = ~0u;
+				}else if(p < 0){
+					for(int k = 0; k < N; k++) a[k] = 0u;
+				}else{
+					// The parents come before their children
+					const uint32_t* const ap = &activation[p * N];
+					const uint32_t* const cp = &comparison[p * N];
+					const uint32_t flip = (n == tree.children_left[p]) ? 0u : ~0u;
+					for(int k = 0; k < N; k++) a[k] = ap[k] & (cp[k] ^ flip);
+				}
+				if(tree.feature[n] != -2){
+					const real_t* const xf = &features[tree.feature[n] * N];
+					const real_t threshold = real_t(tree.threshold[n].to_double());
+					for(int k = 0; k < N; k++) c[k] = -uint32_t(xf[k] <= threshold);
+				}else{
+					for(int k = 0; k < N; k++) c[k] = ~0u;
+				}
+				if(tree.children_left[n] == -1){ // is a leaf
+					const uint32_t value = std::llround(tree.value[n].to_double() / lsb);
+					for(int k = 0; k < N; k++) s[k] += a[k] & value;
+				}
+			}
+		}
+	}
+
+	for(int j = 0; j < n_scores; j++){
+		for(int k = 0; k < N; k++){
+			const int64_t wrapped = int64_t(uint64_t(sum[j * N + k]) << (64 - score_width)) >> (64 - score_width);
+			score[j][k] = score_t(wrapped * lsb);
+			score[j][k] *= bdt.normalisation;
+		}
+	}
+}
+
+}
+
+#endif // __SYNTHESIS__
+
+#endif
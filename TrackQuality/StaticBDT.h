@@ -0,0 +1,58 @@
+#ifndef BDT_STATIC_H__
+#define BDT_STATIC_H__
+
+// BDT whose trees are compiled from code, see parameters_static.h. It is kept
+// apart from BDT.h, which conifer regenerates.
+#include "BDT.h"
+
+namespace BDT{
+
+// Tree whose structure, features, thresholds and values are compile-time
+// constants. conifer_converter.py --static writes the decision_function of the
+// tree of each class j of each tree i to parameters_static.h, as the
+// comparisons on the paths to its leaves, so that it compiles to a comparator
+// network instead of the node arrays of Tree.
+template<int i, int j, class input_t, class score_t>
+struct StaticTree {
+	static score_t decision_function(input_t x);
+};
+
+// Adds the scores of the trees from k = i * fn_classes(n_classes) + j on
+template<int n_trees, int n_classes, class input_t, class score_t, int k = 0, bool end = (k == n_trees * fn_classes(n_classes))>
+struct StaticTrees {
+	static void decision_function(input_t x, score_t score[fn_classes(n_classes)], score_t tree_scores[fn_classes(n_classes) * n_trees]){
+		#pragma HLS inline
+		score_t s = StaticTree<k / fn_classes(n_classes), k % fn_classes(n_classes), input_t, score_t>::decision_function(x);
+		score[k % fn_classes(n_classes)] += s;
+		tree_scores[k] = s;
+		StaticTrees<n_trees, n_classes, input_t, score_t, k + 1>::decision_function(x, score, tree_scores);
+	}
+};
+
+template<int n_trees, int n_classes, class input_t, class score_t, int k>
+struct StaticTrees<n_trees, n_classes, input_t, score_t, k, true> {
+	static void decision_function(input_t, score_t[fn_classes(n_classes)], score_t[fn_classes(n_classes) * n_trees]){}
+};
+
+// BDT with the same decision_function as BDT, whose trees are StaticTrees
+template<int n_trees, int n_classes, class input_t, class score_t>
+struct StaticBDT{
+
+public:
+    score_t normalisation;
+	score_t init_predict[fn_classes(n_classes)];
+
+	void decision_function(input_t x, score_t score[fn_classes(n_classes)], score_t tree_scores[fn_classes(n_classes) * n_trees]) const{
+		for(int j = 0; j < fn_classes(n_classes); j++){
+			score[j] = init_predict[j];
+		}
+		StaticTrees<n_trees, n_classes, input_t, score_t>::decision_function(x, score, tree_scores);
+        for(int j = 0; j < fn_classes(n_classes); j++){
+            score[j] *= normalisation;
+        }
+	}
+
+};
+
+}
+#endif
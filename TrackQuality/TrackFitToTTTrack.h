@@ -0,0 +1,201 @@
+#ifndef TrackQuality_TrackFitToTTTrack_h
+#define TrackQuality_TrackFitToTTTrack_h
+
+#include "ap_fixed.h"
+#include "../TrackletAlgorithm/Constants.h"
+#include "../TrackletAlgorithm/TrackFitMemory.h"
+#include "TrackQualityMemory.h"
+
+// Conversion of the tracks of the TrackBuilder, given as its track and stub
+// words, to the TTTrack words scored by the TrackQuality, so that the two run
+// one after the other without going through the memory prints of the CMSSW
+// emulation.
+//
+// The track parameters are the tracklet parameters with the LSBs of the L1
+// track word (CMSSW TTTrack_TrackWord), and D0 is 0.
+//
+// Some fields are placeholders that do not come from the emulation, so the
+// scores are not those the BDT gives to fitted tracks and have not been
+// validated against it:
+// - phi0 is taken relative to the centre of its range, as the sector centre
+//   the track word uses is not known here.
+// - The TrackBuilder does no fit, so the chi2 fields are not the chi2 of a
+//   fit. They are the reduced chi2 of the stub residuals of the tracklet
+//   projections, with the intrinsic resolutions (pitch / sqrt(12)) below
+//   and one degree of freedom per matched stub. They are binned as in the
+//   track word.
+// - The bend chi2 is 0, as the stub bends are not in the stub words.
+//
+// The hit pattern follows the layers and disks crossed by the track from the
+// inside out: bits 0 and 1 are the seeding layers L1 and L2, and bits 2 to 6
+// are the first five of the barrel layers up to the last one with a stub,
+// followed by the disks.
+
+namespace TQ {
+
+// LSBs of the parameters of the L1 track word
+constexpr double kTTInvRLSB = 2 * 0.006 / (1 << TTTrack::InvRSize);
+constexpr double kTTPhiLSB = 2 * 0.7853981696 / (1 << TTTrack::PhiSize);
+constexpr double kTTTanLLSB = 2 * 7.5 / (1 << TTTrack::TanLSize);
+constexpr double kTTZ0LSB = 2 * 20.46912 / (1 << TTTrack::Z0Size);
+
+// Intrinsic resolutions (pitch / sqrt(12)) in cm of the PS and 2S modules.
+// The disk stubs are taken to be on PS modules.
+constexpr double kSqrt12 = 3.4641016151377544;
+constexpr double kSigmaRPhiPS = 0.01 / kSqrt12;
+constexpr double kSigmaRPhi2S = 0.009 / kSqrt12;
+constexpr double kSigmaZPS = 0.15 / kSqrt12;
+constexpr double kSigmaZ2S = 5.0 / kSqrt12;
+
+// Lower edges of bins 1 to 15 of the reduced chi2 fields
+constexpr int kNChi2Cuts = (1 << TTTrack::Chi2rphiSize) - 1;
+constexpr double kChi2Cuts[kNChi2Cuts] = {0.25, 0.5, 1, 2, 3, 5, 7, 10, 20, 40, 100, 200, 500, 1000, 3000};
+
+// Fractional bits of the factors converting the track parameters to the LSBs
+// of the track word
+constexpr int kNScaleBits = 16;
+constexpr unsigned int scaleFactor(double scale) {
+  return scale * (1 << kNScaleBits) + 0.5;
+}
+
+typedef ap_ufixed<18,1> ResidScale;           // LSB of a residual over the resolution
+typedef ap_ufixed<18,-12> DiskPhiResidScale;  // Same for a disk phi residual, per unit of stub r
+typedef ap_fixed<24,13> NormResid;            // Residual over the resolution
+typedef ap_ufixed<36,28> Chi2;
+
+// Scales of the residuals of the barrel stubs L3 to L6. The phi residuals are
+// in units of kphi, the z residuals in units of the stub z of the layer.
+constexpr double barrelPhiResidScale(int i) {
+  return kphi * rmean[TrackFit::kNBarrelStubs - 2 + i] * kr / (i == 0 ? kSigmaRPhiPS : kSigmaRPhi2S);
+}
+constexpr double barrelZResidScale(int i) {
+  return kz_cm[TrackFit::kNBarrelStubs - 2 + i] / (i == 0 ? kSigmaZPS : kSigmaZ2S);
+}
+
+// Adds the squares of the normalised residuals of the barrel stub Hit
+template<uint8_t Hit>
+void addBarrelStub(const TrackFit::BarrelStubWord& word, ap_uint<TrackFit::kNStubs>& hits, Chi2& chi2rphi, Chi2& chi2rz)
+{
+#pragma HLS inline
+  constexpr unsigned int lsb = TrackFit::kTFStubRZResidLSB(Hit);
+  static const ResidScale phiScale = barrelPhiResidScale(Hit);
+  static const ResidScale zScale = barrelZResidScale(Hit);
+
+  if (TrackFit::getWordBits<TrackFit::kTFStubValidMSB(Hit), TrackFit::kTFStubValidLSB(Hit), lsb>(word)) {
+    const TrackFit::TFSTUBPHIRESID phiResid = TrackFit::getWordBits<TrackFit::kTFStubPhiResidMSB(Hit), TrackFit::kTFStubPhiResidLSB(Hit), lsb>(word);
+    const TrackFit::TFSTUBZRESID zResid = TrackFit::getWordBits<TrackFit::kTFStubRZResidMSB(Hit), TrackFit::kTFStubRZResidLSB(Hit), lsb>(word);
+    const NormResid phi = phiResid * phiScale;
+    const NormResid z = zResid * zScale;
+    chi2rphi += phi * phi;
+    chi2rz += z * z;
+    hits.set_bit(Hit, true);
+  }
+}
+
+// Same for the disk stub Hit, whose phi residual is scaled by its r
+template<uint8_t Hit>
+void addDiskStub(const TrackFit::DiskStubWord& word, ap_uint<TrackFit::kNStubs>& hits, Chi2& chi2rphi, Chi2& chi2rz)
+{
+#pragma HLS inline
+  constexpr unsigned int lsb = TrackFit::kTFStubRZResidLSB(Hit);
+  static const DiskPhiResidScale phiScale = kphi * kr / kSigmaRPhiPS;
+  static const ResidScale rScale = krprojdisk / kSigmaZPS;
+
+  if (TrackFit::getWordBits<TrackFit::kTFStubValidMSB(Hit), TrackFit::kTFStubValidLSB(Hit), lsb>(word)) {
+    const TrackFit::TFDISKSTUBR stubR = TrackFit::getWordBits<TrackFit::kTFStubRMSB(Hit), TrackFit::kTFStubRLSB(Hit), lsb>(word);
+    const TrackFit::TFSTUBPHIRESID phiResid = TrackFit::getWordBits<TrackFit::kTFStubPhiResidMSB(Hit), TrackFit::kTFStubPhiResidLSB(Hit), lsb>(word);
+    const TrackFit::TFSTUBRRESID rResid = TrackFit::getWordBits<TrackFit::kTFStubRZResidMSB(Hit), TrackFit::kTFStubRZResidLSB(Hit), lsb>(word);
+    const ap_int<TrackFit::kTFPhiResidSize + TrackFit::kTFDiskStubRSize + 1> rphi = phiResid * stubR;
+    const NormResid phi = rphi * phiScale;
+    const NormResid r = rResid * rScale;
+    chi2rphi += phi * phi;
+    chi2rz += r * r;
+    hits.set_bit(Hit, true);
+  }
+}
+
+// Bin of a chi2 with ndf degrees of freedom
+inline ap_uint<TTTrack::Chi2rphiSize> Chi2Bin(const Chi2 chi2, const ap_uint<4> ndf)
+{
+#pragma HLS inline
+  static const Chi2 cuts[kNChi2Cuts] = {kChi2Cuts[0], kChi2Cuts[1], kChi2Cuts[2], kChi2Cuts[3], kChi2Cuts[4],
+                                        kChi2Cuts[5], kChi2Cuts[6], kChi2Cuts[7], kChi2Cuts[8], kChi2Cuts[9],
+                                        kChi2Cuts[10], kChi2Cuts[11], kChi2Cuts[12], kChi2Cuts[13], kChi2Cuts[14]};
+#pragma HLS array_partition variable=cuts complete
+
+  ap_uint<TTTrack::Chi2rphiSize> bin = 0;
+  chi2_bins: for (int i = 0; i < kNChi2Cuts; i++) {
+#pragma HLS unroll
+    if (chi2 >= cuts[i] * ndf) bin = i + 1;
+  }
+  return bin;
+}
+
+// Converts a track of the TrackBuilder, given by its track word and the words
+// of its barrel (L3 to L6) and disk (D1 to D4) stubs
+inline TTTrack ToTTTrack(
+    const TrackFit::TrackWord trackWord,
+    const TrackFit::BarrelStubWord barrelStubWords[TrackFit::kNBarrelStubs],
+    const TrackFit::DiskStubWord diskStubWords[TrackFit::kNDiskStubs]
+)
+{
+#pragma HLS inline
+  // Stubs and chi2
+  ap_uint<TrackFit::kNStubs> hits = 0;
+  Chi2 chi2rphi = 0, chi2rz = 0;
+  addBarrelStub<0>(barrelStubWords[0], hits, chi2rphi, chi2rz);
+  addBarrelStub<1>(barrelStubWords[1], hits, chi2rphi, chi2rz);
+  addBarrelStub<2>(barrelStubWords[2], hits, chi2rphi, chi2rz);
+  addBarrelStub<3>(barrelStubWords[3], hits, chi2rphi, chi2rz);
+  addDiskStub<4>(diskStubWords[0], hits, chi2rphi, chi2rz);
+  addDiskStub<5>(diskStubWords[1], hits, chi2rphi, chi2rz);
+  addDiskStub<6>(diskStubWords[2], hits, chi2rphi, chi2rz);
+  addDiskStub<7>(diskStubWords[3], hits, chi2rphi, chi2rz);
+
+  // The 4 parameters of the tracklet are fixed by the two seeding stubs, so
+  // there is one degree of freedom in r-phi and in r-z per matched stub
+  ap_uint<4> nmatches = 0;
+  count_matches: for (int i = 0; i < TrackFit::kNStubs; i++) {
+#pragma HLS unroll
+    nmatches += hits[i];
+  }
+  const ap_uint<4> ndf = (nmatches == 0) ? ap_uint<4>(1) : nmatches;
+
+  // Layers and disks crossed by the track after L2: the barrel layers up to
+  // the last one with a stub, then the disks
+  ap_uint<3> nbarrel = 0;
+  barrel_layers: for (int i = 0; i < TrackFit::kNBarrelStubs; i++) {
+#pragma HLS unroll
+    if (hits[i]) nbarrel = i + 1;
+  }
+  const ap_uint<TrackFit::kNBarrelStubs> barrelHits = hits.range(TrackFit::kNBarrelStubs - 1, 0);
+  const ap_uint<TrackFit::kNStubs> diskHits = hits.range(TrackFit::kNStubs - 1, TrackFit::kNBarrelStubs);
+  const ap_uint<TrackFit::kNStubs> crossed = (diskHits << nbarrel) | barrelHits;
+  const TTTrack::TTHitPattern hitPattern = (crossed.range(TTTrack::HitPatternSize - 3, 0), ap_uint<2>(3));
+
+  // Track parameters, rescaled by integer factors with kNScaleBits fractional
+  // bits and rounded
+  static const ap_uint<kNScaleBits + 4> invRScale = scaleFactor(krinv / kTTInvRLSB);
+  static const ap_uint<kNScaleBits + 4> phiScale = scaleFactor(kphi0 / kTTPhiLSB);
+  static const ap_uint<kNScaleBits + 4> tanLScale = scaleFactor(kt / kTTTanLLSB);
+  static const ap_uint<kNScaleBits + 4> z0Scale = scaleFactor(kz0 / kTTZ0LSB);
+  constexpr unsigned int lsb = TrackFit::kTFHitMapLSB;
+  const TrackFit::TFRINV rinv = TrackFit::getWordBits<TrackFit::kTFRinvMSB, TrackFit::kTFRinvLSB, lsb>(trackWord);
+  const TrackFit::TFPHI0 phi0 = TrackFit::getWordBits<TrackFit::kTFPhi0MSB, TrackFit::kTFPhi0LSB, lsb>(trackWord);
+  const TrackFit::TFT t = TrackFit::getWordBits<TrackFit::kTFTMSB, TrackFit::kTFTLSB, lsb>(trackWord);
+  const TrackFit::TFZ0 z0 = TrackFit::getWordBits<TrackFit::kTFZ0MSB, TrackFit::kTFZ0LSB, lsb>(trackWord);
+  const ap_int<TrackFit::kTFPhi0Size + 1> localPhi0 = phi0 - (1 << (TrackFit::kTFPhi0Size - 1));
+
+  const TTTrack::TTInvR invR = (rinv * invRScale + (1 << (kNScaleBits - 1))) >> kNScaleBits;
+  const TTTrack::TTPhi phi = (localPhi0 * phiScale + (1 << (kNScaleBits - 1))) >> kNScaleBits;
+  const TTTrack::TTTanL tanL = (t * tanLScale + (1 << (kNScaleBits - 1))) >> kNScaleBits;
+  const TTTrack::TTZ0 ttZ0 = (z0 * z0Scale + (1 << (kNScaleBits - 1))) >> kNScaleBits;
+
+  return TTTrack(invR, phi, tanL, ttZ0, TTTrack::TTD0(0),
+                 Chi2Bin(chi2rphi, ndf), Chi2Bin(chi2rz, ndf), TTTrack::TTBendChi2(0), hitPattern,
+                 TTTrack::TTMVATQ(0), TTTrack::TTMVAres(0), TTTrack::TTTkValid(1));
+}
+
+} // namespace TQ
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef TrackQuality_TrackQuality_h
+#define TrackQuality_TrackQuality_h
+
+#include "BDT.h"
+#include "parameters.h"
+#include "parameters_static.h"
+#include "TrackQualityMemory.h"
+#include "TrackFitToTTTrack.h"
+#include "TracktoFeature.h"
+
+namespace TQ {
+
+// The BDT score is the logit of the probability of a track to be genuine. The
+// MVATQ field of the track word is the bin of this probability, whose lower
+// edges are 0, 0.6, 0.7, 0.75, 0.8, 0.85, 0.9 and 0.95; kMVAQualityCuts are
+// the logits of the lower edges of bins 1 to 7.
+constexpr int kNMVAQualityCuts = (1 << TTTrack::MVATQSize) - 1;
+constexpr double kMVAQualityCuts[kNMVAQualityCuts] = {0.405465, 0.847298, 1.098612, 1.386294, 1.734601, 2.197225, 2.944439};
+
+// The scores are multiples of the LSB of score_t, so a score is above a logit
+// exactly when it is above the logit rounded up to a multiple of the LSB. A
+// plain conversion to score_t would truncate the logit instead (0.405465 to
+// 0.3984), which puts the scores just below it in the bin above.
+constexpr double kScoreLSB = 1.0 / (1 << (score_t::width - score_t::iwidth));
+constexpr double ceilToScoreLSB(const double x)
+{
+  return (double(long(x / kScoreLSB)) < x / kScoreLSB ? long(x / kScoreLSB) + 1 : long(x / kScoreLSB)) * kScoreLSB;
+}
+
+inline TTTrack::TTMVATQ MVAQuality(const score_t score)
+{
+#pragma HLS inline
+  static const score_t cuts[kNMVAQualityCuts] = {ceilToScoreLSB(kMVAQualityCuts[0]), ceilToScoreLSB(kMVAQualityCuts[1]),
+                                                 ceilToScoreLSB(kMVAQualityCuts[2]), ceilToScoreLSB(kMVAQualityCuts[3]),
+                                                 ceilToScoreLSB(kMVAQualityCuts[4]), ceilToScoreLSB(kMVAQualityCuts[5]),
+                                                 ceilToScoreLSB(kMVAQualityCuts[6])};
+#pragma HLS array_partition variable=cuts complete
+
+  TTTrack::TTMVATQ mvatq = 0;
+  quality_bins: for (int i = 0; i < kNMVAQualityCuts; i++) {
+#pragma HLS unroll
+    if (score >= cuts[i]) mvatq = i + 1;
+  }
+  return mvatq;
+}
+
+// Scores a track and writes its MVATQ field
+inline TTTrack Score(const TTTrack& track)
+{
+#pragma HLS inline
+  input_arr_t x;
+#pragma HLS array_partition variable=x complete
+  FeatureTransform(track, x);
+
+  score_arr_t score;
+  score_t tree_scores[BDT::fn_classes(n_classes) * n_trees];
+#pragma HLS array_partition variable=score complete
+#pragma HLS array_partition variable=tree_scores complete
+  bdt_static.decision_function(x, score, tree_scores);
+
+  TTTrack scored(track.raw());
+  scored.setMVATQ(MVAQuality(score[0]));
+  return scored;
+}
+
+} // namespace TQ
+
+// Scores the tracks of a BX and writes them, with their MVATQ field set, to the
+// same addresses of the output memory. NLanes tracks are scored per clock by
+// as many copies of the BDT, so that the kMaxProc tracks of a BX take
+// kMaxProc / NLanes clocks; the memories need NLanes ports, see
+// TrackQualityMemoryTop.
+template<int NLanes>
+void TrackQuality(
+    const BXType bx,
+    const TrackQualityMemory* const tracks,
+    BXType& bx_o,
+    TrackQualityMemory* const scoredTracks
+)
+{
+  const auto ntracks = tracks->getEntries(bx);
+  const auto nscored = (ntracks < kMaxProc) ? ntracks : decltype(ntracks)(kMaxProc);
+
+  track_loop: for (int i = 0; i < (kMaxProc + NLanes - 1) / NLanes; i++) {
+#pragma HLS pipeline II=1 rewind
+    lanes: for (int j = 0; j < NLanes; j++) {
+#pragma HLS unroll
+      const int addr = i * NLanes + j;
+      if (addr < nscored) {
+        scoredTracks->write_mem(bx, TQ::Score(tracks->read_mem(bx, addr)), addr);
+      }
+    }
+  }
+  scoredTracks->setEntries(bx, nscored);
+
+  bx_o = bx;
+}
+
+// Converts the tracks of a BX written by the TrackBuilder (see
+// TrackBuilder_L1L2) to TTTracks, see TrackFitToTTTrack.h, and scores them in
+// the same pass. They are written to the same addresses of the output memory,
+// NLanes tracks per clock as in TrackQuality. The entry count of the output
+// memory is the address of the last track + 1.
+template<int NLanes>
+void TrackQualityFromTrackBuilder(
+    const BXType bx,
+    const TrackFit::TrackWord trackWord[kMaxProc],
+    const TrackFit::BarrelStubWord barrelStubWords[][kMaxProc],
+    const TrackFit::DiskStubWord diskStubWords[][kMaxProc],
+    BXType& bx_o,
+    TrackQualityMemory* const scoredTracks
+)
+{
+  ap_uint<kNBits_MemAddr + 1> ntracks = 0;
+
+  track_loop: for (int i = 0; i < (kMaxProc + NLanes - 1) / NLanes; i++) {
+#pragma HLS pipeline II=1 rewind
+    lanes: for (int j = 0; j < NLanes; j++) {
+#pragma HLS unroll
+      const int addr = i * NLanes + j;
+      if (addr < kMaxProc && trackWord[addr][TrackFit::kTrackWordSize - 1]) {
+        TrackFit::BarrelStubWord barrelStubs[TrackFit::kNBarrelStubs];
+        TrackFit::DiskStubWord diskStubs[TrackFit::kNDiskStubs];
+#pragma HLS array_partition variable=barrelStubs complete
+#pragma HLS array_partition variable=diskStubs complete
+        barrel_stubs: for (int k = 0; k < TrackFit::kNBarrelStubs; k++) {
+#pragma HLS unroll
+          barrelStubs[k] = barrelStubWords[k][addr];
+        }
+        disk_stubs: for (int k = 0; k < TrackFit::kNDiskStubs; k++) {
+#pragma HLS unroll
+          diskStubs[k] = diskStubWords[k][addr];
+        }
+        scoredTracks->write_mem(bx, TQ::Score(TQ::ToTTTrack(trackWord[addr], barrelStubs, diskStubs)), addr);
+        ntracks = addr + 1;
+      }
+    }
+  }
+  scoredTracks->setEntries(bx, ntracks);
+
+  bx_o = bx;
+}
+
+#endif
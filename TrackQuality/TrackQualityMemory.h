@@ -91,7 +91,7 @@ public:
           const TTChi2rz chi2rz, const TTBendChi2 bendchi2, const TTHitPattern hitpattern,
           const TTMVATQ mvatq, const TTMVAres mvares, const TTTkValid tkvalid):
 
-    data_( (((((((((((invr,phi),tanl),z0),d0),chi2rphi),chi2rz),bendchi2),hitpattern),mvatq),mvares),tkvalid) )
+    data_( (((((((((((tkvalid,mvares),mvatq),hitpattern),bendchi2),chi2rz),chi2rphi),d0),z0),tanl),phi),invr) )
   {}
 
   #ifndef __SYNTHESIS__
@@ -223,6 +223,9 @@ private:
 
 };
 
+// Memory of the tracks of each BX, read and written by TrackQualityMemoryTop
+typedef MemoryTemplate<TTTrack, 1, kNBits_MemAddr> TrackQualityMemory;
+
 
 
 #endif
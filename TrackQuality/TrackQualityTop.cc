@@ -1,5 +1,6 @@
 #include "BDT.h"
 #include "parameters.h"
+#include "parameters_static.h"
 #include "TrackQualityTop.h"
 #include "TrackQualityMemory.h"
 #include "TracktoFeature.h"
@@ -11,5 +12,24 @@ void TrackQualityTop(const TTTrack& Track,score_arr_t score,score_t tree_scores[
     #pragma HLS array_partition variable=x
 	#pragma HLS pipeline
 	#pragma HLS unroll
-    bdt.decision_function(x, score, tree_scores);
+    bdt_static.decision_function(x, score, tree_scores);
+}
+
+void TrackQualityMemoryTop(const BXType bx, const TrackQualityMemory* const tracks, BXType& bx_o, TrackQualityMemory* const scoredTracks){
+    #pragma HLS interface register port=bx_o
+    #pragma HLS array_partition variable=tracks->get_mem() cyclic factor=kNTQLanes dim=2
+    #pragma HLS array_partition variable=scoredTracks->get_mem() cyclic factor=kNTQLanes dim=2
+    #pragma HLS resource variable=tracks->get_mem() latency=2
+    TrackQuality<kNTQLanes>(bx, tracks, bx_o, scoredTracks);
+}
+
+void TrackBuilderTrackQualityTop(const BXType bx, const TrackFit::TrackWord trackWord[kMaxProc], const TrackFit::BarrelStubWord barrelStubWords[][kMaxProc], const TrackFit::DiskStubWord diskStubWords[][kMaxProc], BXType& bx_o, TrackQualityMemory* const scoredTracks){
+    #pragma HLS interface register port=bx_o
+    #pragma HLS array_partition variable=trackWord cyclic factor=kNTQLanes dim=1
+    #pragma HLS array_partition variable=barrelStubWords complete dim=1
+    #pragma HLS array_partition variable=barrelStubWords cyclic factor=kNTQLanes dim=2
+    #pragma HLS array_partition variable=diskStubWords complete dim=1
+    #pragma HLS array_partition variable=diskStubWords cyclic factor=kNTQLanes dim=2
+    #pragma HLS array_partition variable=scoredTracks->get_mem() cyclic factor=kNTQLanes dim=2
+    TrackQualityFromTrackBuilder<kNTQLanes>(bx, trackWord, barrelStubWords, diskStubWords, bx_o, scoredTracks);
 }
@@ -4,6 +4,7 @@
 #include "BDT.h"
 #include "parameters.h"
 #include "TrackQualityMemory.h"
+#include "TrackQuality.h"
 
 
 // Prototype of top level function for C-synthesis
@@ -11,4 +12,25 @@ void TrackQualityTop(
 	const TTTrack& Track,
 	score_arr_t score,
 	score_t tree_scores[BDT::fn_classes(n_classes) * n_trees]);
+
+// Number of tracks scored per clock by TrackQualityMemoryTop
+constexpr int kNTQLanes = 2;
+
+// Top level function scoring the tracks of a BX in a track memory, see
+// TrackQuality in TrackQuality.h
+void TrackQualityMemoryTop(
+	const BXType bx,
+	const TrackQualityMemory* const tracks,
+	BXType& bx_o,
+	TrackQualityMemory* const scoredTracks);
+
+// Top level function scoring the tracks of a BX written by TrackBuilder_L1L2,
+// see TrackQualityFromTrackBuilder in TrackQuality.h
+void TrackBuilderTrackQualityTop(
+	const BXType bx,
+	const TrackFit::TrackWord trackWord[kMaxProc],
+	const TrackFit::BarrelStubWord barrelStubWords[][kMaxProc],
+	const TrackFit::DiskStubWord diskStubWords[][kMaxProc],
+	BXType& bx_o,
+	TrackQualityMemory* const scoredTracks);
 #endif
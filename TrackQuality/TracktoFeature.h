@@ -6,7 +6,7 @@
 #include "parameters.h"
 #include "TrackQualityMemory.h"
 
-void FeatureTransform(const TTTrack& Track, input_arr_t transformed_features) {
+inline void FeatureTransform(const TTTrack& Track, input_arr_t transformed_features) {
 
     //Proper track parameter representations tbc
     //All track parameters are shown here through strictly only some are needed for this particular model
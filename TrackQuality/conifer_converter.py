@@ -1,8 +1,98 @@
 from conifer import conifer
 import joblib
 import numpy as np
+import os
+import re
 import sys
 
+# Usage: python conifer_converter.py <model file> [--static]
+# With --static, parameters_static.h is also written next to parameters.h, see
+# writeStaticParameters.
+staticTrees = "--static" in sys.argv[2:]
+
+def structMembers(header, name):
+    """Names of the data members of struct name in header, in the order in
+    which they are declared, i.e. in which they are initialised"""
+    body = re.search(r"struct " + name + r"\s*\{(.*?)decision_function", header, re.S).group(1)
+    return re.findall(r"^\s*[\w:<>, ]+?\s+(\w+)(?:\[[^;]*\])?;", body, re.M)
+
+def parseInitializer(text):
+    """The values of the brace initializer at the start of text, as nested lists
+    of strings"""
+    stack = [[]]
+    for token in re.findall(r"[{}]|[^{},\s]+", text):
+        if token == "{":
+            stack.append([])
+        elif token == "}":
+            values = stack.pop()
+            stack[-1].append(values)
+            if len(stack) == 1:
+                return values
+        else:
+            stack[-1].append(token)
+    raise ValueError("Unterminated initializer")
+
+def writeStaticParameters(parametersFileName, staticFileName):
+    """Writes the trees of the BDT of parameters.h as code: the decision_function
+    of BDT::StaticTree<i, j> is the comparisons on the paths to the leaves of the
+    tree of class j of tree i, with the features, thresholds and values of
+    parameters.h as constants, and bdt_static is the BDT::StaticBDT with the
+    normalisation and initial predictions of bdt. The members of BDT::BDT and
+    BDT::Tree are taken by name from the BDT.h next to parameters.h."""
+    parameters = re.sub(r"//.*", "", open(parametersFileName).read())
+    header = re.sub(r"//.*", "", open(os.path.join(os.path.dirname(parametersFileName), "BDT.h")).read())
+
+    constants = dict(re.findall(r"static const int (\w+) = (\d+);", parameters))
+    n_trees = int(constants["n_trees"])
+    n_classes = int(constants["n_classes"])
+    n_class_trees = 1 if n_classes == 2 else n_classes  # BDT::fn_classes
+
+    match = re.search(r"static const BDT::BDT<[^;=]*> bdt\s*=", parameters)
+    bdt = dict(zip(structMembers(header, "BDT"), parseInitializer(parameters[match.end():])))
+    normalisation = bdt["normalisation"]
+    init_predict = "{" + ",".join(bdt["init_predict"]) + "}"
+    if len(bdt["trees"]) != n_trees or any(len(classes) != n_class_trees for classes in bdt["trees"]):
+        raise ValueError("bdt does not have n_trees x fn_classes(n_classes) trees")
+    treeMembers = structMembers(header, "Tree")
+    trees = [(i, j, dict(zip(treeMembers, tree)))
+             for i, classes in enumerate(bdt["trees"]) for j, tree in enumerate(classes)]
+
+    def node(tree, n, indent):
+        if tree["children_left"][n] == "-1":  # leaf
+            return [indent + "return score_t(" + tree["value"][n] + ");"]
+        return ([indent + "if(x[" + tree["feature"][n] + "] <= threshold_t(" + tree["threshold"][n] + ")){"] +
+                node(tree, int(tree["children_left"][n]), indent + "\t") +
+                [indent + "}else{"] +
+                node(tree, int(tree["children_right"][n]), indent + "\t") +
+                [indent + "}"])
+
+    with open(staticFileName, "w") as wf:
+        wf.write("#ifndef BDT_STATIC_PARAMS_H__\n"
+                 "#define BDT_STATIC_PARAMS_H__\n"
+                 "\n"
+                 "// Trees of parameters.h as code, written by conifer_converter.py --static\n"
+                 "#include \"StaticBDT.h\"\n"
+                 "#include \"parameters.h\"\n"
+                 "\n"
+                 "namespace BDT{\n")
+        for i, j, tree in trees:
+            wf.write("\n"
+                     "// trees[" + str(i) + "][" + str(j) + "]\n"
+                     "template<>\n"
+                     "inline score_t StaticTree<" + str(i) + ", " + str(j) + ", input_arr_t, score_t>::decision_function(input_arr_t x){\n"
+                     "\t#pragma HLS inline\n")
+            wf.write("\n".join(node(tree, 0, "\t")) + "\n}\n")
+        wf.write("\n"
+                 "}\n"
+                 "\n"
+                 "static const BDT::StaticBDT<n_trees, n_classes, input_arr_t, score_t> bdt_static =\n"
+                 "{ // The struct\n"
+                 "\t" + normalisation + ", // The normalisation\n"
+                 "\t" + init_predict + "\n"
+                 "};\n"
+                 "\n"
+                 "#endif\n")
+
 bdt_model = joblib.load(sys.argv[1]) 
 print("Model File Loaded")
 
@@ -44,6 +134,11 @@ except:
 simmodel.compile()
 print("Simulation Model Compiled")
 
+if staticTrees:
+    firmwareDir = os.path.join(simcfg['OutputDir'], "firmware")
+    writeStaticParameters(os.path.join(firmwareDir, "parameters.h"), os.path.join(firmwareDir, "parameters_static.h"))
+    print("Static Trees Written")
+
 predictions = simmodel.decision_function(features)
 with open("conifer_predictions.dat",'w') as wf:
     [wf.write(str(pidx) + "\n") for pidx in predictions] #Create new file with conifer predictions for each track
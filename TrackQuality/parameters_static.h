@@ -0,0 +1,3518 @@
+#ifndef BDT_STATIC_PARAMS_H__
+#define BDT_STATIC_PARAMS_H__
+
+// Trees of parameters.h as code, written by conifer_converter.py --static
+#include "StaticBDT.h"
+#include "parameters.h"
+
+namespace BDT{
+
+// trees[0][0]
+template<>
+inline score_t StaticTree<0, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[3] <= threshold_t(72.0)){
+		if(x[0] <= threshold_t(56.0)){
+			if(x[4] <= threshold_t(37.3417969)){
+				return score_t(-0.758114755);
+			}else{
+				return score_t(0.200134546);
+			}
+		}else{
+			if(x[5] <= threshold_t(49.3857422)){
+				return score_t(-1.16726196);
+			}else{
+				return score_t(-0.561773479);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(76.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(1.09898603);
+			}else{
+				return score_t(-0.750995934);
+			}
+		}else{
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.147760391);
+			}else{
+				return score_t(-0.919633031);
+			}
+		}
+	}
+}
+
+// trees[1][0]
+template<>
+inline score_t StaticTree<1, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(56.0)){
+		if(x[1] <= threshold_t(68.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(0.669148684);
+			}else{
+				return score_t(-0.699031174);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.149765387);
+			}else{
+				return score_t(-0.451765776);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(60.0)){
+				return score_t(0.281113654);
+			}else{
+				return score_t(-0.444491982);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.4121094)){
+				return score_t(-0.778364658);
+			}else{
+				return score_t(-0.563873291);
+			}
+		}
+	}
+}
+
+// trees[2][0]
+template<>
+inline score_t StaticTree<2, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[3] <= threshold_t(72.0)){
+		if(x[5] <= threshold_t(47.8681641)){
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(-0.203527316);
+			}else{
+				return score_t(-0.635220826);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.698502302);
+			}else{
+				return score_t(-0.394960612);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(92.0)){
+			if(x[1] <= threshold_t(52.0)){
+				return score_t(0.570625484);
+			}else{
+				return score_t(0.26033935);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.0476789922);
+			}else{
+				return score_t(-0.40559411);
+			}
+		}
+	}
+}
+
+// trees[3][0]
+template<>
+inline score_t StaticTree<3, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(40.0)){
+		if(x[1] <= threshold_t(84.0)){
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.364614666);
+			}else{
+				return score_t(-0.160500228);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.0821359903);
+			}else{
+				return score_t(-0.244677544);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[5] <= threshold_t(46.421875)){
+				return score_t(-0.405541897);
+			}else{
+				return score_t(0.0590339229);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(0.279202223);
+			}else{
+				return score_t(-0.302579731);
+			}
+		}
+	}
+}
+
+// trees[4][0]
+template<>
+inline score_t StaticTree<4, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(68.0)){
+		if(x[1] <= threshold_t(36.0)){
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.496190965);
+			}else{
+				return score_t(0.146982253);
+			}
+		}else{
+			if(x[5] <= threshold_t(46.6806641)){
+				return score_t(-0.0670023188);
+			}else{
+				return score_t(0.249311671);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[4] <= threshold_t(40.9550781)){
+				return score_t(-0.516845942);
+			}else{
+				return score_t(-0.291973114);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(0.587412119);
+			}else{
+				return score_t(-0.231423348);
+			}
+		}
+	}
+}
+
+// trees[5][0]
+template<>
+inline score_t StaticTree<5, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(88.0)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(0.0805725008);
+			}else{
+				return score_t(-0.176089823);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.6738281)){
+				return score_t(0.312617064);
+			}else{
+				return score_t(0.0573942624);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(40.8378906)){
+			if(x[5] <= threshold_t(36.296875)){
+				return score_t(-0.625860751);
+			}else{
+				return score_t(-0.526721001);
+			}
+		}else{
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(-0.0894758925);
+			}else{
+				return score_t(-0.441439807);
+			}
+		}
+	}
+}
+
+// trees[6][0]
+template<>
+inline score_t StaticTree<6, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(23.125)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[6] <= threshold_t(20.75)){
+				return score_t(-0.678627551);
+			}else{
+				return score_t(-0.411922902);
+			}
+		}else{
+			if(x[6] <= threshold_t(19.53125)){
+				return score_t(-0.516862333);
+			}else{
+				return score_t(-0.12106435);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(41.3125)){
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.0839154869);
+			}else{
+				return score_t(-0.173195839);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.578270078);
+			}else{
+				return score_t(-0.213891134);
+			}
+		}
+	}
+}
+
+// trees[7][0]
+template<>
+inline score_t StaticTree<7, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(51.6630859)){
+		if(x[1] <= threshold_t(44.0)){
+			if(x[1] <= threshold_t(20.0)){
+				return score_t(0.399187565);
+			}else{
+				return score_t(0.128510833);
+			}
+		}else{
+			if(x[0] <= threshold_t(24.0)){
+				return score_t(0.095256649);
+			}else{
+				return score_t(-0.0834683031);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(60.0)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.358787477);
+			}else{
+				return score_t(0.100311898);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.207848445);
+			}else{
+				return score_t(0.0599966682);
+			}
+		}
+	}
+}
+
+// trees[8][0]
+template<>
+inline score_t StaticTree<8, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(88.0)){
+		if(x[1] <= threshold_t(108.0)){
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(0.0352161862);
+			}else{
+				return score_t(-0.293664098);
+			}
+		}else{
+			if(x[4] <= threshold_t(32.6855469)){
+				return score_t(-0.704935193);
+			}else{
+				return score_t(-0.246990427);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(42.1972656)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.406414092);
+			}else{
+				return score_t(0.0898024216);
+			}
+		}else{
+			if(x[5] <= threshold_t(46.3417969)){
+				return score_t(0.25110665);
+			}else{
+				return score_t(-0.462050736);
+			}
+		}
+	}
+}
+
+// trees[9][0]
+template<>
+inline score_t StaticTree<9, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.2011719)){
+		if(x[1] <= threshold_t(76.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.684419453);
+			}else{
+				return score_t(0.368693858);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(-0.849913836);
+			}else{
+				return score_t(-0.669156671);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(43.125)){
+			if(x[6] <= threshold_t(25.28125)){
+				return score_t(-0.155863196);
+			}else{
+				return score_t(0.0310090017);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.448564738);
+			}else{
+				return score_t(0.0870929211);
+			}
+		}
+	}
+}
+
+// trees[10][0]
+template<>
+inline score_t StaticTree<10, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(36.1630859)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(-0.158543497);
+			}else{
+				return score_t(-0.309203476);
+			}
+		}else{
+			if(x[4] <= threshold_t(36.8105469)){
+				return score_t(0.247315079);
+			}else{
+				return score_t(-0.0243508071);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(38.5019531)){
+			if(x[5] <= threshold_t(36.8955078)){
+				return score_t(0.0212420654);
+			}else{
+				return score_t(0.2757442);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.5371094)){
+				return score_t(-0.158846676);
+			}else{
+				return score_t(0.0367744826);
+			}
+		}
+	}
+}
+
+// trees[11][0]
+template<>
+inline score_t StaticTree<11, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(28.0)){
+		if(x[2] <= threshold_t(60.0)){
+			if(x[5] <= threshold_t(38.609375)){
+				return score_t(0.316399157);
+			}else{
+				return score_t(0.12773101);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.169149145);
+			}else{
+				return score_t(-0.370654196);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(41.6806641)){
+			if(x[5] <= threshold_t(38.7792969)){
+				return score_t(-0.0208572801);
+			}else{
+				return score_t(-0.0990572944);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.075485982);
+			}else{
+				return score_t(0.0838804916);
+			}
+		}
+	}
+}
+
+// trees[12][0]
+template<>
+inline score_t StaticTree<12, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(38.34375)){
+		if(x[6] <= threshold_t(20.15625)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.420497954);
+			}else{
+				return score_t(-0.041165784);
+			}
+		}else{
+			if(x[4] <= threshold_t(33.6542969)){
+				return score_t(-0.0689272732);
+			}else{
+				return score_t(0.0313762948);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[4] <= threshold_t(42.5097656)){
+				return score_t(-0.23838751);
+			}else{
+				return score_t(0.122381926);
+			}
+		}else{
+			if(x[4] <= threshold_t(40.8808594)){
+				return score_t(0.0346309505);
+			}else{
+				return score_t(-0.144160271);
+			}
+		}
+	}
+}
+
+// trees[13][0]
+template<>
+inline score_t StaticTree<13, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(72.0)){
+		if(x[0] <= threshold_t(56.0)){
+			if(x[4] <= threshold_t(37.3574219)){
+				return score_t(0.04717087);
+			}else{
+				return score_t(-0.0467337295);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.0253906)){
+				return score_t(-0.0830227137);
+			}else{
+				return score_t(0.262792408);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(37.0917969)){
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(-0.194944799);
+			}else{
+				return score_t(-0.3681297);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.110149309);
+			}else{
+				return score_t(-0.178536355);
+			}
+		}
+	}
+}
+
+// trees[14][0]
+template<>
+inline score_t StaticTree<14, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(28.0)){
+		if(x[5] <= threshold_t(36.546875)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(-0.0219215192);
+			}else{
+				return score_t(-0.22514382);
+			}
+		}else{
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.0812170804);
+			}else{
+				return score_t(0.2605097);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[4] <= threshold_t(35.0761719)){
+				return score_t(-0.135852695);
+			}else{
+				return score_t(-0.00197231886);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.4472656)){
+				return score_t(0.0889637396);
+			}else{
+				return score_t(-0.0844020247);
+			}
+		}
+	}
+}
+
+// trees[15][0]
+template<>
+inline score_t StaticTree<15, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.1621094)){
+		if(x[1] <= threshold_t(76.0)){
+			if(x[4] <= threshold_t(32.0605469)){
+				return score_t(-0.909806788);
+			}else{
+				return score_t(0.0326663889);
+			}
+		}else{
+			if(x[0] <= threshold_t(72.0)){
+				return score_t(-0.634162664);
+			}else{
+				return score_t(-0.413451105);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(108.0)){
+			if(x[2] <= threshold_t(84.0)){
+				return score_t(0.0101452498);
+			}else{
+				return score_t(-0.266255617);
+			}
+		}else{
+			if(x[5] <= threshold_t(35.0917969)){
+				return score_t(-0.366811216);
+			}else{
+				return score_t(-0.0941940695);
+			}
+		}
+	}
+}
+
+// trees[16][0]
+template<>
+inline score_t StaticTree<16, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(51.984375)){
+		if(x[6] <= threshold_t(45.3125)){
+			if(x[4] <= threshold_t(42.8222656)){
+				return score_t(-0.0112008983);
+			}else{
+				return score_t(0.148131996);
+			}
+		}else{
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(-0.384884149);
+			}else{
+				return score_t(0.71805203);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(36.0)){
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.313890725);
+			}else{
+				return score_t(0.0466365777);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0143666249);
+			}else{
+				return score_t(0.154311463);
+			}
+		}
+	}
+}
+
+// trees[17][0]
+template<>
+inline score_t StaticTree<17, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(104.0)){
+		if(x[0] <= threshold_t(24.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.159900427);
+			}else{
+				return score_t(-0.00134792854);
+			}
+		}else{
+			if(x[6] <= threshold_t(18.09375)){
+				return score_t(-0.33348155);
+			}else{
+				return score_t(-0.00344073214);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(40.7255859)){
+			if(x[4] <= threshold_t(41.9707031)){
+				return score_t(-0.648149848);
+			}else{
+				return score_t(-0.37211147);
+			}
+		}else{
+			if(x[5] <= threshold_t(46.7519531)){
+				return score_t(-0.04858578);
+			}else{
+				return score_t(-0.670883298);
+			}
+		}
+	}
+}
+
+// trees[18][0]
+template<>
+inline score_t StaticTree<18, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(88.0)){
+		if(x[4] <= threshold_t(32.1230469)){
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.128147215);
+			}else{
+				return score_t(-0.517335951);
+			}
+		}else{
+			if(x[6] <= threshold_t(27.28125)){
+				return score_t(-0.033718951);
+			}else{
+				return score_t(0.0116020953);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(44.0)){
+			if(x[5] <= threshold_t(47.8681641)){
+				return score_t(0.0244898815);
+			}else{
+				return score_t(-0.269790798);
+			}
+		}else{
+			if(x[4] <= threshold_t(40.6152344)){
+				return score_t(-0.243916124);
+			}else{
+				return score_t(-0.0614363663);
+			}
+		}
+	}
+}
+
+// trees[19][0]
+template<>
+inline score_t StaticTree<19, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(35.6875)){
+		if(x[2] <= threshold_t(76.0)){
+			if(x[6] <= threshold_t(21.53125)){
+				return score_t(-0.112832427);
+			}else{
+				return score_t(0.0131908152);
+			}
+		}else{
+			if(x[6] <= threshold_t(20.8125)){
+				return score_t(0.999537647);
+			}else{
+				return score_t(-0.124888204);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(38.7167969)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0562705919);
+			}else{
+				return score_t(-0.0765547603);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.15718025);
+			}else{
+				return score_t(-0.0345426574);
+			}
+		}
+	}
+}
+
+// trees[20][0]
+template<>
+inline score_t StaticTree<20, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(52.0)){
+		if(x[4] <= threshold_t(33.2363281)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.159506723);
+			}else{
+				return score_t(0.475693643);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.0546468981);
+			}else{
+				return score_t(-0.124460369);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(68.0)){
+			if(x[4] <= threshold_t(33.7441406)){
+				return score_t(0.287548602);
+			}else{
+				return score_t(-0.139370307);
+			}
+		}else{
+			if(x[4] <= threshold_t(32.5722656)){
+				return score_t(-0.211309075);
+			}else{
+				return score_t(0.00899878237);
+			}
+		}
+	}
+}
+
+// trees[21][0]
+template<>
+inline score_t StaticTree<21, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(42.9355469)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[4] <= threshold_t(35.7207031)){
+				return score_t(-0.168255448);
+			}else{
+				return score_t(0.0411190465);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.0878906)){
+				return score_t(0.0617836714);
+			}else{
+				return score_t(-0.0712204203);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.386255503);
+			}else{
+				return score_t(0.975660443);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.295418203);
+			}else{
+				return score_t(0.525456369);
+			}
+		}
+	}
+}
+
+// trees[22][0]
+template<>
+inline score_t StaticTree<22, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(84.0)){
+		if(x[5] <= threshold_t(38.6806641)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(0.0351967886);
+			}else{
+				return score_t(0.15067403);
+			}
+		}else{
+			if(x[5] <= threshold_t(41.9755859)){
+				return score_t(-0.137304768);
+			}else{
+				return score_t(0.0174106695);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(33.0371094)){
+			if(x[4] <= threshold_t(32.3496094)){
+				return score_t(-0.429855585);
+			}else{
+				return score_t(-0.1383591);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.3457031)){
+				return score_t(0.0419194214);
+			}else{
+				return score_t(-0.0517813005);
+			}
+		}
+	}
+}
+
+// trees[23][0]
+template<>
+inline score_t StaticTree<23, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(35.2255859)){
+		if(x[2] <= threshold_t(44.0)){
+			if(x[4] <= threshold_t(35.2988281)){
+				return score_t(-0.0377211832);
+			}else{
+				return score_t(-0.167554855);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.063255541);
+			}else{
+				return score_t(-0.0922877863);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(39.1035156)){
+			if(x[5] <= threshold_t(44.3232422)){
+				return score_t(0.0254979338);
+			}else{
+				return score_t(-0.0651533008);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.120194443);
+			}else{
+				return score_t(-0.0127225053);
+			}
+		}
+	}
+}
+
+// trees[24][0]
+template<>
+inline score_t StaticTree<24, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(108.0)){
+		if(x[1] <= threshold_t(76.0)){
+			if(x[4] <= threshold_t(33.0292969)){
+				return score_t(0.265191644);
+			}else{
+				return score_t(-0.0299917199);
+			}
+		}else{
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0687030554);
+			}else{
+				return score_t(-0.00316350092);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(40.0)){
+			if(x[4] <= threshold_t(36.8925781)){
+				return score_t(0.0109298564);
+			}else{
+				return score_t(-0.213166505);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.0743014887);
+			}else{
+				return score_t(-0.287796825);
+			}
+		}
+	}
+}
+
+// trees[25][0]
+template<>
+inline score_t StaticTree<25, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(44.5625)){
+		if(x[0] <= threshold_t(104.0)){
+			if(x[1] <= threshold_t(12.0)){
+				return score_t(0.135146081);
+			}else{
+				return score_t(-0.00168702961);
+			}
+		}else{
+			if(x[5] <= threshold_t(41.4130859)){
+				return score_t(-0.567445695);
+			}else{
+				return score_t(-0.174047604);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(68.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.285675764);
+			}else{
+				return score_t(-0.0505633764);
+			}
+		}else{
+			if(x[4] <= threshold_t(38.6738281)){
+				return score_t(-0.12938796);
+			}else{
+				return score_t(0.717064261);
+			}
+		}
+	}
+}
+
+// trees[26][0]
+template<>
+inline score_t StaticTree<26, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(28.25)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[5] <= threshold_t(44.1005859)){
+				return score_t(-0.0578377135);
+			}else{
+				return score_t(-0.166926846);
+			}
+		}else{
+			if(x[5] <= threshold_t(48.4394531)){
+				return score_t(0.0148675554);
+			}else{
+				return score_t(0.153544515);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(36.0)){
+			if(x[5] <= threshold_t(40.7519531)){
+				return score_t(-0.0177278016);
+			}else{
+				return score_t(0.0790541172);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.0118225776);
+			}else{
+				return score_t(0.038928654);
+			}
+		}
+	}
+}
+
+// trees[27][0]
+template<>
+inline score_t StaticTree<27, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(60.0)){
+		if(x[2] <= threshold_t(60.0)){
+			if(x[5] <= threshold_t(39.3857422)){
+				return score_t(0.0926766247);
+			}else{
+				return score_t(-0.0198074616);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.292663276);
+			}else{
+				return score_t(0.0437399223);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(45.7255859)){
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(-0.0288467016);
+			}else{
+				return score_t(0.0500618927);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.0807415247);
+			}else{
+				return score_t(-0.0399330892);
+			}
+		}
+	}
+}
+
+// trees[28][0]
+template<>
+inline score_t StaticTree<28, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(32.9755859)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(44.0)){
+				return score_t(-0.362181723);
+			}else{
+				return score_t(-0.0798626095);
+			}
+		}else{
+			if(x[1] <= threshold_t(44.0)){
+				return score_t(0.198776528);
+			}else{
+				return score_t(-0.033705432);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(44.1181641)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0481837764);
+			}else{
+				return score_t(-0.00975614879);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0704624131);
+			}else{
+				return score_t(0.0260962714);
+			}
+		}
+	}
+}
+
+// trees[29][0]
+template<>
+inline score_t StaticTree<29, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(52.8945312)){
+		if(x[2] <= threshold_t(84.0)){
+			if(x[1] <= threshold_t(116.0)){
+				return score_t(-0.00280643138);
+			}else{
+				return score_t(-0.224522963);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.0020637284);
+			}else{
+				return score_t(-0.500989854);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(52.0)){
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(0.0554300733);
+			}else{
+				return score_t(-0.116383404);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.204831094);
+			}else{
+				return score_t(0.0284411702);
+			}
+		}
+	}
+}
+
+// trees[30][0]
+template<>
+inline score_t StaticTree<30, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(39.25)){
+		if(x[2] <= threshold_t(68.0)){
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.0106181893);
+			}else{
+				return score_t(0.016790146);
+			}
+		}else{
+			if(x[4] <= threshold_t(38.9550781)){
+				return score_t(-0.128690809);
+			}else{
+				return score_t(0.0996475667);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.117352836);
+			}else{
+				return score_t(0.155345634);
+			}
+		}else{
+			if(x[1] <= threshold_t(60.0)){
+				return score_t(0.148534611);
+			}else{
+				return score_t(-0.030019436);
+			}
+		}
+	}
+}
+
+// trees[31][0]
+template<>
+inline score_t StaticTree<31, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(72.0)){
+		if(x[6] <= threshold_t(19.1875)){
+			if(x[4] <= threshold_t(34.5878906)){
+				return score_t(0.371646583);
+			}else{
+				return score_t(-0.198780403);
+			}
+		}else{
+			if(x[1] <= threshold_t(12.0)){
+				return score_t(0.124305248);
+			}else{
+				return score_t(0.00496313674);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(40.9355469)){
+			if(x[5] <= threshold_t(36.1904297)){
+				return score_t(-0.142240211);
+			}else{
+				return score_t(-0.0447046757);
+			}
+		}else{
+			if(x[5] <= threshold_t(47.9658203)){
+				return score_t(0.152760834);
+			}else{
+				return score_t(-0.101570316);
+			}
+		}
+	}
+}
+
+// trees[32][0]
+template<>
+inline score_t StaticTree<32, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(38.8681641)){
+		if(x[2] <= threshold_t(52.0)){
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.0380685367);
+			}else{
+				return score_t(-0.049435962);
+			}
+		}else{
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.100795083);
+			}else{
+				return score_t(-0.0517410152);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(-0.00266909716);
+			}else{
+				return score_t(-0.0805856586);
+			}
+		}else{
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.0394832864);
+			}else{
+				return score_t(-0.0679342821);
+			}
+		}
+	}
+}
+
+// trees[33][0]
+template<>
+inline score_t StaticTree<33, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(56.0)){
+		if(x[2] <= threshold_t(52.0)){
+			if(x[4] <= threshold_t(40.9082031)){
+				return score_t(-0.00353156449);
+			}else{
+				return score_t(-0.0653247982);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.0986972079);
+			}else{
+				return score_t(0.0631360784);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[5] <= threshold_t(47.8320312)){
+				return score_t(0.161201507);
+			}else{
+				return score_t(-0.0944352522);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.0265889782);
+			}else{
+				return score_t(-0.165754169);
+			}
+		}
+	}
+}
+
+// trees[34][0]
+template<>
+inline score_t StaticTree<34, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(49.6357422)){
+		if(x[0] <= threshold_t(88.0)){
+			if(x[4] <= threshold_t(39.0058594)){
+				return score_t(-0.013510867);
+			}else{
+				return score_t(0.00734516187);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.10488265);
+			}else{
+				return score_t(0.219242826);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(52.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0460360833);
+			}else{
+				return score_t(0.0640810505);
+			}
+		}else{
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.176676735);
+			}else{
+				return score_t(0.0634332448);
+			}
+		}
+	}
+}
+
+// trees[35][0]
+template<>
+inline score_t StaticTree<35, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(45.796875)){
+		if(x[5] <= threshold_t(44.3417969)){
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(0.00366926123);
+			}else{
+				return score_t(-0.150217816);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.131856591);
+			}else{
+				return score_t(0.0498304442);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(33.2636719)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0658576265);
+			}else{
+				return score_t(-0.259237409);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.0438902527);
+			}else{
+				return score_t(0.0403995812);
+			}
+		}
+	}
+}
+
+// trees[36][0]
+template<>
+inline score_t StaticTree<36, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(60.0)){
+		if(x[4] <= threshold_t(39.1230469)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.227426723);
+			}else{
+				return score_t(0.0881579518);
+			}
+		}else{
+			if(x[5] <= threshold_t(38.2167969)){
+				return score_t(0.0904914141);
+			}else{
+				return score_t(0.0234717913);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(56.0)){
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.0994946957);
+			}else{
+				return score_t(-0.00653695455);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0757703707);
+			}else{
+				return score_t(-0.0382297114);
+			}
+		}
+	}
+}
+
+// trees[37][0]
+template<>
+inline score_t StaticTree<37, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(37.3300781)){
+		if(x[0] <= threshold_t(40.0)){
+			if(x[5] <= threshold_t(38.7705078)){
+				return score_t(0.0854709446);
+			}else{
+				return score_t(0.00350318057);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.084629111);
+			}else{
+				return score_t(0.0300263539);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(40.4755859)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.00194562541);
+			}else{
+				return score_t(-0.138561383);
+			}
+		}else{
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(0.0463259257);
+			}else{
+				return score_t(-0.00447511533);
+			}
+		}
+	}
+}
+
+// trees[38][0]
+template<>
+inline score_t StaticTree<38, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(36.8144531)){
+		if(x[2] <= threshold_t(52.0)){
+			if(x[4] <= threshold_t(38.5527344)){
+				return score_t(-0.00840916578);
+			}else{
+				return score_t(-0.0831027478);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0833066478);
+			}else{
+				return score_t(0.0650160387);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(38.3857422)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.00268177595);
+			}else{
+				return score_t(0.164491504);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.0183070693);
+			}else{
+				return score_t(0.02872351);
+			}
+		}
+	}
+}
+
+// trees[39][0]
+template<>
+inline score_t StaticTree<39, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(108.0)){
+		if(x[4] <= threshold_t(36.1855469)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.00554024847);
+			}else{
+				return score_t(-0.109233744);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0285477042);
+			}else{
+				return score_t(-0.00229768874);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(36.6191406)){
+			if(x[5] <= threshold_t(38.5107422)){
+				return score_t(-0.135999471);
+			}else{
+				return score_t(0.0222494248);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(-0.260253549);
+			}else{
+				return score_t(0.0389460325);
+			}
+		}
+	}
+}
+
+// trees[40][0]
+template<>
+inline score_t StaticTree<40, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(104.0)){
+		if(x[5] <= threshold_t(57.1806641)){
+			if(x[5] <= threshold_t(47.4931641)){
+				return score_t(0.00223957747);
+			}else{
+				return score_t(-0.0171670616);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(0.332792342);
+			}else{
+				return score_t(0.00872048642);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(40.0917969)){
+			if(x[4] <= threshold_t(42.1035156)){
+				return score_t(-0.598738074);
+			}else{
+				return score_t(-0.147914946);
+			}
+		}else{
+			if(x[5] <= threshold_t(47.890625)){
+				return score_t(0.006423824);
+			}else{
+				return score_t(-0.5213691);
+			}
+		}
+	}
+}
+
+// trees[41][0]
+template<>
+inline score_t StaticTree<41, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.0957031)){
+		if(x[5] <= threshold_t(38.5917969)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.804828823);
+			}else{
+				return score_t(-0.24931848);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.291263103);
+			}else{
+				return score_t(-0.262878269);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(33.7880859)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0389201194);
+			}else{
+				return score_t(0.0490560196);
+			}
+		}else{
+			if(x[5] <= threshold_t(34.171875)){
+				return score_t(-0.056203261);
+			}else{
+				return score_t(-0.00165891147);
+			}
+		}
+	}
+}
+
+// trees[42][0]
+template<>
+inline score_t StaticTree<42, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(72.0)){
+		if(x[0] <= threshold_t(56.0)){
+			if(x[1] <= threshold_t(28.0)){
+				return score_t(0.0584243573);
+			}else{
+				return score_t(-0.00472579012);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.0817701444);
+			}else{
+				return score_t(-0.0800196677);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(68.0)){
+			if(x[5] <= threshold_t(46.7880859)){
+				return score_t(-0.0201071408);
+			}else{
+				return score_t(-0.108258583);
+			}
+		}else{
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0510166138);
+			}else{
+				return score_t(0.239298716);
+			}
+		}
+	}
+}
+
+// trees[43][0]
+template<>
+inline score_t StaticTree<43, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(36.0)){
+		if(x[5] <= threshold_t(51.2695312)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.151335731);
+			}else{
+				return score_t(0.0318187475);
+			}
+		}else{
+			if(x[4] <= threshold_t(35.8808594)){
+				return score_t(0.53489387);
+			}else{
+				return score_t(0.131738618);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(44.0)){
+			if(x[4] <= threshold_t(35.6933594)){
+				return score_t(0.233517021);
+			}else{
+				return score_t(0.033536572);
+			}
+		}else{
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(-0.000473606313);
+			}else{
+				return score_t(0.0531536005);
+			}
+		}
+	}
+}
+
+// trees[44][0]
+template<>
+inline score_t StaticTree<44, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(42.8769531)){
+		if(x[4] <= threshold_t(32.2519531)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0320618525);
+			}else{
+				return score_t(-0.383642882);
+			}
+		}else{
+			if(x[4] <= threshold_t(32.5371094)){
+				return score_t(0.0623720512);
+			}else{
+				return score_t(-0.00369184813);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.281127065);
+			}else{
+				return score_t(-0.43556121);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.284911066);
+			}else{
+				return score_t(-0.0234948006);
+			}
+		}
+	}
+}
+
+// trees[45][0]
+template<>
+inline score_t StaticTree<45, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(33.75)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0544609353);
+			}else{
+				return score_t(-0.0672565848);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.0440880172);
+			}else{
+				return score_t(0.0194396079);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(48.5107422)){
+			if(x[5] <= threshold_t(44.3144531)){
+				return score_t(-0.0062654051);
+			}else{
+				return score_t(-0.0481796563);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0448150486);
+			}else{
+				return score_t(0.0856956393);
+			}
+		}
+	}
+}
+
+// trees[46][0]
+template<>
+inline score_t StaticTree<46, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(47.8232422)){
+		if(x[5] <= threshold_t(45.9130859)){
+			if(x[2] <= threshold_t(84.0)){
+				return score_t(0.0019968159);
+			}else{
+				return score_t(-0.151674628);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.165663198);
+			}else{
+				return score_t(-0.00879957806);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[5] <= threshold_t(48.9482422)){
+				return score_t(-0.144876778);
+			}else{
+				return score_t(-0.0137769328);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.6425781)){
+				return score_t(-0.0265180226);
+			}else{
+				return score_t(0.131597295);
+			}
+		}
+	}
+}
+
+// trees[47][0]
+template<>
+inline score_t StaticTree<47, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(41.3125)){
+		if(x[6] <= threshold_t(39.75)){
+			if(x[4] <= threshold_t(36.4628906)){
+				return score_t(-0.00842081476);
+			}else{
+				return score_t(0.0056375619);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0923111364);
+			}else{
+				return score_t(-0.0154641615);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(92.0)){
+			if(x[5] <= threshold_t(50.4931641)){
+				return score_t(0.0640489385);
+			}else{
+				return score_t(0.262690067);
+			}
+		}else{
+			if(x[5] <= threshold_t(40.8857422)){
+				return score_t(0.114781015);
+			}else{
+				return score_t(-0.165594891);
+			}
+		}
+	}
+}
+
+// trees[48][0]
+template<>
+inline score_t StaticTree<48, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(36.0)){
+		if(x[4] <= threshold_t(39.7636719)){
+			if(x[5] <= threshold_t(49.5556641)){
+				return score_t(-0.11582984);
+			}else{
+				return score_t(0.113990493);
+			}
+		}else{
+			if(x[5] <= threshold_t(39.3857422)){
+				return score_t(0.0507228449);
+			}else{
+				return score_t(-0.0412531383);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(52.0)){
+			if(x[5] <= threshold_t(46.6806641)){
+				return score_t(0.0115270466);
+			}else{
+				return score_t(-0.0275210347);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.0735175014);
+			}else{
+				return score_t(0.00902076066);
+			}
+		}
+	}
+}
+
+// trees[49][0]
+template<>
+inline score_t StaticTree<49, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(42.0205078)){
+		if(x[4] <= threshold_t(40.7910156)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(0.0147251552);
+			}else{
+				return score_t(-0.0178463906);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.0255745985);
+			}else{
+				return score_t(-0.358985007);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(43.3955078)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.183979109);
+			}else{
+				return score_t(-0.00242849113);
+			}
+		}else{
+			if(x[4] <= threshold_t(41.7714844)){
+				return score_t(-0.00267323363);
+			}else{
+				return score_t(0.0417915806);
+			}
+		}
+	}
+}
+
+// trees[50][0]
+template<>
+inline score_t StaticTree<50, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(68.0)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[4] <= threshold_t(40.6933594)){
+				return score_t(-0.0630898923);
+			}else{
+				return score_t(0.0375375301);
+			}
+		}else{
+			if(x[0] <= threshold_t(72.0)){
+				return score_t(0.0604045875);
+			}else{
+				return score_t(0.418290555);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(41.4746094)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(0.00965431798);
+			}else{
+				return score_t(-0.0215689354);
+			}
+		}else{
+			if(x[5] <= threshold_t(38.4667969)){
+				return score_t(-0.174698219);
+			}else{
+				return score_t(-0.00234195171);
+			}
+		}
+	}
+}
+
+// trees[51][0]
+template<>
+inline score_t StaticTree<51, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(30.5)){
+		if(x[5] <= threshold_t(39.484375)){
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(-0.026272282);
+			}else{
+				return score_t(0.0390149839);
+			}
+		}else{
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(-0.00245691719);
+			}else{
+				return score_t(-0.0480106212);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(45.78125)){
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.00486788061);
+			}else{
+				return score_t(0.0287510213);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.7207031)){
+				return score_t(0.0685402155);
+			}else{
+				return score_t(-0.196808547);
+			}
+		}
+	}
+}
+
+// trees[52][0]
+template<>
+inline score_t StaticTree<52, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(22.9375)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.0445858948);
+			}else{
+				return score_t(0.3149046);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.283278883);
+			}else{
+				return score_t(-0.118741609);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(100.0)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.0184167586);
+			}else{
+				return score_t(0.011246278);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.9902344)){
+				return score_t(0.0273530819);
+			}else{
+				return score_t(-0.204704612);
+			}
+		}
+	}
+}
+
+// trees[53][0]
+template<>
+inline score_t StaticTree<53, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(38.1738281)){
+		if(x[0] <= threshold_t(40.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(0.0223314539);
+			}else{
+				return score_t(-0.101041488);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.0666380972);
+			}else{
+				return score_t(-0.00489018951);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(84.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0615716949);
+			}else{
+				return score_t(-0.00105358695);
+			}
+		}else{
+			if(x[5] <= threshold_t(37.6455078)){
+				return score_t(-0.317203015);
+			}else{
+				return score_t(0.0263729095);
+			}
+		}
+	}
+}
+
+// trees[54][0]
+template<>
+inline score_t StaticTree<54, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(38.8681641)){
+		if(x[1] <= threshold_t(92.0)){
+			if(x[4] <= threshold_t(34.5527344)){
+				return score_t(-0.047896143);
+			}else{
+				return score_t(0.0460001081);
+			}
+		}else{
+			if(x[4] <= threshold_t(35.2363281)){
+				return score_t(0.0267516188);
+			}else{
+				return score_t(-0.171079174);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(92.0)){
+			if(x[4] <= threshold_t(32.8652344)){
+				return score_t(0.169100448);
+			}else{
+				return score_t(-0.0279021598);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0599018782);
+			}else{
+				return score_t(0.0598210916);
+			}
+		}
+	}
+}
+
+// trees[55][0]
+template<>
+inline score_t StaticTree<55, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(108.0)){
+		if(x[5] <= threshold_t(48.5019531)){
+			if(x[1] <= threshold_t(36.0)){
+				return score_t(-0.0333272405);
+			}else{
+				return score_t(0.000621993968);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(-0.0265467856);
+			}else{
+				return score_t(0.0483076759);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(47.234375)){
+			if(x[5] <= threshold_t(44.5644531)){
+				return score_t(-0.0517740063);
+			}else{
+				return score_t(0.0884857401);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0402028151);
+			}else{
+				return score_t(-0.254830003);
+			}
+		}
+	}
+}
+
+// trees[56][0]
+template<>
+inline score_t StaticTree<56, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(39.3056641)){
+		if(x[2] <= threshold_t(44.0)){
+			if(x[4] <= threshold_t(37.6660156)){
+				return score_t(0.014559757);
+			}else{
+				return score_t(-0.0350553468);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(0.0573891848);
+			}else{
+				return score_t(-0.026628932);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[6] <= threshold_t(26.0)){
+				return score_t(-0.0772483051);
+			}else{
+				return score_t(-0.0086552389);
+			}
+		}else{
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0698276833);
+			}else{
+				return score_t(-0.0244226605);
+			}
+		}
+	}
+}
+
+// trees[57][0]
+template<>
+inline score_t StaticTree<57, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(26.375)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[5] <= threshold_t(52.1357422)){
+				return score_t(-0.0575882755);
+			}else{
+				return score_t(0.153239384);
+			}
+		}else{
+			if(x[4] <= threshold_t(38.1972656)){
+				return score_t(0.0293593425);
+			}else{
+				return score_t(0.0994659588);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(34.1542969)){
+			if(x[1] <= threshold_t(60.0)){
+				return score_t(0.124142826);
+			}else{
+				return score_t(-0.0366015732);
+			}
+		}else{
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(-0.0163101014);
+			}else{
+				return score_t(0.0200163387);
+			}
+		}
+	}
+}
+
+// trees[58][0]
+template<>
+inline score_t StaticTree<58, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(44.0)){
+		if(x[6] <= threshold_t(37.75)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.000205590171);
+			}else{
+				return score_t(0.0269799717);
+			}
+		}else{
+			if(x[5] <= threshold_t(52.0644531)){
+				return score_t(-0.0405547954);
+			}else{
+				return score_t(0.161983579);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(68.0)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.0452182852);
+			}else{
+				return score_t(0.0854844451);
+			}
+		}else{
+			if(x[5] <= threshold_t(39.8232422)){
+				return score_t(0.0240613222);
+			}else{
+				return score_t(-0.0187699217);
+			}
+		}
+	}
+}
+
+// trees[59][0]
+template<>
+inline score_t StaticTree<59, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(68.0)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(0.00706272433);
+			}else{
+				return score_t(-0.050278198);
+			}
+		}else{
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(-0.00430025253);
+			}else{
+				return score_t(0.192878902);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(42.8417969)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.147762731);
+			}else{
+				return score_t(-0.0255648941);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.215914667);
+			}else{
+				return score_t(-0.0211955607);
+			}
+		}
+	}
+}
+
+// trees[60][0]
+template<>
+inline score_t StaticTree<60, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(36.2871094)){
+		if(x[1] <= threshold_t(60.0)){
+			if(x[5] <= threshold_t(36.6894531)){
+				return score_t(-0.13679947);
+			}else{
+				return score_t(0.178386301);
+			}
+		}else{
+			if(x[6] <= threshold_t(25.28125)){
+				return score_t(0.0425309055);
+			}else{
+				return score_t(-0.0233154241);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(51.7695312)){
+			if(x[6] <= threshold_t(22.15625)){
+				return score_t(-0.0549571291);
+			}else{
+				return score_t(0.00976619124);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.3339844)){
+				return score_t(0.118457802);
+			}else{
+				return score_t(-0.047828123);
+			}
+		}
+	}
+}
+
+// trees[61][0]
+template<>
+inline score_t StaticTree<61, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(72.0)){
+		if(x[3] <= threshold_t(88.0)){
+			if(x[4] <= threshold_t(32.7988281)){
+				return score_t(-0.0778767616);
+			}else{
+				return score_t(0.0121076908);
+			}
+		}else{
+			if(x[4] <= threshold_t(32.5996094)){
+				return score_t(0.154518574);
+			}else{
+				return score_t(-0.0110910311);
+			}
+		}
+	}else{
+		if(x[2] <= threshold_t(44.0)){
+			if(x[6] <= threshold_t(34.84375)){
+				return score_t(-0.020798007);
+			}else{
+				return score_t(-0.104667239);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.0133764744);
+			}else{
+				return score_t(0.0886363983);
+			}
+		}
+	}
+}
+
+// trees[62][0]
+template<>
+inline score_t StaticTree<62, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(35.796875)){
+		if(x[1] <= threshold_t(100.0)){
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(0.0284426212);
+			}else{
+				return score_t(-0.156544492);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.3496094)){
+				return score_t(0.054541219);
+			}else{
+				return score_t(-0.270281732);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.0629653633);
+			}else{
+				return score_t(-0.00592444371);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.0347009115);
+			}else{
+				return score_t(0.0295115076);
+			}
+		}
+	}
+}
+
+// trees[63][0]
+template<>
+inline score_t StaticTree<63, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(41.0019531)){
+		if(x[0] <= threshold_t(40.0)){
+			if(x[4] <= threshold_t(38.8691406)){
+				return score_t(0.00245803827);
+			}else{
+				return score_t(-0.0511796027);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.039744325);
+			}else{
+				return score_t(0.0397637077);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(40.0917969)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(0.0109625366);
+			}else{
+				return score_t(-0.0259067751);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0469890051);
+			}else{
+				return score_t(-0.111388817);
+			}
+		}
+	}
+}
+
+// trees[64][0]
+template<>
+inline score_t StaticTree<64, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(27.09375)){
+		if(x[0] <= threshold_t(88.0)){
+			if(x[6] <= threshold_t(23.125)){
+				return score_t(0.022643555);
+			}else{
+				return score_t(-0.0239280518);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.4316406)){
+				return score_t(0.267047048);
+			}else{
+				return score_t(-0.184595406);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(76.0)){
+			if(x[4] <= threshold_t(32.6386719)){
+				return score_t(0.172885537);
+			}else{
+				return score_t(-0.0126209753);
+			}
+		}else{
+			if(x[4] <= threshold_t(33.2871094)){
+				return score_t(-0.0353164338);
+			}else{
+				return score_t(0.0118545974);
+			}
+		}
+	}
+}
+
+// trees[65][0]
+template<>
+inline score_t StaticTree<65, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(38.6777344)){
+		if(x[1] <= threshold_t(76.0)){
+			if(x[4] <= threshold_t(33.9785156)){
+				return score_t(0.0597595088);
+			}else{
+				return score_t(-0.0561089739);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(0.0176645126);
+			}else{
+				return score_t(-0.0347454511);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.0330555029);
+			}else{
+				return score_t(0.0324405432);
+			}
+		}else{
+			if(x[2] <= threshold_t(28.0)){
+				return score_t(-0.107904673);
+			}else{
+				return score_t(0.0437551737);
+			}
+		}
+	}
+}
+
+// trees[66][0]
+template<>
+inline score_t StaticTree<66, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.4511719)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(52.0)){
+				return score_t(0.0615665056);
+			}else{
+				return score_t(-0.332348377);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.205386102);
+			}else{
+				return score_t(-0.246961132);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(40.0)){
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.00138140016);
+			}else{
+				return score_t(0.04997674);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.00113468443);
+			}else{
+				return score_t(-0.0482694507);
+			}
+		}
+	}
+}
+
+// trees[67][0]
+template<>
+inline score_t StaticTree<67, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(39.2080078)){
+		if(x[0] <= threshold_t(24.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.132035121);
+			}else{
+				return score_t(0.0060214987);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.4394531)){
+				return score_t(-0.0275359694);
+			}else{
+				return score_t(0.00986897759);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(88.0)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.0127448505);
+			}else{
+				return score_t(0.0098735448);
+			}
+		}else{
+			if(x[4] <= threshold_t(38.7910156)){
+				return score_t(0.229803562);
+			}else{
+				return score_t(-0.0375299193);
+			}
+		}
+	}
+}
+
+// trees[68][0]
+template<>
+inline score_t StaticTree<68, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(76.0)){
+		if(x[5] <= threshold_t(51.0820312)){
+			if(x[5] <= threshold_t(50.7607422)){
+				return score_t(-0.00122515892);
+			}else{
+				return score_t(-0.0955112129);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0359270535);
+			}else{
+				return score_t(-0.0516173095);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0569265522);
+			}else{
+				return score_t(0.294350356);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.263990253);
+			}else{
+				return score_t(0.0362082869);
+			}
+		}
+	}
+}
+
+// trees[69][0]
+template<>
+inline score_t StaticTree<69, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.2714844)){
+		if(x[6] <= threshold_t(41.96875)){
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.175079152);
+			}else{
+				return score_t(0.0211254116);
+			}
+		}else{
+			if(x[-2] <= threshold_t(0)){
+				return score_t(-0.877328753);
+			}else{
+				return score_t(-0.877328753);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(42.7597656)){
+			if(x[4] <= threshold_t(42.0917969)){
+				return score_t(-0.00146042928);
+			}else{
+				return score_t(-0.0271363985);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0974971727);
+			}else{
+				return score_t(-0.0326903164);
+			}
+		}
+	}
+}
+
+// trees[70][0]
+template<>
+inline score_t StaticTree<70, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(32.5380859)){
+		if(x[2] <= threshold_t(52.0)){
+			if(x[6] <= threshold_t(25.40625)){
+				return score_t(-0.224252552);
+			}else{
+				return score_t(-0.0351931639);
+			}
+		}else{
+			if(x[5] <= threshold_t(32.1279297)){
+				return score_t(0.189131722);
+			}else{
+				return score_t(-0.0197050795);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(35.796875)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0201302338);
+			}else{
+				return score_t(0.0319183916);
+			}
+		}else{
+			if(x[1] <= threshold_t(44.0)){
+				return score_t(0.0220571943);
+			}else{
+				return score_t(-0.00111974031);
+			}
+		}
+	}
+}
+
+// trees[71][0]
+template<>
+inline score_t StaticTree<71, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(17.0)){
+		if(x[4] <= threshold_t(35.8261719)){
+			if(x[2] <= threshold_t(44.0)){
+				return score_t(-0.172026396);
+			}else{
+				return score_t(0.230150267);
+			}
+		}else{
+			if(x[6] <= threshold_t(16.703125)){
+				return score_t(-0.0937659815);
+			}else{
+				return score_t(-0.433249503);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(108.0)){
+			if(x[5] <= threshold_t(58.8583984)){
+				return score_t(-0.0022816381);
+			}else{
+				return score_t(0.449429035);
+			}
+		}else{
+			if(x[4] <= threshold_t(33.5214844)){
+				return score_t(0.0419805758);
+			}else{
+				return score_t(-0.0521999076);
+			}
+		}
+	}
+}
+
+// trees[72][0]
+template<>
+inline score_t StaticTree<72, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(42.0917969)){
+		if(x[2] <= threshold_t(60.0)){
+			if(x[1] <= threshold_t(108.0)){
+				return score_t(0.00687959231);
+			}else{
+				return score_t(-0.0344009697);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0822124332);
+			}else{
+				return score_t(0.0305701196);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0543446206);
+			}else{
+				return score_t(-0.179441497);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.0615132451);
+			}else{
+				return score_t(0.212573066);
+			}
+		}
+	}
+}
+
+// trees[73][0]
+template<>
+inline score_t StaticTree<73, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(41.1875)){
+		if(x[0] <= threshold_t(104.0)){
+			if(x[6] <= threshold_t(40.875)){
+				return score_t(-0.0013485417);
+			}else{
+				return score_t(-0.0726915598);
+			}
+		}else{
+			if(x[4] <= threshold_t(35.4902344)){
+				return score_t(0.400251657);
+			}else{
+				return score_t(-0.330599189);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(34.8300781)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.343380958);
+			}else{
+				return score_t(0.0501164608);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.0018327398);
+			}else{
+				return score_t(0.116632491);
+			}
+		}
+	}
+}
+
+// trees[74][0]
+template<>
+inline score_t StaticTree<74, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(34.3681641)){
+		if(x[5] <= threshold_t(34.3505859)){
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(-0.00123496866);
+			}else{
+				return score_t(-0.0533787124);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.7050781)){
+				return score_t(-0.477991998);
+			}else{
+				return score_t(-0.167864785);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(42.9472656)){
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.00290799025);
+			}else{
+				return score_t(0.00965377875);
+			}
+		}else{
+			if(x[5] <= threshold_t(35.234375)){
+				return score_t(0.315944016);
+			}else{
+				return score_t(-0.117987148);
+			}
+		}
+	}
+}
+
+// trees[75][0]
+template<>
+inline score_t StaticTree<75, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(58.3144531)){
+		if(x[5] <= threshold_t(58.1621094)){
+			if(x[5] <= threshold_t(58.0195312)){
+				return score_t(0.00160908396);
+			}else{
+				return score_t(-0.343539417);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.481369764);
+			}else{
+				return score_t(-0.221749157);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(23.28125)){
+			if(x[5] <= threshold_t(58.4570312)){
+				return score_t(-1.21141636);
+			}else{
+				return score_t(-0.260065913);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.8164062)){
+				return score_t(-0.235861361);
+			}else{
+				return score_t(0.324065357);
+			}
+		}
+	}
+}
+
+// trees[76][0]
+template<>
+inline score_t StaticTree<76, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(42.53125)){
+		if(x[6] <= threshold_t(38.890625)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.00939815864);
+			}else{
+				return score_t(-0.00703056809);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(0.0466683246);
+			}else{
+				return score_t(-0.0223449916);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(43.0625)){
+			if(x[5] <= threshold_t(39.7792969)){
+				return score_t(-0.0301346648);
+			}else{
+				return score_t(-0.246461734);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.0298281945);
+			}else{
+				return score_t(0.196677342);
+			}
+		}
+	}
+}
+
+// trees[77][0]
+template<>
+inline score_t StaticTree<77, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(44.03125)){
+		if(x[4] <= threshold_t(36.3378906)){
+			if(x[5] <= threshold_t(51.3408203)){
+				return score_t(-0.00941868592);
+			}else{
+				return score_t(0.0687969774);
+			}
+		}else{
+			if(x[5] <= threshold_t(52.1894531)){
+				return score_t(0.0114216283);
+			}else{
+				return score_t(-0.0379493535);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(37.4042969)){
+			if(x[5] <= threshold_t(45.3095703)){
+				return score_t(0.112743109);
+			}else{
+				return score_t(-0.24908112);
+			}
+		}else{
+			if(x[5] <= threshold_t(36.0917969)){
+				return score_t(-0.249601483);
+			}else{
+				return score_t(-0.0480267964);
+			}
+		}
+	}
+}
+
+// trees[78][0]
+template<>
+inline score_t StaticTree<78, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.1933594)){
+		if(x[1] <= threshold_t(76.0)){
+			if(x[4] <= threshold_t(32.1816406)){
+				return score_t(-0.202295586);
+			}else{
+				return score_t(0.46933791);
+			}
+		}else{
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.36192748);
+			}else{
+				return score_t(0.925641);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(32.2207031)){
+			if(x[6] <= threshold_t(34.1875)){
+				return score_t(-0.369161874);
+			}else{
+				return score_t(0.0465293527);
+			}
+		}else{
+			if(x[4] <= threshold_t(33.0058594)){
+				return score_t(0.0256219078);
+			}else{
+				return score_t(-0.00183470699);
+			}
+		}
+	}
+}
+
+// trees[79][0]
+template<>
+inline score_t StaticTree<79, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[4] <= threshold_t(32.0371094)){
+		if(x[-2] <= threshold_t(0)){
+			if(x[-2] <= threshold_t(-2.0)){
+				return score_t(-0.493605524);
+			}else{
+				return score_t(-0.493605524);
+			}
+		}else{
+			if(x[-2] <= threshold_t(-2.0)){
+				return score_t(-0.493605524);
+			}else{
+				return score_t(-0.493605524);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(33.375)){
+			if(x[5] <= threshold_t(57.1357422)){
+				return score_t(0.000477600959);
+			}else{
+				return score_t(0.117275357);
+			}
+		}else{
+			if(x[4] <= threshold_t(35.9550781)){
+				return score_t(0.0069957762);
+			}else{
+				return score_t(-0.0160636008);
+			}
+		}
+	}
+}
+
+// trees[80][0]
+template<>
+inline score_t StaticTree<80, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(43.125)){
+		if(x[1] <= threshold_t(100.0)){
+			if(x[4] <= threshold_t(37.8847656)){
+				return score_t(-0.0129619138);
+			}else{
+				return score_t(0.00549505744);
+			}
+		}else{
+			if(x[5] <= threshold_t(37.9667969)){
+				return score_t(-0.0562900156);
+			}else{
+				return score_t(0.0311427116);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(100.0)){
+			if(x[6] <= threshold_t(44.03125)){
+				return score_t(0.150160268);
+			}else{
+				return score_t(0.0323770829);
+			}
+		}else{
+			if(x[4] <= threshold_t(34.5859375)){
+				return score_t(0.0629639849);
+			}else{
+				return score_t(-0.1862275);
+			}
+		}
+	}
+}
+
+// trees[81][0]
+template<>
+inline score_t StaticTree<81, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(35.1279297)){
+		if(x[1] <= threshold_t(52.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.101618983);
+			}else{
+				return score_t(0.0209585652);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(0.0282904115);
+			}else{
+				return score_t(-0.0428969599);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(36.0214844)){
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.0274184421);
+			}else{
+				return score_t(0.00848841015);
+			}
+		}else{
+			if(x[1] <= threshold_t(92.0)){
+				return score_t(-0.00203458569);
+			}else{
+				return score_t(0.0250719655);
+			}
+		}
+	}
+}
+
+// trees[82][0]
+template<>
+inline score_t StaticTree<82, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(39.0830078)){
+		if(x[4] <= threshold_t(38.6191406)){
+			if(x[6] <= threshold_t(23.34375)){
+				return score_t(0.133071288);
+			}else{
+				return score_t(0.0123411259);
+			}
+		}else{
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.0254357271);
+			}else{
+				return score_t(-0.0926255286);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(88.0)){
+			if(x[5] <= threshold_t(41.0019531)){
+				return score_t(-0.0516452231);
+			}else{
+				return score_t(-0.00351488474);
+			}
+		}else{
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.0425742567);
+			}else{
+				return score_t(-0.0229243785);
+			}
+		}
+	}
+}
+
+// trees[83][0]
+template<>
+inline score_t StaticTree<83, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[1] <= threshold_t(76.0)){
+		if(x[2] <= threshold_t(60.0)){
+			if(x[5] <= threshold_t(42.9306641)){
+				return score_t(-0.0125970002);
+			}else{
+				return score_t(0.0386840962);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.182530686);
+			}else{
+				return score_t(0.0430832691);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(43.5019531)){
+			if(x[4] <= threshold_t(38.2011719)){
+				return score_t(0.00315353693);
+			}else{
+				return score_t(0.042290654);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0538012944);
+			}else{
+				return score_t(0.0190799925);
+			}
+		}
+	}
+}
+
+// trees[84][0]
+template<>
+inline score_t StaticTree<84, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[3] <= threshold_t(88.0)){
+		if(x[1] <= threshold_t(84.0)){
+			if(x[4] <= threshold_t(34.9003906)){
+				return score_t(-0.0796107054);
+			}else{
+				return score_t(-0.000261406647);
+			}
+		}else{
+			if(x[5] <= threshold_t(43.2607422)){
+				return score_t(0.0362269208);
+			}else{
+				return score_t(-0.014849755);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(84.0)){
+			if(x[4] <= threshold_t(34.4003906)){
+				return score_t(0.196537822);
+			}else{
+				return score_t(-0.00965023786);
+			}
+		}else{
+			if(x[0] <= threshold_t(40.0)){
+				return score_t(-0.0130127883);
+			}else{
+				return score_t(-0.0955984145);
+			}
+		}
+	}
+}
+
+// trees[85][0]
+template<>
+inline score_t StaticTree<85, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(52.0)){
+		if(x[4] <= threshold_t(37.3378906)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0333798341);
+			}else{
+				return score_t(-0.00929397158);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.00785832014);
+			}else{
+				return score_t(-0.0774548575);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(47.9033203)){
+			if(x[5] <= threshold_t(40.0644531)){
+				return score_t(0.0263419747);
+			}else{
+				return score_t(-0.0310010165);
+			}
+		}else{
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(0.122126758);
+			}else{
+				return score_t(-0.0466482118);
+			}
+		}
+	}
+}
+
+// trees[86][0]
+template<>
+inline score_t StaticTree<86, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(92.0)){
+		if(x[5] <= threshold_t(42.4931641)){
+			if(x[4] <= threshold_t(39.1230469)){
+				return score_t(-0.0116760163);
+			}else{
+				return score_t(0.00916190259);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.1660156)){
+				return score_t(0.0294939056);
+			}else{
+				return score_t(-0.00419793045);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(38.015625)){
+			if(x[5] <= threshold_t(35.8242188)){
+				return score_t(-0.61673677);
+			}else{
+				return score_t(-0.285373062);
+			}
+		}else{
+			if(x[-2] <= threshold_t(0)){
+				return score_t(0.451617271);
+			}else{
+				return score_t(0.451617271);
+			}
+		}
+	}
+}
+
+// trees[87][0]
+template<>
+inline score_t StaticTree<87, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(24.09375)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[4] <= threshold_t(37.3964844)){
+				return score_t(0.035694655);
+			}else{
+				return score_t(-0.116382629);
+			}
+		}else{
+			if(x[4] <= threshold_t(36.8222656)){
+				return score_t(-0.0479222983);
+			}else{
+				return score_t(0.0505685657);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(24.75)){
+			if(x[4] <= threshold_t(38.9238281)){
+				return score_t(0.00220903452);
+			}else{
+				return score_t(0.104552686);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.00367438304);
+			}else{
+				return score_t(0.0125674699);
+			}
+		}
+	}
+}
+
+// trees[88][0]
+template<>
+inline score_t StaticTree<88, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(20.09375)){
+		if(x[1] <= threshold_t(92.0)){
+			if(x[4] <= threshold_t(36.6816406)){
+				return score_t(0.316514999);
+			}else{
+				return score_t(0.0451358892);
+			}
+		}else{
+			if(x[5] <= threshold_t(40.8232422)){
+				return score_t(0.196057826);
+			}else{
+				return score_t(-0.185613856);
+			}
+		}
+	}else{
+		if(x[6] <= threshold_t(20.8125)){
+			if(x[2] <= threshold_t(76.0)){
+				return score_t(-0.0528445281);
+			}else{
+				return score_t(-0.402555496);
+			}
+		}else{
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(-0.00209486438);
+			}else{
+				return score_t(0.0136645781);
+			}
+		}
+	}
+}
+
+// trees[89][0]
+template<>
+inline score_t StaticTree<89, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(42.5107422)){
+		if(x[5] <= threshold_t(42.1455078)){
+			if(x[1] <= threshold_t(28.0)){
+				return score_t(0.0448606163);
+			}else{
+				return score_t(-0.00441933703);
+			}
+		}else{
+			if(x[4] <= threshold_t(38.7910156)){
+				return score_t(-0.112575114);
+			}else{
+				return score_t(0.0123908445);
+			}
+		}
+	}else{
+		if(x[4] <= threshold_t(32.7480469)){
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(-0.0352673419);
+			}else{
+				return score_t(-0.250757962);
+			}
+		}else{
+			if(x[5] <= threshold_t(44.1269531)){
+				return score_t(0.0384358913);
+			}else{
+				return score_t(0.00286700111);
+			}
+		}
+	}
+}
+
+// trees[90][0]
+template<>
+inline score_t StaticTree<90, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(20.5)){
+		if(x[5] <= threshold_t(50.4033203)){
+			if(x[5] <= threshold_t(45.7431641)){
+				return score_t(-0.062606506);
+			}else{
+				return score_t(-0.206069842);
+			}
+		}else{
+			if(x[2] <= threshold_t(60.0)){
+				return score_t(0.310812056);
+			}else{
+				return score_t(-0.137815565);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(34.8242188)){
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.0080744233);
+			}else{
+				return score_t(-0.0276558995);
+			}
+		}else{
+			if(x[5] <= threshold_t(34.8330078)){
+				return score_t(0.409650326);
+			}else{
+				return score_t(0.00195971481);
+			}
+		}
+	}
+}
+
+// trees[91][0]
+template<>
+inline score_t StaticTree<91, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(55.8320312)){
+		if(x[5] <= threshold_t(55.3496094)){
+			if(x[1] <= threshold_t(108.0)){
+				return score_t(-0.000747805519);
+			}else{
+				return score_t(0.0305688791);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.108965881);
+			}else{
+				return score_t(-0.216290608);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(100.0)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(-0.0677131563);
+			}else{
+				return score_t(0.0384519473);
+			}
+		}else{
+			if(x[5] <= threshold_t(56.4394531)){
+				return score_t(-0.0);
+			}else{
+				return score_t(-0.410540491);
+			}
+		}
+	}
+}
+
+// trees[92][0]
+template<>
+inline score_t StaticTree<92, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(46.6005859)){
+		if(x[5] <= threshold_t(45.4667969)){
+			if(x[5] <= threshold_t(44.5644531)){
+				return score_t(0.00115763373);
+			}else{
+				return score_t(-0.0459447578);
+			}
+		}else{
+			if(x[1] <= threshold_t(100.0)){
+				return score_t(0.0319914408);
+			}else{
+				return score_t(0.1689374);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(76.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.00194547744);
+			}else{
+				return score_t(-0.08711835);
+			}
+		}else{
+			if(x[5] <= threshold_t(48.8320312)){
+				return score_t(-0.0399247892);
+			}else{
+				return score_t(0.0215469748);
+			}
+		}
+	}
+}
+
+// trees[93][0]
+template<>
+inline score_t StaticTree<93, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[6] <= threshold_t(23.0625)){
+		if(x[1] <= threshold_t(100.0)){
+			if(x[5] <= threshold_t(48.9755859)){
+				return score_t(0.0329984874);
+			}else{
+				return score_t(0.129283324);
+			}
+		}else{
+			if(x[2] <= threshold_t(52.0)){
+				return score_t(-0.142790735);
+			}else{
+				return score_t(0.0595895462);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(57.7519531)){
+			if(x[6] <= threshold_t(24.625)){
+				return score_t(-0.0261181183);
+			}else{
+				return score_t(0.000199697344);
+			}
+		}else{
+			if(x[4] <= threshold_t(37.3261719)){
+				return score_t(0.33068496);
+			}else{
+				return score_t(-0.0136190215);
+			}
+		}
+	}
+}
+
+// trees[94][0]
+template<>
+inline score_t StaticTree<94, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(36.4667969)){
+		if(x[1] <= threshold_t(52.0)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0796044543);
+			}else{
+				return score_t(0.0147479847);
+			}
+		}else{
+			if(x[6] <= threshold_t(31.75)){
+				return score_t(0.000476585526);
+			}else{
+				return score_t(0.0298468173);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(36.5644531)){
+			if(x[4] <= threshold_t(42.1816406)){
+				return score_t(-0.123561673);
+			}else{
+				return score_t(0.169666693);
+			}
+		}else{
+			if(x[6] <= threshold_t(17.71875)){
+				return score_t(0.15141128);
+			}else{
+				return score_t(-0.00170577399);
+			}
+		}
+	}
+}
+
+// trees[95][0]
+template<>
+inline score_t StaticTree<95, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(50.4658203)){
+		if(x[5] <= threshold_t(50.3769531)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(0.0108379126);
+			}else{
+				return score_t(-0.00125832565);
+			}
+		}else{
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.0120041901);
+			}else{
+				return score_t(0.283190966);
+			}
+		}
+	}else{
+		if(x[1] <= threshold_t(44.0)){
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.0918342099);
+			}else{
+				return score_t(-0.185183197);
+			}
+		}else{
+			if(x[1] <= threshold_t(68.0)){
+				return score_t(-0.129505843);
+			}else{
+				return score_t(-0.00822998211);
+			}
+		}
+	}
+}
+
+// trees[96][0]
+template<>
+inline score_t StaticTree<96, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(58.2958984)){
+		if(x[5] <= threshold_t(45.171875)){
+			if(x[2] <= threshold_t(68.0)){
+				return score_t(-0.000944785308);
+			}else{
+				return score_t(-0.0381812714);
+			}
+		}else{
+			if(x[2] <= threshold_t(20.0)){
+				return score_t(0.0719186813);
+			}else{
+				return score_t(0.00511467457);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(84.0)){
+				return score_t(0.102013394);
+			}else{
+				return score_t(-0.354754835);
+			}
+		}else{
+			if(x[5] <= threshold_t(58.5283203)){
+				return score_t(-0.930207551);
+			}else{
+				return score_t(-0.119454049);
+			}
+		}
+	}
+}
+
+// trees[97][0]
+template<>
+inline score_t StaticTree<97, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[2] <= threshold_t(60.0)){
+		if(x[5] <= threshold_t(56.5195312)){
+			if(x[5] <= threshold_t(56.2333984)){
+				return score_t(-0.00179855293);
+			}else{
+				return score_t(-0.150884092);
+			}
+		}else{
+			if(x[4] <= threshold_t(39.2011719)){
+				return score_t(0.143352672);
+			}else{
+				return score_t(-0.0331960395);
+			}
+		}
+	}else{
+		if(x[5] <= threshold_t(32.1806641)){
+			if(x[3] <= threshold_t(72.0)){
+				return score_t(-0.124263339);
+			}else{
+				return score_t(0.348135084);
+			}
+		}else{
+			if(x[5] <= threshold_t(57.0996094)){
+				return score_t(0.0180851761);
+			}else{
+				return score_t(-0.199496537);
+			}
+		}
+	}
+}
+
+// trees[98][0]
+template<>
+inline score_t StaticTree<98, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[0] <= threshold_t(40.0)){
+		if(x[3] <= threshold_t(72.0)){
+			if(x[1] <= threshold_t(76.0)){
+				return score_t(0.061641451);
+			}else{
+				return score_t(-0.0186477229);
+			}
+		}else{
+			if(x[3] <= threshold_t(88.0)){
+				return score_t(-0.0310800616);
+			}else{
+				return score_t(0.0045569283);
+			}
+		}
+	}else{
+		if(x[3] <= threshold_t(72.0)){
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(-0.0692590103);
+			}else{
+				return score_t(0.0304071121);
+			}
+		}else{
+			if(x[0] <= threshold_t(56.0)){
+				return score_t(0.0479261316);
+			}else{
+				return score_t(-0.0163862389);
+			}
+		}
+	}
+}
+
+// trees[99][0]
+template<>
+inline score_t StaticTree<99, 0, input_arr_t, score_t>::decision_function(input_arr_t x){
+	#pragma HLS inline
+	if(x[5] <= threshold_t(54.1269531)){
+		if(x[5] <= threshold_t(54.0283203)){
+			if(x[0] <= threshold_t(72.0)){
+				return score_t(0.000925859262);
+			}else{
+				return score_t(-0.015619236);
+			}
+		}else{
+			if(x[6] <= threshold_t(25.84375)){
+				return score_t(0.176892474);
+			}else{
+				return score_t(-0.248055056);
+			}
+		}
+	}else{
+		if(x[0] <= threshold_t(88.0)){
+			if(x[6] <= threshold_t(26.859375)){
+				return score_t(0.0997440517);
+			}else{
+				return score_t(0.00894586742);
+			}
+		}else{
+			if(x[5] <= threshold_t(56.4570312)){
+				return score_t(0.481408);
+			}else{
+				return score_t(-0.147654518);
+			}
+		}
+	}
+}
+
+}
+
+static const BDT::StaticBDT<n_trees, n_classes, input_arr_t, score_t> bdt_static =
+{ // The struct
+	1, // The normalisation
+	{0}
+};
+
+#endif
@@ -53,9 +53,10 @@ else
   mv TQ/* .
 fi
 
-python conifer_converter.py xgboost_model.pkl
+python conifer_converter.py xgboost_model.pkl --static
 
 mv simdir/firmware/parameters.h .
+mv simdir/firmware/parameters_static.h .
 mv simdir/firmware/BDT.h .
 
 rm -r simdir
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_AllProjectionMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // AllProjectionBase is where we define the bit widths, which depend on the class template parameter.
@@ -103,15 +104,15 @@ public:
   
   // Constructors
   AllProjection(const AllProjectionData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>(newdata))
   {}
 
   AllProjection(const AProjTCID tcid, const AProjTrackletIndex trackletindex, const AProjPHI phi, const AProjRZ rz, const AProjPHIDER phider, const AProjRZDER rzder):
-    data_( (((((tcid,trackletindex),phi),rz),phider),rzder) )
+    data_(toMemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>((((((tcid,trackletindex),phi),rz),phider),rzder)))
   {}
   
   AllProjection(const AProjTCSEED seed, const AProjTCVM vm, const AProjTrackletIndex trackletindex, const AProjPHI phi, const AProjRZ rz, const AProjPHIDER phider, const AProjRZDER rzder):
-    data_( ((((((seed,vm),trackletindex),phi),rz),phider),rzder) )
+    data_(toMemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>(((((((seed,vm),trackletindex),phi),rz),phider),rzder)))
   {}
 
   AllProjection():
@@ -122,83 +123,83 @@ public:
   AllProjection(const char* datastr, int base=16)
   {
     AllProjectionData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return AllProjectionBase<AProjType>::kAllProjectionSize;}
   
-  AllProjectionData raw() const {return data_;}
+  AllProjectionData raw() const {return fromMemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>(data_);}
   
   AProjTCID getTCID() const {
-    return data_.range(kAProjTCIDMSB,kAProjTCIDLSB);
+    return getBits<kAProjTCIDMSB,kAProjTCIDLSB>(data_);
   }
 
   AProjTCSEED getSeed() const {
-	return data_.range(kAProjTCSeedMSB,kAProjTCSeedLSB);
+	return getBits<kAProjTCSeedMSB,kAProjTCSeedLSB>(data_);
   }
   
   AProjTCVM getVM() const {
-	return data_.range(kAProjTCVMMSB,kAProjTCVMLSB);
+	return getBits<kAProjTCVMMSB,kAProjTCVMLSB>(data_);
   }
 
   AProjTrackletIndex getTrackletIndex() const {
-	return data_.range(kAProjTrackletIndexMSB,kAProjTrackletIndexLSB);
+	return getBits<kAProjTrackletIndexMSB,kAProjTrackletIndexLSB>(data_);
   }
 
   AProjPHI getPhi() const {
-    return data_.range(kAProjPhiMSB,kAProjPhiLSB);
+    return getBits<kAProjPhiMSB,kAProjPhiLSB>(data_);
   }
   
   AProjRZ getRZ() const {
-    return data_.range(kAProjRZMSB,kAProjRZLSB);
+    return getBits<kAProjRZMSB,kAProjRZLSB>(data_);
   }
   
   AProjPHIDER getPhiDer() const { 
-    return data_.range(kAProjPhiDMSB,kAProjPhiDLSB);
+    return getBits<kAProjPhiDMSB,kAProjPhiDLSB>(data_);
   }
   
   AProjRZDER getRZDer() const {
-    return data_.range(kAProjRZDMSB,kAProjRZDLSB);
+    return getBits<kAProjRZDMSB,kAProjRZDLSB>(data_);
   }
 
   // Setter
   void setTCID(const AProjTCID id) {
-    data_.range(kAProjTCIDMSB,kAProjTCIDLSB) = id;
+    setBits<kAProjTCIDMSB,kAProjTCIDLSB>(data_, id);
   }
 
   void setSeed(const AProjTCSEED seed) {
-	data_.range(kAProjTCSeedMSB,kAProjTCSeedLSB) = seed;
+	setBits<kAProjTCSeedMSB,kAProjTCSeedLSB>(data_, seed);
   }
 
   void setVM(const AProjTCVM vm) {
-	data_.range(kAProjTCVMMSB,kAProjTCVMLSB) = vm;
+	setBits<kAProjTCVMMSB,kAProjTCVMLSB>(data_, vm);
   }
 
   void setTrackletIndex(const AProjTrackletIndex trackletindex) {
-        data_.range(kAProjTrackletIndexMSB,kAProjTrackletIndexLSB) = trackletindex;
+        setBits<kAProjTrackletIndexMSB,kAProjTrackletIndexLSB>(data_, trackletindex);
   }
 
   void setPhi(const AProjPHI phi) {
-    data_.range(kAProjPhiMSB,kAProjPhiLSB) = phi;
+    setBits<kAProjPhiMSB,kAProjPhiLSB>(data_, phi);
   }
 
   void setRZ(const AProjRZ rz) {
-    data_.range(kAProjRZMSB,kAProjRZLSB) = rz;
+    setBits<kAProjRZMSB,kAProjRZLSB>(data_, rz);
   }
 
   void setPhiDer(const AProjPHIDER phider) {
-    data_.range(kAProjPhiDMSB,kAProjPhiDLSB) = phider;
+    setBits<kAProjPhiDMSB,kAProjPhiDLSB>(data_, phider);
   }
 
   void setRZDer(const AProjRZDER rzder) {
-    data_.range(kAProjRZDMSB,kAProjRZDLSB) = rzder;
+    setBits<kAProjRZDMSB,kAProjRZDLSB>(data_, rzder);
   }
 
 private:
 
-  AllProjectionData data_;
+  typename MemoryWord<AllProjectionBase<AProjType>::kAllProjectionSize>::type data_;
   
 };
 
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_AllStubInnerMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // AllStubInnerBase is where we define the bit widths, which depend on the class template parameter
@@ -127,18 +128,18 @@ public:
 
   // Constructors
   AllStubInner(const AllStubInnerData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>(newdata))
   {}
 
  AllStubInner(const ASR r, const ASZ z, const ASPHI phi, const ASBEND bend, const ASINDEX index, const ASFINEPHI finephi):
-    data_( (r,z,phi,bend,index,finephi) )
+    data_(toMemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>((r,z,phi,bend,index,finephi)))
   {
     static_assert(ASType != DISK2S, "Constructor should not be used for Disk 2S stubs");
   }
 
   // This constructor is only used for stubs in DISK2S
   AllStubInner(const ASR r, const ASZ z, const ASPHI phi, const ASALPHA alpha, const ASBEND bend, const ASINDEX index, const ASFINEPHI finephi):
-    data_( (r,z,phi,alpha,bend,index,finephi) )
+    data_(toMemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>((r,z,phi,alpha,bend,index,finephi)))
   {
     static_assert(ASType == DISK2S, "Constructor should only be used for Disk 2S stubs");
   }
@@ -151,83 +152,83 @@ public:
   AllStubInner(const char* datastr, int base=16)
   {
     AllStubInnerData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return AllStubInnerBase<ASType>::kAllStubInnerSize;}
 
-  AllStubInnerData raw() const {return data_; }
+  AllStubInnerData raw() const {return fromMemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>(data_);}
 
   AllStubData getAllStub() const {
-    return data_.range(kASRMSB,kASBendLSB);
+    return getBits<kASRMSB,kASBendLSB>(data_);
   }
 
   ASR getR() const {
-    return data_.range(kASRMSB,kASRLSB);
+    return getBits<kASRMSB,kASRLSB>(data_);
   }
 
   ASZ getZ() const {
-    return data_.range(kASZMSB,kASZLSB);
+    return getBits<kASZMSB,kASZLSB>(data_);
   }
 
   ASPHI getPhi() const {
-    return data_.range(kASPhiMSB,kASPhiLSB);
+    return getBits<kASPhiMSB,kASPhiLSB>(data_);
   }
 
   // This getter is only used for stubs in DISK2S
   ASALPHA getAlpha() const {
     static_assert(ASType == DISK2S, "Getter should only be used for Disk 2S stubs");
-    return data_.range(kASAlphaMSB,kASAlphaLSB);
+    return getBits<kASAlphaMSB,kASAlphaLSB>(data_);
   }
 
   ASBEND getBend() const {
-    return data_.range(kASBendMSB,kASBendLSB);
+    return getBits<kASBendMSB,kASBendLSB>(data_);
   }
 
   ASINDEX getIndex() const {
-    return data_.range(kASIndexMSB,kASIndexLSB);
+    return getBits<kASIndexMSB,kASIndexLSB>(data_);
   }
 
   ASFINEPHI getFinePhi() const {
-    return data_.range(kASFinePhiMSB,kASFinePhiLSB);
+    return getBits<kASFinePhiMSB,kASFinePhiLSB>(data_);
   }
 
   // Setter
   void setR(const ASR r) {
-    data_.range(kASRMSB,kASRLSB) = r;
+    setBits<kASRMSB,kASRLSB>(data_, r);
   }
 
   void setZ(const ASZ z) {
-    data_.range(kASZMSB,kASZLSB) = z;
+    setBits<kASZMSB,kASZLSB>(data_, z);
   }
 
   void setPhi(const ASPHI phi) {
-    data_.range(kASPhiMSB,kASPhiLSB) = phi;
+    setBits<kASPhiMSB,kASPhiLSB>(data_, phi);
   }
 
   // This setter is only used for stubs in DISK2S
   void setAlpha(const ASALPHA alpha) {
     static_assert(ASType == DISK2S, "Setter should only be used for Disk 2S stubs");
-    data_.range(kASAlphaMSB,kASAlphaLSB) = alpha;
+    setBits<kASAlphaMSB,kASAlphaLSB>(data_, alpha);
   }
 
   void setBend(const ASBEND bend) {
-    data_.range(kASBendMSB,kASBendLSB) = bend;
+    setBits<kASBendMSB,kASBendLSB>(data_, bend);
   }
 
   void setIndex(const ASINDEX index) {
-    data_.range(kASIndexMSB,kASIndexLSB) = index;
+    setBits<kASIndexMSB,kASIndexLSB>(data_, index);
   }
 
   void setFinePhi(const ASFINEPHI finephi) {
-    data_.range(kASFinePhiMSB,kASFinePhiLSB) = finephi;
+    setBits<kASFinePhiMSB,kASFinePhiLSB>(data_, finephi);
   }
 
 private:
 
-  AllStubInnerData data_;
+  typename MemoryWord<AllStubInnerBase<ASType>::kAllStubInnerSize>::type data_;
 
 };
 
@@ -250,7 +251,7 @@ public:
   typedef ap_uint<AllStubInnerBase<DISK>::kASIndexSize> ASINDEX;
 
   AllStubInner(const AllStubInnerData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<AllStubInnerBase<DISK>::kAllStubInnerSize>(newdata))
   {}
 
   AllStubInner():
@@ -261,7 +262,7 @@ public:
   AllStubInner(const char* datastr, int base=16)
   {
     AllStubInnerData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<AllStubInnerBase<DISK>::kAllStubInnerSize>(newdata);
   }
   #endif
 
@@ -269,23 +270,23 @@ public:
   static constexpr int getWidth() {return AllStubInnerBase<DISK>::kAllStubInnerSize;}
 
   ASFINEPHI getFinePhi() const {
-    return data_.range(kASFinePhiMSB,kASFinePhiLSB);
+    return getBits<kASFinePhiMSB,kASFinePhiLSB>(data_);
   }
 
-  AllStubInnerData raw() const {return data_;}
+  AllStubInnerData raw() const {return fromMemoryWord<AllStubInnerBase<DISK>::kAllStubInnerSize>(data_);}
   
   // Setter
   void setIndex(const ASINDEX index) {
-    data_.range(kASIndexMSB,kASIndexLSB) = index;
+    setBits<kASIndexMSB,kASIndexLSB>(data_, index);
   }
   
   void setFinePhi(const ASFINEPHI finephi) {
-    data_.range(kASFinePhiMSB,kASFinePhiLSB) = finephi;
+    setBits<kASFinePhiMSB,kASFinePhiLSB>(data_, finephi);
   }
 
 private:
 
-  AllStubInnerData data_;
+  MemoryWord<AllStubInnerBase<DISK>::kAllStubInnerSize>::type data_;
 
 };
 
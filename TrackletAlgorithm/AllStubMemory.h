@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_AllStubMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // AllStubBase is where we define the bit widths, which depend on the class template parameter
@@ -108,18 +109,18 @@ public:
 
   // Constructors
   AllStub(const AllStubData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<AllStubBase<ASType>::kAllStubSize>(newdata))
   {}
 
   AllStub(const ASR r, const ASZ z, const ASPHI phi, const ASBEND bend):
-    data_( (((r,z),phi),bend) )
+    data_(toMemoryWord<AllStubBase<ASType>::kAllStubSize>((((r,z),phi),bend)))
   {
     static_assert(ASType != DISK2S, "Constructor should not be used for Disk 2S stubs");
   }
 
   // This constructor is only used for stubs in DISK2S
   AllStub(const ASR r, const ASZ z, const ASPHI phi, const ASALPHA alpha, const ASBEND bend):
-    data_( ((((r,z),phi),alpha),bend) )
+    data_(toMemoryWord<AllStubBase<ASType>::kAllStubSize>(((((r,z),phi),alpha),bend)))
   {
     static_assert(ASType == DISK2S, "Constructor should only be used for Disk 2S stubs");
   }
@@ -132,63 +133,63 @@ public:
   AllStub(const char* datastr, int base=16)
   {
     AllStubData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<AllStubBase<ASType>::kAllStubSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return AllStubBase<ASType>::kAllStubSize;}
 
-  AllStubData raw() const {return data_; }
+  AllStubData raw() const {return fromMemoryWord<AllStubBase<ASType>::kAllStubSize>(data_);}
 
   ASR getR() const {
-    return data_.range(kASRMSB,kASRLSB);
+    return getBits<kASRMSB,kASRLSB>(data_);
   }
 
   ASZ getZ() const {
-    return data_.range(kASZMSB,kASZLSB);
+    return getBits<kASZMSB,kASZLSB>(data_);
   }
 
   ASPHI getPhi() const {
-    return data_.range(kASPhiMSB,kASPhiLSB);
+    return getBits<kASPhiMSB,kASPhiLSB>(data_);
   }
 
   // This getter is only used for stubs in DISK2S
   ASALPHA getAlpha() const {
     static_assert(ASType == DISK2S, "Getter should only be used for Disk 2S stubs");
-    return data_.range(kASAlphaMSB,kASAlphaLSB);
+    return getBits<kASAlphaMSB,kASAlphaLSB>(data_);
   }
 
   ASBEND getBend() const {
-    return data_.range(kASBendMSB,kASBendLSB);
+    return getBits<kASBendMSB,kASBendLSB>(data_);
   }
 
   // Setter
   void setR(const ASR r) {
-    data_.range(kASRMSB,kASRLSB) = r;
+    setBits<kASRMSB,kASRLSB>(data_, r);
   }
 
   void setZ(const ASZ z) {
-    data_.range(kASZMSB,kASZLSB) = z;
+    setBits<kASZMSB,kASZLSB>(data_, z);
   }
 
   void setPhi(const ASPHI phi) {
-    data_.range(kASPhiMSB,kASPhiLSB) = phi;
+    setBits<kASPhiMSB,kASPhiLSB>(data_, phi);
   }
 
   // This setter is only used for stubs in DISK2S
   void setAlpha(const ASALPHA alpha) {
     static_assert(ASType == DISK2S, "Setter should only be used for Disk 2S stubs");
-    data_.range(kASAlphaMSB,kASAlphaLSB) = alpha;
+    setBits<kASAlphaMSB,kASAlphaLSB>(data_, alpha);
   }
 
   void setBend(const ASBEND bend) {
-    data_.range(kASBendMSB,kASBendLSB) = bend;
+    setBits<kASBendMSB,kASBendLSB>(data_, bend);
   }
 
 private:
 
-  AllStubData data_;
+  typename MemoryWord<AllStubBase<ASType>::kAllStubSize>::type data_;
 
 };
 
@@ -201,7 +202,7 @@ public:
   typedef ap_uint<AllStubBase<DISK>::kAllStubSize> AllStubData;
 
   AllStub(const AllStubData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<AllStubBase<DISK>::kAllStubSize>(newdata))
   {}
 
   AllStub():
@@ -212,18 +213,18 @@ public:
   AllStub(const char* datastr, int base=16)
   {
     AllStubData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<AllStubBase<DISK>::kAllStubSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return AllStubBase<DISK>::kAllStubSize;}
 
-  AllStubData raw() const {return data_;}
+  AllStubData raw() const {return fromMemoryWord<AllStubBase<DISK>::kAllStubSize>(data_);}
 
 private:
 
-  AllStubData data_;
+  MemoryWord<AllStubBase<DISK>::kAllStubSize>::type data_;
 
 };
 
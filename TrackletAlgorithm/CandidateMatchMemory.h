@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_CandidateMatchMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // Data object definition
@@ -30,11 +31,11 @@ public:
 
   // Constructors
   CandidateMatch(const CandidateMatchData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<kCandidateMatchSize>(newdata))
   {}
 
   CandidateMatch(const CMProjIndex projindex, const CMStubIndex stubindex):
-    data_( (projindex,stubindex) )
+    data_(toMemoryWord<kCandidateMatchSize>((projindex,stubindex)))
   {}
   
   CandidateMatch():
@@ -45,35 +46,35 @@ public:
   CandidateMatch(const char* datastr, int base=16)
   {
     CandidateMatchData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<kCandidateMatchSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return kCandidateMatchSize;}
   
-  CandidateMatchData raw() const {return data_;}
+  CandidateMatchData raw() const {return fromMemoryWord<kCandidateMatchSize>(data_);}
   
   CMProjIndex getProjIndex() const {
-    return data_.range(kCMProjIndexMSB,kCMProjIndexLSB);
+    return getBits<kCMProjIndexMSB,kCMProjIndexLSB>(data_);
   }
 
   CMStubIndex getStubIndex() const {
-    return data_.range(kCMStubIndexMSB,kCMStubIndexLSB);
+    return getBits<kCMStubIndexMSB,kCMStubIndexLSB>(data_);
   }
 
   // Setter
   void setProjIndex(const CMProjIndex id) {
-    data_.range(kCMProjIndexMSB,kCMProjIndexLSB) = id;
+    setBits<kCMProjIndexMSB,kCMProjIndexLSB>(data_, id);
   }
 
   void setStubIndex(const CMStubIndex id) {
-    data_.range(kCMStubIndexMSB,kCMStubIndexLSB) = id;
+    setBits<kCMStubIndexMSB,kCMStubIndexLSB>(data_, id);
   }
 
 private:
   
-  CandidateMatchData data_;
+  MemoryWord<kCandidateMatchSize>::type data_;
   
 };
 
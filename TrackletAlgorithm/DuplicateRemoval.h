@@ -0,0 +1,235 @@
+#ifndef TrackletAlgorithm_DuplicateRemoval_h
+#define TrackletAlgorithm_DuplicateRemoval_h
+
+#include "TrackFitMemory.h"
+
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
+// Number of stubs, in the layers and disks of the stub words, that two tracks
+// must share to be duplicates. The seeding stubs are not in the stub words, so
+// they cannot be counted: the emulation needs 3 shared stubs, seeding stubs
+// included, and two tracklets of a seed share at most one seeding stub, so two
+// duplicates of the emulation share at least 2 of the stubs counted here. This
+// also removes the tracks sharing 2 stubs but no seeding stub, which the
+// emulation keeps.
+static const unsigned short kMinNSharedStubs = 2;
+
+// Number of clean tracks that the incoming tracks are compared with, i.e. the
+// first kMaxNCompTracks tracks written to the output, held in registers. Each
+// of them takes kNStubs index comparisons per seed in each clock, and the
+// first match is found by a priority encoder over all of them, which bounds
+// the window for the loop to run at II=1. The tracks written after them are
+// still compared with them, but not with each other: a duplicate of one of
+// them is written too (the emulation compares every clean track).
+static const unsigned short kMaxNCompTracks = 32;
+
+// Stubs of a track: their valid bits and indices, in the order of the stub
+// words (barrel stubs, then disk stubs)
+struct TrackStubs {
+  ap_uint<TrackFit::kNStubs> valid;
+  TrackFit::TFSTUBINDEX index[TrackFit::kNStubs];
+};
+
+template<uint8_t Hit, int W>
+void getStub(const ap_uint<W>& word, TrackStubs& stubs)
+{
+#pragma HLS inline
+  constexpr unsigned int lsb = TrackFit::kTFStubRZResidLSB(Hit);
+  stubs.valid[Hit] = TrackFit::getWordBits<TrackFit::kTFStubValidMSB(Hit), TrackFit::kTFStubValidLSB(Hit), lsb>(word);
+  stubs.index[Hit] = TrackFit::getWordBits<TrackFit::kTFStubIndexMSB(Hit), TrackFit::kTFStubIndexLSB(Hit), lsb>(word);
+}
+
+// Number of stubs shared by two tracks
+inline ap_uint<4> nSharedStubs(const ap_uint<TrackFit::kNStubs>& validA, const TrackFit::TFSTUBINDEX indexA[TrackFit::kNStubs],
+                               const ap_uint<TrackFit::kNStubs>& validB, const TrackFit::TFSTUBINDEX indexB[TrackFit::kNStubs])
+{
+#pragma HLS inline
+  ap_uint<4> nShared = 0;
+  compare_stubs : for (unsigned short k = 0; k < TrackFit::kNStubs; k++)
+    nShared += (validA[k] && validB[k] && indexA[k] == indexB[k]);
+  return nShared;
+}
+
+// Duplicate removal of the tracks of NSeeds TrackBuilders, given in their
+// output format: for each seed, the track words and the stub words of the
+// tracks, the valid tracks being contiguous from the first address. At clock i,
+// track i of each seed is compared, in the order of the seeds, with the clean
+// tracks, i.e. those already written to the output (the first kMaxNCompTracks
+// of them) and by the earlier seeds. If it shares at least
+// kMinNSharedStubs stubs with one of them, it is a duplicate of the first such
+// track: the better of the two is kept at its address, the one with the most
+// stubs or, if they have as many, the one of the first seed. Otherwise, it is
+// written after the clean tracks, in the same format as the input.
+//
+// The stubs of the tracks are compared, in parallel, with those of the clean
+// tracks at the start of the clock and with those of the tracks of the other
+// seeds. Only the choice of the track kept, which depends on the tracks written
+// by the earlier seeds, is made from one seed to the next.
+//
+// The TrackFit words only hold the stubs of L1L2 tracks, so for now all the
+// seeds have its layers and disks.
+template<int NSeeds>
+void DuplicateRemoval(
+    const BXType bx,
+    const TrackFit::TrackWord trackWord[][kMaxProc],
+    const TrackFit::BarrelStubWord barrelStubWords[][TrackFit::kNBarrelStubs][kMaxProc],
+    const TrackFit::DiskStubWord diskStubWords[][TrackFit::kNDiskStubs][kMaxProc],
+    BXType &bx_o,
+    TrackFit::TrackWord cleanTrackWord[kMaxProc],
+    TrackFit::BarrelStubWord cleanBarrelStubWords[][kMaxProc],
+    TrackFit::DiskStubWord cleanDiskStubWords[][kMaxProc]
+)
+{
+  // Stubs, number of stubs and seed of the clean tracks compared with the
+  // incoming ones, at the same index as in the output
+  ap_uint<TrackFit::kNStubs> comp_valid[kMaxNCompTracks];
+  TrackFit::TFSTUBINDEX comp_index[kMaxNCompTracks][TrackFit::kNStubs];
+  ap_uint<4> comp_nstubs[kMaxNCompTracks];
+  ap_uint<4> comp_seed[kMaxNCompTracks];
+#pragma HLS array_partition variable=comp_valid complete dim=0
+#pragma HLS array_partition variable=comp_index complete dim=0
+#pragma HLS array_partition variable=comp_nstubs complete dim=0
+#pragma HLS array_partition variable=comp_seed complete dim=0
+
+  initialize_comp : for (unsigned short i = 0; i < kMaxNCompTracks; i++) {
+#pragma HLS unroll
+    comp_valid[i] = 0;
+    comp_nstubs[i] = 0;
+    comp_seed[i] = 0;
+  }
+
+  ap_uint<kNBits_MemAddr> nCleanTracks = 0;
+
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("DuplicateRemoval::tracks", kMaxProc);
+#endif
+
+  tracks : for (unsigned short i = 0; i < kMaxProc; i++) {
+#pragma HLS pipeline II=1 rewind
+
+#ifndef __SYNTHESIS__
+    bool useful = false;
+#endif
+
+    // Words and stubs of the incoming tracks
+    TrackFit::TrackWord words[NSeeds];
+    TrackFit::BarrelStubWord barrelWords[NSeeds][TrackFit::kNBarrelStubs];
+    TrackFit::DiskStubWord diskWords[NSeeds][TrackFit::kNDiskStubs];
+    ap_uint<TrackFit::kNStubs> valid[NSeeds];
+    TrackFit::TFSTUBINDEX index[NSeeds][TrackFit::kNStubs];
+    ap_uint<4> nStubs[NSeeds];
+#pragma HLS array_partition variable=words complete dim=0
+#pragma HLS array_partition variable=barrelWords complete dim=0
+#pragma HLS array_partition variable=diskWords complete dim=0
+#pragma HLS array_partition variable=valid complete dim=0
+#pragma HLS array_partition variable=index complete dim=0
+#pragma HLS array_partition variable=nStubs complete dim=0
+
+    read_seeds : for (unsigned short s = 0; s < NSeeds; s++) {
+#pragma HLS unroll
+      words[s] = trackWord[s][i];
+      read_barrel_stubs : for (unsigned short j = 0; j < TrackFit::kNBarrelStubs; j++)
+        barrelWords[s][j] = barrelStubWords[s][j][i];
+      read_disk_stubs : for (unsigned short j = 0; j < TrackFit::kNDiskStubs; j++)
+        diskWords[s][j] = diskStubWords[s][j][i];
+
+      TrackStubs stubs;
+#pragma HLS array_partition variable=stubs.index complete dim=0
+      getStub<0>(barrelWords[s][0], stubs);
+      getStub<1>(barrelWords[s][1], stubs);
+      getStub<2>(barrelWords[s][2], stubs);
+      getStub<3>(barrelWords[s][3], stubs);
+      getStub<4>(diskWords[s][0], stubs);
+      getStub<5>(diskWords[s][1], stubs);
+      getStub<6>(diskWords[s][2], stubs);
+      getStub<7>(diskWords[s][3], stubs);
+      valid[s] = stubs.valid;
+      copy_stubs : for (unsigned short k = 0; k < TrackFit::kNStubs; k++)
+        index[s][k] = stubs.index[k];
+
+      nStubs[s] = 0;
+      count_stubs : for (unsigned short j = 0; j < TrackFit::kNStubs; j++)
+        nStubs[s] += stubs.valid[j];
+    }
+
+    // Tracks sharing enough stubs with each clean track at the start of the
+    // clock, and with each track of an earlier seed
+    ap_uint<kMaxNCompTracks> sharesComp[NSeeds];
+    ap_uint<NSeeds> sharesSeed[NSeeds];
+#pragma HLS array_partition variable=sharesComp complete dim=0
+#pragma HLS array_partition variable=sharesSeed complete dim=0
+    compare_seeds : for (unsigned short s = 0; s < NSeeds; s++) {
+#pragma HLS unroll
+      compare_tracks : for (unsigned short j = 0; j < kMaxNCompTracks; j++)
+        sharesComp[s][j] = nSharedStubs(comp_valid[j], comp_index[j], valid[s], index[s]) >= kMinNSharedStubs;
+      sharesSeed[s] = 0;
+      compare_earlier_seeds : for (unsigned short t = 0; t < s; t++)
+        sharesSeed[s][t] = nSharedStubs(valid[t], index[t], valid[s], index[s]) >= kMinNSharedStubs;
+    }
+
+    // Clean tracks written in this clock, by the seed in comp_seed
+    ap_uint<kMaxNCompTracks> written = 0;
+
+    seeds : for (unsigned short s = 0; s < NSeeds; s++) {
+#pragma HLS unroll
+
+      const ap_uint<1> trackValid = words[s][TrackFit::kTrackWordSize - 1];
+
+      // First clean track sharing enough stubs, as written by the earlier seeds
+      bool duplicate = false;
+      ap_uint<kNBits_MemAddr> duplicateIndex = 0;
+      find_duplicate : for (unsigned short j = 0; j < kMaxNCompTracks; j++) {
+        const bool shares = written[j] ? bool(sharesSeed[s][comp_seed[j]]) : bool(sharesComp[s][j]);
+        if (!duplicate && shares) {
+          duplicate = true;
+          duplicateIndex = j;
+        }
+      }
+
+      // Write a new track, or replace the duplicate if the track is better
+      const bool better = (nStubs[s] > comp_nstubs[duplicateIndex]) ||
+                          (nStubs[s] == comp_nstubs[duplicateIndex] && s < comp_seed[duplicateIndex]);
+      const bool write = trackValid && (duplicate ? better : nCleanTracks < kMaxProc);
+      const ap_uint<kNBits_MemAddr> index_o = duplicate ? duplicateIndex : nCleanTracks;
+
+      if (write) {
+        cleanTrackWord[index_o] = words[s];
+        write_barrel_stubs : for (unsigned short j = 0; j < TrackFit::kNBarrelStubs; j++)
+          cleanBarrelStubWords[j][index_o] = barrelWords[s][j];
+        write_disk_stubs : for (unsigned short j = 0; j < TrackFit::kNDiskStubs; j++)
+          cleanDiskStubWords[j][index_o] = diskWords[s][j];
+      }
+
+      update_comp : for (unsigned short j = 0; j < kMaxNCompTracks; j++) {
+        if (write && index_o == j) {
+          written[j] = 1;
+          comp_valid[j] = valid[s];
+          comp_nstubs[j] = nStubs[s];
+          comp_seed[j] = s;
+          update_comp_stubs : for (unsigned short k = 0; k < TrackFit::kNStubs; k++)
+            comp_index[j][k] = index[s][k];
+        }
+      }
+
+      nCleanTracks += (write && !duplicate) ? 1 : 0;
+
+#ifndef __SYNTHESIS__
+      useful |= trackValid;
+#endif
+    }
+
+#ifndef __SYNTHESIS__
+    loopStats.useful += useful;
+#endif
+  }
+
+#ifndef __SYNTHESIS__
+  loopStats.record();
+#endif
+
+  bx_o = bx;
+}
+
+#endif
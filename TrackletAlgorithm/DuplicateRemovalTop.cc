@@ -0,0 +1,35 @@
+#include "DuplicateRemovalTop.h"
+
+// L1L2 DuplicateRemoval top function
+void DuplicateRemoval_L1L2(
+    const BXType bx,
+    const TrackFit::TrackWord trackWord[kNDRSeeds][kMaxProc],
+    const TrackFit::BarrelStubWord barrelStubWords[kNDRSeeds][TrackFit::kNBarrelStubs][kMaxProc],
+    const TrackFit::DiskStubWord diskStubWords[kNDRSeeds][TrackFit::kNDiskStubs][kMaxProc],
+    BXType &bx_o,
+    TrackFit::TrackWord cleanTrackWord[kMaxProc],
+    TrackFit::BarrelStubWord cleanBarrelStubWords[TrackFit::kNBarrelStubs][kMaxProc],
+    TrackFit::DiskStubWord cleanDiskStubWords[TrackFit::kNDiskStubs][kMaxProc]
+)
+{
+#pragma HLS inline recursive
+#pragma HLS interface register port=bx_o
+#pragma HLS array_partition variable=trackWord complete dim=1
+#pragma HLS array_partition variable=barrelStubWords complete dim=1
+#pragma HLS array_partition variable=barrelStubWords complete dim=2
+#pragma HLS array_partition variable=diskStubWords complete dim=1
+#pragma HLS array_partition variable=diskStubWords complete dim=2
+#pragma HLS array_partition variable=cleanBarrelStubWords complete dim=1
+#pragma HLS array_partition variable=cleanDiskStubWords complete dim=1
+
+  DuplicateRemoval<kNDRSeeds>(
+      bx,
+      trackWord,
+      barrelStubWords,
+      diskStubWords,
+      bx_o,
+      cleanTrackWord,
+      cleanBarrelStubWords,
+      cleanDiskStubWords
+  );
+}
@@ -0,0 +1,21 @@
+#ifndef TrackletAlgorithm_DuplicateRemovalTop_h
+#define TrackletAlgorithm_DuplicateRemovalTop_h
+
+#include "DuplicateRemoval.h"
+
+// Number of TrackBuilders whose tracks are compared; only L1L2 for now
+constexpr int kNDRSeeds = 1;
+
+// L1L2 DuplicateRemoval top function
+void DuplicateRemoval_L1L2(
+    const BXType bx,
+    const TrackFit::TrackWord trackWord[kNDRSeeds][kMaxProc],
+    const TrackFit::BarrelStubWord barrelStubWords[kNDRSeeds][TrackFit::kNBarrelStubs][kMaxProc],
+    const TrackFit::DiskStubWord diskStubWords[kNDRSeeds][TrackFit::kNDiskStubs][kMaxProc],
+    BXType &bx_o,
+    TrackFit::TrackWord cleanTrackWord[kMaxProc],
+    TrackFit::BarrelStubWord cleanBarrelStubWords[TrackFit::kNBarrelStubs][kMaxProc],
+    TrackFit::DiskStubWord cleanDiskStubWords[TrackFit::kNDiskStubs][kMaxProc]
+);
+
+#endif
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_FullMatchMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // FullMatchBase is where we define the bit widths, which depend on the class template parameter.
@@ -130,15 +131,15 @@ public:
 
   // Constructors
   FullMatch(const FullMatchData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<FullMatchBase<FMType>::kFullMatchSize>(newdata))
   {}
 
   FullMatch(const FMTCID tcid, const FMTrackletIndex trackletindex, const FMSTUBINDEX stub, const FMSTUBR stubr, const FMPHIRES phires, const FMZRES zres):
-    data_( (((((tcid,trackletindex),stub),stubr),phires),zres) )
+    data_(toMemoryWord<FullMatchBase<FMType>::kFullMatchSize>((((((tcid,trackletindex),stub),stubr),phires),zres)))
   {}
 
   FullMatch(const FMTCID tcid, const FMTrackletIndex trackletindex, const FMSTUBPHIID stubphiid, const FMSTUBID stubid, const FMSTUBR stubr, const FMPHIRES phires, const FMZRES zres):
-	data_( ((((((tcid,trackletindex),stubphiid),stubid),stubr),phires),zres) )
+	data_(toMemoryWord<FullMatchBase<FMType>::kFullMatchSize>(((((((tcid,trackletindex),stubphiid),stubid),stubr),phires),zres)))
   {}
 
   FullMatch():
@@ -149,14 +150,14 @@ public:
   FullMatch(const char* datastr, int base = 16)
   {
     FullMatchData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<FullMatchBase<FMType>::kFullMatchSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return FullMatchBase<FMType>::kFullMatchSize;}
 
-  FullMatchData raw() const {return data_;}
+  FullMatchData raw() const {return fromMemoryWord<FullMatchBase<FMType>::kFullMatchSize>(data_);}
 
   // TCID is a unique identifier assigned to each TC. It is a concatenation of
   // the seed and iTC numbers:
@@ -178,77 +179,77 @@ public:
   //   C -> 2
   //   ...
   FMTCID getTCID() const {
-    return data_.range(kFMTCIDMSB,kFMTCIDLSB);
+    return getBits<kFMTCIDMSB,kFMTCIDLSB>(data_);
   }
 
   FMTrackletIndex getTrackletIndex() const {
-    return data_.range(kFMTrackletIndexMSB,kFMTrackletIndexLSB);
+    return getBits<kFMTrackletIndexMSB,kFMTrackletIndexLSB>(data_);
   }
 
   FMTrackletID getTrackletID() const {
-    return data_.range(kFMTCIDMSB,kFMTrackletIndexLSB);
+    return getBits<kFMTCIDMSB,kFMTrackletIndexLSB>(data_);
   }
 
   FMSTUBINDEX getStubIndex() const {
-    return data_.range(kFMStubIndexMSB,kFMStubIndexLSB);
+    return getBits<kFMStubIndexMSB,kFMStubIndexLSB>(data_);
   }
 
   FMSTUBID getStubID() const {
-    return data_.range(kFMStubIDMSB,kFMStubIDLSB);
+    return getBits<kFMStubIDMSB,kFMStubIDLSB>(data_);
   }
 
   FMSTUBPHIID getStubPhiID() const {
-    return data_.range(kFMStubPhiIDMSB,kFMStubPhiIDLSB);
+    return getBits<kFMStubPhiIDMSB,kFMStubPhiIDLSB>(data_);
   }
 
   FMSTUBR getStubR() const {
-    return data_.range(kFMStubRMSB,kFMStubRLSB);
+    return getBits<kFMStubRMSB,kFMStubRLSB>(data_);
   }
 
   FMPHIRES getPhiRes() const {
-    return data_.range(kFMPhiResMSB,kFMPhiResLSB);
+    return getBits<kFMPhiResMSB,kFMPhiResLSB>(data_);
   }
 
   FMZRES getZRes() const {
-    return data_.range(kFMZResMSB,kFMZResLSB);
+    return getBits<kFMZResMSB,kFMZResLSB>(data_);
   }
 
   // Setter
   void setTCID(const FMTCID tcid) {
-    data_.range(kFMTCIDMSB,kFMTCIDLSB) = tcid;
+    setBits<kFMTCIDMSB,kFMTCIDLSB>(data_, tcid);
   }
 
   void setTrackletIndex(const FMTrackletIndex trackletindex) {
-    data_.range(kFMTrackletIndexMSB,kFMTrackletIndexLSB) = trackletindex;
+    setBits<kFMTrackletIndexMSB,kFMTrackletIndexLSB>(data_, trackletindex);
   }
 
   void setStubIndex(const FMSTUBINDEX stid) {
-    data_.range(kFMStubIndexMSB,kFMStubIndexLSB) = stid;
+    setBits<kFMStubIndexMSB,kFMStubIndexLSB>(data_, stid);
   }
 
   void setStubPhiID(const FMSTUBPHIID stphiid) {
-    data_.range(kFMStubPhiIDMSB,kFMStubPhiIDLSB) = stphiid;
+    setBits<kFMStubPhiIDMSB,kFMStubPhiIDLSB>(data_, stphiid);
   }
 
   void setStubID(const FMSTUBID stid) {
-    data_.range(kFMStubIDMSB,kFMStubIDLSB) = stid;
+    setBits<kFMStubIDMSB,kFMStubIDLSB>(data_, stid);
   }
 
   void setStubR(const FMSTUBR stubr) {
-    data_.range(kFMStubRMSB,kFMStubRLSB) = stubr;
+    setBits<kFMStubRMSB,kFMStubRLSB>(data_, stubr);
   }
 
   void setPhiRes(const FMPHIRES phires) {
-    data_.range(kFMPhiResMSB,kFMPhiResLSB) = phires;
+    setBits<kFMPhiResMSB,kFMPhiResLSB>(data_, phires);
   }
 
   void setZRes(const FMZRES zres) {
-    data_.range(kFMZResMSB,kFMZResLSB) = zres;
+    setBits<kFMZResMSB,kFMZResLSB>(data_, zres);
   }
 
 private:
 
-  FullMatchData data_;
+  typename MemoryWord<FullMatchBase<FMType>::kFullMatchSize>::type data_;
 
 };
 
@@ -6,6 +6,10 @@
 #include "Constants.h"
 #include "AllStubMemory.h"
 #include "DTCStubMemory.h"
+#include "LUTRegistry.h"
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
 
 
 // link map
@@ -23,6 +27,14 @@ static const int kNMEMwidth = 5;
 
 // LUT with phi corrections to the nominal radius. Only used by layers.
 // Values are determined by the radius and the bend of the stub.
+#ifdef LUT_RUNTIME
+const int* const kPhiCorrtable_L1 = LUTRegistry::get<int>("LUTs/VMPhiCorrL1.tab");
+const int* const kPhiCorrtable_L2 = LUTRegistry::get<int>("LUTs/VMPhiCorrL2.tab");
+const int* const kPhiCorrtable_L3 = LUTRegistry::get<int>("LUTs/VMPhiCorrL3.tab");
+const int* const kPhiCorrtable_L4 = LUTRegistry::get<int>("LUTs/VMPhiCorrL4.tab");
+const int* const kPhiCorrtable_L5 = LUTRegistry::get<int>("LUTs/VMPhiCorrL5.tab");
+const int* const kPhiCorrtable_L6 = LUTRegistry::get<int>("LUTs/VMPhiCorrL6.tab");
+#else
 const int kPhiCorrtable_L1[] =
 #include "../emData/LUTs/VMPhiCorrL1.tab"
 ;
@@ -41,6 +53,7 @@ const int kPhiCorrtable_L5[] =
 const int kPhiCorrtable_L6[] =
 #include "../emData/LUTs/VMPhiCorrL6.tab"
 ;
+#endif
 
 
 // // maximum number of IR memories 
@@ -236,6 +249,11 @@ void InputRouter( const BXType bx
 	ap_uint<kNBits_MemAddr> hNStubs[nOMems];
 	ClearCounters<nOMems>(nMems,  hNStubs);
 
+	#ifndef __SYNTHESIS__
+		// the input holds kMaxProc words, so no stubs are left over
+		LoopStatistics loopStats("InputRouter::LOOP_ProcessIR", kMaxProc);
+	#endif
+
 	LOOP_ProcessIR:
 	for (int cStubCounter = 0; cStubCounter < kMaxProc; cStubCounter++) 
 	{
@@ -274,7 +292,7 @@ void InputRouter( const BXType bx
 	  // point to the correct 
 	  // LUT with the phi 
 	  // corrections 
-	  static const int* cLUT; 
+	  const int* cLUT = kPhiCorrtable_L1; 
 	  if( hLyrId == kFrstPSBrlLyr )
 	  {
 	  	cLUT = kPhiCorrtable_L1;
@@ -339,7 +357,13 @@ void InputRouter( const BXType bx
 	  hNStubs[cMemIndx] = hEntries + 1;
 	  // fill memory 
 	  (&hOutputStubs[cMemIndx])->write_mem(bx, hMemWord, hEntries);
+	  #ifndef __SYNTHESIS__
+	  	++loopStats.useful;
+	  #endif
 	}
+	#ifndef __SYNTHESIS__
+		loopStats.record();
+	#endif
 	// update output bx port 
 	bx_o = bx;
 }
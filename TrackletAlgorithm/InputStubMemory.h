@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_InputStubMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // InputStubBase is where we define the bit widths, which depend on the class template parameter
@@ -101,18 +102,18 @@ public:
 
   // Constructors
   InputStub(const InputStubData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<InputStubBase<ISType>::kInputStubSize>(newdata))
   {}
 
   InputStub(const ISR r, const ISZ z, const ISPHI phi, const ISBEND bend):
-    data_( (((r,z),phi),bend) )
+    data_(toMemoryWord<InputStubBase<ISType>::kInputStubSize>((((r,z),phi),bend)))
   {
     static_assert(ISType != DISKPS, "Constructor should not be used for Disk 2S stubs");
   }
 
   // This constructor is only used for stubs in DISK2S
   InputStub(const ISR r, const ISZ z, const ISPHI phi, const ISALPHA alpha, const ISBEND bend):
-    data_( ((((r,z),phi),alpha),bend) ) 
+    data_(toMemoryWord<InputStubBase<ISType>::kInputStubSize>(((((r,z),phi),alpha),bend))) 
   {
     static_assert(ISType == DISKPS, "Constructor should only be used for Disk 2S stubs");
   }
@@ -125,63 +126,63 @@ public:
   InputStub(const char* datastr, int base=16)
   {
     InputStubData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<InputStubBase<ISType>::kInputStubSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return InputStubBase<ISType>::kInputStubSize;}
 
-  InputStubData raw() const {return data_; }
+  InputStubData raw() const {return fromMemoryWord<InputStubBase<ISType>::kInputStubSize>(data_);}
 
   ISR getR() const {
-    return data_.range(kISRMSB,kISRLSB);
+    return getBits<kISRMSB,kISRLSB>(data_);
   }
 
   ISZ getZ() const {
-    return data_.range(kISZMSB,kISZLSB);
+    return getBits<kISZMSB,kISZLSB>(data_);
   }
 
   ISPHI getPhi() const {
-    return data_.range(kISPhiMSB,kISPhiLSB);
+    return getBits<kISPhiMSB,kISPhiLSB>(data_);
   }
 
   // This getter is only used for stubs in DISK2S
   ISALPHA getAlpha() const {
     static_assert(ISType == DISKPS, "Getter should only be used for Disk 2S stubs");
-    return data_.range(kISAlphaMSB,kISAlphaLSB);
+    return getBits<kISAlphaMSB,kISAlphaLSB>(data_);
   }
 
   ISBEND getBend() const {
-    return data_.range(kISBendMSB,kISBendLSB);
+    return getBits<kISBendMSB,kISBendLSB>(data_);
   }
 
   // Setter
   void setR(const ISR r) {
-    data_.range(kISRMSB,kISRLSB) = r;
+    setBits<kISRMSB,kISRLSB>(data_, r);
   }
 
   void setZ(const ISZ z) {
-    data_.range(kISZMSB,kISZLSB) = z;
+    setBits<kISZMSB,kISZLSB>(data_, z);
   }
 
   void setPhi(const ISPHI phi) {
-    data_.range(kISPhiMSB,kISPhiLSB) = phi;
+    setBits<kISPhiMSB,kISPhiLSB>(data_, phi);
   }
 
   // This setter is only used for stubs in DISK2S
   void setAlpha(const ISALPHA alpha) {
     static_assert(ISType == DISKPS, "Setter should only be used for Disk 2S stubs");
-    data_.range(kISAlphaMSB,kISAlphaLSB) = alpha;
+    setBits<kISAlphaMSB,kISAlphaLSB>(data_, alpha);
   }
 
   void setBend(const ISBEND bend) {
-    data_.range(kISBendMSB,kISBendLSB) = bend;
+    setBits<kISBendMSB,kISBendLSB>(data_, bend);
   }
 
 private:
 
-  InputStubData data_;
+  typename MemoryWord<InputStubBase<ISType>::kInputStubSize>::type data_;
 
 };
 
@@ -0,0 +1,154 @@
+// Run-time loading of the LUTs (.tab files) for the C simulation.
+//
+// By default the LUTs are compiled into the modules with
+//   #include "../emData/<module>/tables/<name>.tab"
+// so every change of a table recompiles the module and every executable carries
+// its own copy. If LUT_RUNTIME is defined to the emData directory, e.g.
+//   -DLUT_RUNTIME=\"/path/to/firmware-hls/emData\"
+// the C simulation instead reads each table once, the first time it is needed,
+// and shares it between all modules and threads. The tables are keyed by their
+// path relative to emData/, which identifies the layer/disk and phi region,
+// e.g. "VMR/tables/VMSTE_L1PHIE17n1_vmbendcut.tab". The environment variable
+// LUT_DIR overrides the directory at run time.
+//
+// The synthesis always uses the compiled-in tables.
+#ifndef TrackletAlgorithm_LUTRegistry_h
+#define TrackletAlgorithm_LUTRegistry_h
+
+#ifdef __SYNTHESIS__
+#undef LUT_RUNTIME
+#endif
+
+#ifdef LUT_RUNTIME
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+class LUTRegistry
+{
+public:
+
+  // Returns the table converted to T. If size is given, the table must have
+  // at least size entries. The pointer stays valid until the program exits.
+  template<class T>
+  static const T* get(const std::string& name, unsigned int size = 0) {
+    std::lock_guard<std::mutex> lock(mutex());
+
+    const std::string key = name + ':' + typeid(T).name();
+    auto it = tables().find(key);
+    if (it == tables().end()) {
+      const std::vector<long long>& values = load(name);
+      std::shared_ptr<std::vector<T> > table(new std::vector<T>(values.begin(), values.end()));
+      it = tables().insert(std::make_pair(key, std::shared_ptr<void>(table))).first;
+    }
+
+    const std::vector<T>& table = *std::static_pointer_cast<std::vector<T> >(it->second);
+    if (table.size() < size) {
+      std::cerr << "LUTRegistry: " << name << " has " << table.size()
+                << " entries, expected " << size << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return table.data();
+  }
+
+  // Directory the tables are read from
+  static std::string directory() {
+    const char* dir = std::getenv("LUT_DIR");
+    return dir ? dir : LUT_RUNTIME;
+  }
+
+private:
+
+  static std::mutex& mutex() {
+    static std::mutex m;
+    return m;
+  }
+
+  // Converted tables, keyed by name and type
+  static std::map<std::string, std::shared_ptr<void> >& tables() {
+    static std::map<std::string, std::shared_ptr<void> > t;
+    return t;
+  }
+
+  // Values of the tables as read from file, keyed by name
+  static const std::vector<long long>& load(const std::string& name) {
+    static std::map<std::string, std::vector<long long> > values;
+
+    auto it = values.find(name);
+    if (it != values.end()) return it->second;
+
+    const std::string fileName = directory() + "/" + name;
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      std::cerr << "LUTRegistry: cannot open " << fileName << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    std::vector<long long>& table = values[name];
+    if (st.st_size > 0) {
+      void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        std::cerr << "LUTRegistry: cannot map " << fileName << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (not parse(static_cast<const char*>(map), st.st_size, table)) {
+        std::cerr << "LUTRegistry: cannot parse " << fileName << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      munmap(map, st.st_size);
+    }
+    close(fd);
+
+    return table;
+  }
+
+  // Reads the C initializer list in a .tab file, e.g. "{\n1,\n0,\n};"
+  static bool parse(const char* text, size_t size, std::vector<long long>& table) {
+    const char* end = text + size;
+    for (const char* p = text; p < end; ) {
+      const char c = *p;
+      if (c == '/' && p + 1 < end && p[1] == '/') {
+        while (p < end && *p != '\n') ++p;
+      }
+      else if (std::isalnum(c) || c == '-' || c == '+') {
+        const char* begin = p;
+        while (p < end && (std::isalnum(*p) || *p == '-' || *p == '+')) ++p;
+        const std::string token(begin, p);
+        if (token == "true") table.push_back(1);
+        else if (token == "false") table.push_back(0);
+        else {
+          // Same rules as for C integer literals
+          char* last;
+          table.push_back(std::strtoll(token.c_str(), &last, 0));
+          while (*last == 'u' || *last == 'U' || *last == 'l' || *last == 'L') ++last;
+          if (*last != '\0') return false;
+        }
+      }
+      else if (std::isspace(c) || c == '{' || c == '}' || c == ',' || c == ';') {
+        ++p;
+      }
+      else {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+#endif // LUT_RUNTIME
+
+#endif // TrackletAlgorithm_LUTRegistry_h
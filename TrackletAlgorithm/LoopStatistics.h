@@ -0,0 +1,164 @@
+// Utilisation of the processing loops, for the C simulation only.
+//
+// The modules process their inputs in a loop of a fixed number of iterations
+// (at most kMaxProc) at II=1, and whatever is not processed by then is
+// truncated. For each call, i.e. each event, a loop records
+//   * useful:   the iterations that did useful work (processed a stub,
+//               projection, stub pair, ...),
+//   * stalled:  the iterations in which input was waiting but could not be
+//               read because a buffer was full (these are usually also useful,
+//               as the full buffer is being processed),
+//   * leftover: the inputs not processed when the loop ended.
+// The iterations that were not useful were idle. The counters are filled by the module:
+//   LoopStatistics loopStats("ProjectionRouter::PROC_LOOP", nIterations);
+//   ... loopStats.useful += validin; ...
+//   loopStats.record();
+// They are kept only if the environment variable LOOP_STATISTICS is set to a
+// file name (.csv or .json), to which they are written at the end of the
+// program. The CSV file has one line per loop and event, the JSON file a
+// summary of each loop and its counters per event.
+#ifndef TrackletAlgorithm_LoopStatistics_h
+#define TrackletAlgorithm_LoopStatistics_h
+
+#ifndef __SYNTHESIS__
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class LoopStatistics
+{
+public:
+
+  LoopStatistics(const char* name, unsigned int iterations): name_(name), iterations(iterations) {}
+
+  // Adds the counters as one event of the loop
+  void record() const {
+    Registry& r = registry();
+    if (not r.enabled) return;
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.loops[name_].push_back(*this);
+  }
+
+  unsigned int idle() const {
+    return (useful < iterations) ? iterations - useful : 0;
+  }
+
+  // Writes the events recorded so far as CSV or JSON, depending on the file
+  // extension
+  static bool write(const std::string& fileName) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    return write(fileName, r.loops);
+  }
+
+private:
+
+  typedef std::map<std::string, std::vector<LoopStatistics> > Loops;
+
+  const char* name_;
+
+public:
+
+  const unsigned int iterations;
+  unsigned int useful = 0;
+  unsigned int stalled = 0;
+  unsigned int leftover = 0;
+
+private:
+
+  static bool write(const std::string& fileName, const Loops& loops) {
+    const bool json = fileName.size() >= 5 && fileName.compare(fileName.size() - 5, 5, ".json") == 0;
+    std::ofstream out(fileName);
+    if (json) writeJSON(out, loops);
+    else writeCSV(out, loops);
+    return out.good();
+  }
+
+  static void writeCSV(std::ostream& out, const Loops& loops) {
+    out << "loop,event,iterations,useful,stalled,idle,leftover\n";
+    for (const auto& loop : loops) {
+      for (unsigned int ievt = 0; ievt < loop.second.size(); ++ievt) {
+        const LoopStatistics& s = loop.second[ievt];
+        out << loop.first << ',' << ievt << ',' << s.iterations << ',' << s.useful << ','
+            << s.stalled << ',' << s.idle() << ',' << s.leftover << '\n';
+      }
+    }
+  }
+
+  static void writeJSON(std::ostream& out, const Loops& loops) {
+    out << "{\n  \"loops\": [";
+    bool first = true;
+    for (const auto& loop : loops) {
+      const std::vector<LoopStatistics>& events = loop.second;
+      unsigned long useful = 0, stalled = 0, leftover = 0, truncated = 0;
+      unsigned int maxUseful = 0, maxStalled = 0, maxLeftover = 0;
+      for (const auto& s : events) {
+        useful += s.useful;
+        stalled += s.stalled;
+        leftover += s.leftover;
+        if (s.leftover) ++truncated;
+        maxUseful = std::max(maxUseful, s.useful);
+        maxStalled = std::max(maxStalled, s.stalled);
+        maxLeftover = std::max(maxLeftover, s.leftover);
+      }
+      const double n = events.size();
+
+      out << (first ? "\n" : ",\n") << "    {\n"
+          << "      \"name\": \"" << loop.first << "\",\n"
+          << "      \"events\": " << events.size() << ",\n"
+          << "      \"iterations\": " << events.front().iterations << ",\n"
+          << "      \"mean_useful\": " << useful / n << ",\n"
+          << "      \"max_useful\": " << maxUseful << ",\n"
+          << "      \"mean_stalled\": " << stalled / n << ",\n"
+          << "      \"max_stalled\": " << maxStalled << ",\n"
+          << "      \"mean_leftover\": " << leftover / n << ",\n"
+          << "      \"max_leftover\": " << maxLeftover << ",\n"
+          << "      \"truncated_events\": " << truncated << ",\n";
+      writeJSONArray(out, "useful", events, &LoopStatistics::useful);
+      out << ",\n";
+      writeJSONArray(out, "stalled", events, &LoopStatistics::stalled);
+      out << ",\n";
+      writeJSONArray(out, "leftover", events, &LoopStatistics::leftover);
+      out << "\n    }";
+      first = false;
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  static void writeJSONArray(std::ostream& out, const char* name, const std::vector<LoopStatistics>& events,
+                             unsigned int LoopStatistics::* counter) {
+    out << "      \"" << name << "\": [";
+    for (unsigned int ievt = 0; ievt < events.size(); ++ievt)
+      out << (ievt ? ", " : "") << events[ievt].*counter;
+    out << ']';
+  }
+
+  // Events of all loops, written to $LOOP_STATISTICS when the program ends
+  struct Registry {
+    const char* fileName = std::getenv("LOOP_STATISTICS");
+    const bool enabled = (fileName != nullptr);
+    std::mutex mutex;
+    Loops loops;
+
+    ~Registry() {
+      if (not enabled || loops.empty()) return;
+      if (not write(fileName, loops))
+        std::cerr << "Could not write the loop statistics to " << fileName << std::endl;
+    }
+  };
+
+  static Registry& registry() {
+    static Registry r;
+    return r;
+  }
+};
+
+#endif // __SYNTHESIS__
+
+#endif
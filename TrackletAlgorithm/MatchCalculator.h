@@ -8,11 +8,15 @@
 #include "AllStubMemory.h"
 #include "AllProjectionMemory.h"
 #include "FullMatchMemory.h"
+#include "LUTRegistry.h"
 
 //////////////////////////////////////////////////////////////
 
-template<int layer, int part>
-void merger(
+// Merges the two streams of candidate matches inA and inB, each sorted by
+// projection index, into the sorted stream out. It is one clock of the
+// pipeline: the state at this clock (out, A, B, ...) is given and that of
+// the next clock (outnext, Anext, Bnext, ...) is returned.
+inline void merger(
      // inputs
      CandidateMatch inA,
      bool validA,
@@ -50,8 +54,8 @@ void merger(
     *readA = (((inread || !vout) && sA) || !vA) && validA;
     *readB = (((inread || !vout) && sB) || !vB) && validB;
 
-    // Setup state machine
-    static enum {HOLD, PROC_A, PROC_B, START, DONE} state;
+    // Setup state machine. The state only depends on the inputs of this clock.
+    enum {HOLD, PROC_A, PROC_B, START, DONE} state;
     if (sA && (inread || !vout))                          state = PROC_A;
     else if (sB && (inread || !vout))                     state = PROC_B; 
     else if ((!sA && !sB) && (validA || validB) && !vout) state = START;
@@ -129,6 +133,150 @@ void merger(
 
 //////////////////////////////////////////////////////////////
 
+// Number of levels of a binary tree of mergers with n inputs (at least 1)
+constexpr int mergerLevels(int n) {
+  return (n <= 2) ? 1 : 1 + mergerLevels((n + 1) / 2);
+}
+
+// Binary tree of mergers giving one stream of candidate matches, sorted by
+// projection index, from NInputs candidate match memories. The mergers are
+// numbered as in a heap: merger 1 gives the output, merger n merges the
+// outputs of mergers 2n (A) and 2n+1 (B), and input memory i is input
+// kNLeaves+i. The inputs from NInputs to the next power of two are never
+// valid, so that the mergers fed only by them are optimized away.
+//
+// At each clock, the inputs read at the previous clock move to their next
+// address, and each level of mergers takes the outputs of the level below at
+// the same clock, as did the tree of 8 inputs written out by hand.
+template<int NInputs>
+class CandidateMatchMerger {
+
+ public:
+  enum {
+    kNLevels = mergerLevels(NInputs),
+    kNLeaves = 1 << kNLevels  // inputs of the tree, a power of two
+  };
+
+  CandidateMatchMerger() {
+#pragma HLS inline
+    reset_mergers : for (int n = 0; n < kNLeaves; n++) {
+#pragma HLS unroll
+      out_[n] = CandidateMatch();
+      A_[n] = CandidateMatch();
+      B_[n] = CandidateMatch();
+      vout_[n] = false;
+      vA_[n] = false;
+      vB_[n] = false;
+      sA_[n] = false;
+      sB_[n] = false;
+    }
+    reset_reads : for (int n = 0; n < 2 * kNLeaves; n++) {
+#pragma HLS unroll
+      read_[n] = false;
+    }
+    reset_addresses : for (int i = 0; i < NInputs; i++) {
+#pragma HLS unroll
+      addr_[i] = 0;
+    }
+  }
+
+  // One clock of the tree
+  void step(BXType bx, const CandidateMatchMemory match[NInputs]) {
+#pragma HLS inline
+#pragma HLS array_partition variable=out_ complete dim=0
+#pragma HLS array_partition variable=A_ complete dim=0
+#pragma HLS array_partition variable=B_ complete dim=0
+#pragma HLS array_partition variable=vout_ complete dim=0
+#pragma HLS array_partition variable=vA_ complete dim=0
+#pragma HLS array_partition variable=vB_ complete dim=0
+#pragma HLS array_partition variable=sA_ complete dim=0
+#pragma HLS array_partition variable=sB_ complete dim=0
+#pragma HLS array_partition variable=read_ complete dim=0
+#pragma HLS array_partition variable=addr_ complete dim=0
+
+    // Read in each candidate match, moving to the next one if it was read
+    CandidateMatch cm[kNLeaves];
+    bool valid[kNLeaves];
+#pragma HLS array_partition variable=cm complete dim=0
+#pragma HLS array_partition variable=valid complete dim=0
+    read_inputs : for (int i = 0; i < kNLeaves; i++) {
+#pragma HLS unroll
+      if (i < NInputs) {
+        if (read_[kNLeaves + i]) addr_[i]++;
+        const ap_uint<kNBits_MemAddr> ncm = match[i].getEntries(bx);
+        cm[i] = match[i].read_mem(bx, addr_[i]);
+        valid[i] = (addr_[i] < ncm) && (ncm > 0);
+      }
+      else {
+        cm[i] = CandidateMatch();
+        valid[i] = false;
+      }
+    }
+
+    // Mergers from the inputs to the output
+    CandidateMatch out_next[kNLeaves], A_next[kNLeaves], B_next[kNLeaves];
+    bool vout_next[kNLeaves], vA_next[kNLeaves], vB_next[kNLeaves], sA_next[kNLeaves], sB_next[kNLeaves];
+    bool read_next[2 * kNLeaves];
+#pragma HLS array_partition variable=out_next complete dim=0
+#pragma HLS array_partition variable=A_next complete dim=0
+#pragma HLS array_partition variable=B_next complete dim=0
+#pragma HLS array_partition variable=vout_next complete dim=0
+#pragma HLS array_partition variable=vA_next complete dim=0
+#pragma HLS array_partition variable=vB_next complete dim=0
+#pragma HLS array_partition variable=sA_next complete dim=0
+#pragma HLS array_partition variable=sB_next complete dim=0
+#pragma HLS array_partition variable=read_next complete dim=0
+    read_next[0] = false;
+    read_next[1] = false;
+    mergers : for (int n = kNLeaves - 1; n > 0; n--) {
+#pragma HLS unroll
+      const bool leaves = (2 * n >= kNLeaves);
+      merger(
+        leaves ? cm[2 * n - kNLeaves] : out_next[2 * n],            // inputs: inA, validA
+        leaves ? valid[2 * n - kNLeaves] : vout_next[2 * n],
+        leaves ? cm[2 * n + 1 - kNLeaves] : out_next[2 * n + 1],    // inputs: inB, validB
+        leaves ? valid[2 * n + 1 - kNLeaves] : vout_next[2 * n + 1],
+        out_[n], vout_[n], (n == 1) || read_[n],                    // inputs: out, vout, inread (always for the output)
+        A_[n], vA_[n], sA_[n],                                      // tmp variables internal to the merger
+        B_[n], vB_[n], sB_[n],                                      // tmp variables internal to the merger
+        &A_next[n], &vA_next[n], &sA_next[n],                       // tmp variables internal to the merger
+        &B_next[n], &vB_next[n], &sB_next[n],                       // tmp variables internal to the merger
+        &out_next[n], &vout_next[n],                                // outputs: out, vout
+        &read_next[2 * n], &read_next[2 * n + 1]                    // outputs: read inA, read inB
+      );
+    }
+
+    // pipeline the variables
+    update_mergers : for (int n = 1; n < kNLeaves; n++) {
+#pragma HLS unroll
+      out_[n] = out_next[n];
+      A_[n] = A_next[n];
+      B_[n] = B_next[n];
+      vout_[n] = vout_next[n];
+      vA_[n] = vA_next[n];
+      vB_[n] = vB_next[n];
+      sA_[n] = sA_next[n];
+      sB_[n] = sB_next[n];
+    }
+    update_reads : for (int n = 2; n < 2 * kNLeaves; n++) {
+#pragma HLS unroll
+      read_[n] = read_next[n];
+    }
+  }
+
+  // Output of the tree after the last clock
+  const CandidateMatch& getOutput() const { return out_[1]; }
+  bool getValid() const { return vout_[1]; }
+
+ private:
+  CandidateMatch out_[kNLeaves], A_[kNLeaves], B_[kNLeaves];
+  bool vout_[kNLeaves], vA_[kNLeaves], vB_[kNLeaves], sA_[kNLeaves], sB_[kNLeaves];
+  bool read_[2 * kNLeaves];  // read of the input of merger n/2, or of input memory n-kNLeaves
+  ap_uint<kNBits_MemAddr> addr_[NInputs];
+};
+
+//////////////////////////////////////////////////////////////
+
 // Absolute value template
 
 template< int width >
@@ -147,6 +295,14 @@ ap_uint<width> iabs( ap_int<width> value )
 // Table for phi or z cuts
 template<bool phi, TF::layerDisk L, int width, int depth>
 void readTable_Cuts(ap_uint<width> table[depth]){
+#ifdef LUT_RUNTIME
+  // Only the layers have tables, as below
+  if (L <= TF::L6) {
+    static const ap_uint<width>* tmp = LUTRegistry::get<ap_uint<width> >(
+      std::string("MC/tables/MC_L") + std::to_string(L+1) + "PHIC_" + (phi ? "phicut" : "zcut") + ".tab", depth);
+    for (int i = 0; i < depth; i++) table[i] = tmp[i];
+  }
+#else
   if (phi){ // phi cuts
     if (L==TF::L1){
       ap_uint<width> tmp[depth] =
@@ -218,6 +374,7 @@ void readTable_Cuts(ap_uint<width> table[depth]){
     }
  
   }
+#endif // LUT_RUNTIME
 
 } // end readTable_Cuts
 
@@ -285,36 +442,8 @@ void MatchCalculator(BXType bx,
   CandidateMatch::CMProjIndex id;
   CandidateMatch::CMProjIndex id_next;
 
-  ap_uint<kNBits_MemAddr> ncm1 = 0; 
-  ap_uint<kNBits_MemAddr> ncm2 = 0;
-  ap_uint<kNBits_MemAddr> ncm3 = 0;
-  ap_uint<kNBits_MemAddr> ncm4 = 0;
-  ap_uint<kNBits_MemAddr> ncm5 = 0;
-  ap_uint<kNBits_MemAddr> ncm6 = 0;
-  ap_uint<kNBits_MemAddr> ncm7 = 0;
-  ap_uint<kNBits_MemAddr> ncm8 = 0;
-  ap_uint<kNBits_MemAddr+1> total  = 0;
-  ap_uint<kNBits_MemAddr> ncm = 0;
-
-  // Initialize read addresses for candidate matches
-  ap_uint<kNBits_MemAddr> addr1 = 0;  
-  ap_uint<kNBits_MemAddr> addr2 = 0;  
-  ap_uint<kNBits_MemAddr> addr3 = 0;  
-  ap_uint<kNBits_MemAddr> addr4 = 0;  
-  ap_uint<kNBits_MemAddr> addr5 = 0;  
-  ap_uint<kNBits_MemAddr> addr6 = 0;  
-  ap_uint<kNBits_MemAddr> addr7 = 0;  
-  ap_uint<kNBits_MemAddr> addr8 = 0; 
-
-  // Read signals for the input candidate matches
-  bool read1 = false;
-  bool read2 = false;
-  bool read3 = false;
-  bool read4 = false;
-  bool read5 = false;
-  bool read6 = false;
-  bool read7 = false;
-  bool read8 = false;
+  // Merger tree of the input candidate matches
+  CandidateMatchMerger<MaxMatchCopies> cmMerger;
 
   // MC_L3PHIC mask {1: on, 0: off}
   //static const uint16_t FML1L2 = 1 << shift_L1L2;
@@ -326,74 +455,6 @@ void MatchCalculator(BXType bx,
   //static const uint16_t FML1D1 = 0 << shift_L1D1;
   //static const uint16_t FML2D1 = 0 << shift_L2D1;
 
-  // Variables for the merger
-  // layer 1 variables
-  bool read_L1_1 = false;
-  bool read_L1_2 = false;
-  bool read_L1_3 = false;
-  bool read_L1_4 = false;
-  CandidateMatch cm_L1_1 = CandidateMatch();
-  CandidateMatch cm_L1_2 = CandidateMatch();
-  CandidateMatch cm_L1_3 = CandidateMatch();
-  CandidateMatch cm_L1_4 = CandidateMatch();
-  CandidateMatch tmpA_L1_1 = CandidateMatch();
-  CandidateMatch tmpA_L1_2 = CandidateMatch();
-  CandidateMatch tmpA_L1_3 = CandidateMatch();
-  CandidateMatch tmpA_L1_4 = CandidateMatch();
-  CandidateMatch tmpB_L1_1 = CandidateMatch();
-  CandidateMatch tmpB_L1_2 = CandidateMatch();
-  CandidateMatch tmpB_L1_3 = CandidateMatch();
-  CandidateMatch tmpB_L1_4 = CandidateMatch();
-  bool valid_L1_1 = false; 
-  bool valid_L1_2 = false; 
-  bool valid_L1_3 = false; 
-  bool valid_L1_4 = false; 
-  bool vA_L1_1 = false; 
-  bool vA_L1_2 = false; 
-  bool vA_L1_3 = false; 
-  bool vA_L1_4 = false; 
-  bool vB_L1_1 = false; 
-  bool vB_L1_2 = false; 
-  bool vB_L1_3 = false; 
-  bool vB_L1_4 = false; 
-  bool sA_L1_1 = false; 
-  bool sA_L1_2 = false; 
-  bool sA_L1_3 = false; 
-  bool sA_L1_4 = false; 
-  bool sB_L1_1 = false; 
-  bool sB_L1_2 = false; 
-  bool sB_L1_3 = false; 
-  bool sB_L1_4 = false; 
-
-  // layer 2 variables
-  bool read_L2_1 = false;
-  bool read_L2_2 = false;
-  CandidateMatch cm_L2_1 = CandidateMatch();
-  CandidateMatch cm_L2_2 = CandidateMatch();
-  CandidateMatch tmpA_L2_1 = CandidateMatch();
-  CandidateMatch tmpA_L2_2 = CandidateMatch();
-  CandidateMatch tmpB_L2_1 = CandidateMatch();
-  CandidateMatch tmpB_L2_2 = CandidateMatch();
-  bool valid_L2_1 = false; 
-  bool valid_L2_2 = false; 
-  bool vA_L2_1 = false; 
-  bool vA_L2_2 = false; 
-  bool vB_L2_1 = false; 
-  bool vB_L2_2 = false; 
-  bool sA_L2_1 = false; 
-  bool sA_L2_2 = false; 
-  bool sB_L2_1 = false; 
-  bool sB_L2_2 = false; 
-
-  // layer 3 variables
-  CandidateMatch tmpA_L3;
-  CandidateMatch tmpB_L3;
-  bool valid_L3 = false;
-  bool vA_L3 = false;
-  bool vB_L3 = false;
-  bool sA_L3 = false;
-  bool sB_L3 = false;
-  
   // Setup candidate match data stream that goes into match calculations
   CandidateMatch datastream = CandidateMatch();
 
@@ -406,311 +467,24 @@ void MatchCalculator(BXType bx,
   //-----------------------------------------------------------------------------------------------------------
   //-------------------------------- DATA PROCESSING STARTS ---------------------------------------------------
   //-----------------------------------------------------------------------------------------------------------
-  // declare counters for each of the 8 output VMProj // !!!
-  ap_uint<kNBits_MemAddr> nmcout1 = 0;
-  ap_uint<kNBits_MemAddr> nmcout2 = 0;
-  ap_uint<kNBits_MemAddr> nmcout3 = 0;
-  ap_uint<kNBits_MemAddr> nmcout4 = 0;
-  ap_uint<kNBits_MemAddr> nmcout5 = 0;
-  ap_uint<kNBits_MemAddr> nmcout6 = 0;
-  ap_uint<kNBits_MemAddr> nmcout7 = 0;
-  ap_uint<kNBits_MemAddr> nmcout8 = 0;  
+  // declare counters for each of the output full match memories
+  ap_uint<kNBits_MemAddr> nmcout[MaxFullMatchCopies];
+#pragma HLS array_partition variable=nmcout complete dim=0
+  reset_nmcout : for (int i = 0; i < MaxFullMatchCopies; i++) {
+#pragma HLS unroll
+    nmcout[i] = 0;
+  }
   MC_LOOP: for (ap_uint<kNBits_MemAddr> istep = 0; istep < kMaxProc - kMaxProcOffset(module::MC); istep++)
   {
 
 #pragma HLS PIPELINE II=1 
 
-    // Pick up number of candidate matches for each CM memory
-    ncm1 = match[0].getEntries(bx);
-    ncm2 = match[1].getEntries(bx);
-    ncm3 = match[2].getEntries(bx);
-    ncm4 = match[3].getEntries(bx);
-    ncm5 = match[4].getEntries(bx);
-    ncm6 = match[5].getEntries(bx);
-    ncm7 = match[6].getEntries(bx);
-    ncm8 = match[7].getEntries(bx);
-
-    // Count up total number of CMs *and protect incase of overflow)
-    total  = ncm1+ncm2+ncm3+ncm4+ncm5+ncm6+ncm7+ncm8; 
-    ncm    = (total > kMaxProc)? kMaxProc : total.range(7,0);
-
-    // pipeline variables
-    bool read_L1_1_next = false;
-    bool read_L1_2_next = false;
-    bool read_L1_3_next = false;
-    bool read_L1_4_next = false;
-    CandidateMatch cm_L1_1_next = CandidateMatch();
-    CandidateMatch cm_L1_2_next = CandidateMatch();
-    CandidateMatch cm_L1_3_next = CandidateMatch();
-    CandidateMatch cm_L1_4_next = CandidateMatch();
-    CandidateMatch tmpA_L1_1_next = CandidateMatch();
-    CandidateMatch tmpA_L1_2_next = CandidateMatch();
-    CandidateMatch tmpA_L1_3_next = CandidateMatch();
-    CandidateMatch tmpA_L1_4_next = CandidateMatch();
-    CandidateMatch tmpB_L1_1_next = CandidateMatch();
-    CandidateMatch tmpB_L1_2_next = CandidateMatch();
-    CandidateMatch tmpB_L1_3_next = CandidateMatch();
-    CandidateMatch tmpB_L1_4_next = CandidateMatch();
-    bool valid_L1_1_next = false;
-    bool valid_L1_2_next = false;
-    bool valid_L1_3_next = false;
-    bool valid_L1_4_next = false;
-    bool vA_L1_1_next = false; 
-    bool vA_L1_2_next = false; 
-    bool vA_L1_3_next = false; 
-    bool vA_L1_4_next = false; 
-    bool vB_L1_1_next = false; 
-    bool vB_L1_2_next = false; 
-    bool vB_L1_3_next = false; 
-    bool vB_L1_4_next = false; 
-    bool sA_L1_1_next = false; 
-    bool sA_L1_2_next = false; 
-    bool sA_L1_3_next = false; 
-    bool sA_L1_4_next = false; 
-    bool sB_L1_1_next = false; 
-    bool sB_L1_2_next = false; 
-    bool sB_L1_3_next = false; 
-    bool sB_L1_4_next = false; 
-
-    bool read_L2_1_next = false;
-    bool read_L2_2_next = false;
-    CandidateMatch cm_L2_1_next = CandidateMatch();
-    CandidateMatch cm_L2_2_next = CandidateMatch();
-    CandidateMatch tmpA_L2_1_next = CandidateMatch();
-    CandidateMatch tmpA_L2_2_next = CandidateMatch();
-    CandidateMatch tmpB_L2_1_next = CandidateMatch();
-    CandidateMatch tmpB_L2_2_next = CandidateMatch();
-    bool valid_L2_1_next = false; 
-    bool valid_L2_2_next = false; 
-    bool vA_L2_1_next = false; 
-    bool vA_L2_2_next = false; 
-    bool vB_L2_1_next = false; 
-    bool vB_L2_2_next = false; 
-    bool sA_L2_1_next = false; 
-    bool sA_L2_2_next = false; 
-    bool sB_L2_1_next = false; 
-    bool sB_L2_2_next = false; 
-
-    CandidateMatch cm_L3_next;
-    CandidateMatch tmpA_L3_next;
-    CandidateMatch tmpB_L3_next; 
-    bool valid_L3_next = false;
-    bool vA_L3_next = false;
-    bool vB_L3_next = false;
-    bool sA_L3_next = false;
-    bool sB_L3_next = false;
-    bool read1_next = false;
-    bool read2_next = false;
-    bool read3_next = false;
-    bool read4_next = false;
-    bool read5_next = false;
-    bool read6_next = false;
-    bool read7_next = false;
-    bool read8_next = false;
-
-
     //-----------------------------------------------------------------------------------------------------------
     //-------------------------------- MERGE INPUT CANDIDATE MATCHES --------------------------------------------
     //-----------------------------------------------------------------------------------------------------------
 
-    // Increment the read addresses for the candidate matches
-
-    if (read1) addr1++;
-    if (read2) addr2++;
-    if (read3) addr3++;
-    if (read4) addr4++;
-    if (read5) addr5++;
-    if (read6) addr6++;
-    if (read7) addr7++;
-    if (read8) addr8++;
-
-    // Read in each candidate match
-    const CandidateMatch &cm1 = match[0].read_mem(bx,addr1);
-    const CandidateMatch &cm2 = match[1].read_mem(bx,addr2);
-    const CandidateMatch &cm3 = match[2].read_mem(bx,addr3); 
-    const CandidateMatch &cm4 = match[3].read_mem(bx,addr4); 
-    const CandidateMatch &cm5 = match[4].read_mem(bx,addr5); 
-    const CandidateMatch &cm6 = match[5].read_mem(bx,addr6); 
-    const CandidateMatch &cm7 = match[6].read_mem(bx,addr7); 
-    const CandidateMatch &cm8 = match[7].read_mem(bx,addr8); 
-
-    // Valid signal for the candidate match
-    bool valid1 = (addr1 < ncm1) && (ncm1 > 0);
-    bool valid2 = (addr2 < ncm2) && (ncm2 > 0);
-    bool valid3 = (addr3 < ncm3) && (ncm3 > 0);
-    bool valid4 = (addr4 < ncm4) && (ncm4 > 0);
-    bool valid5 = (addr5 < ncm5) && (ncm5 > 0);
-    bool valid6 = (addr6 < ncm6) && (ncm6 > 0);
-    bool valid7 = (addr7 < ncm7) && (ncm7 > 0);
-    bool valid8 = (addr8 < ncm8) && (ncm8 > 0);
-
-    // merger Layer 1 Part 1
-    merger<1,1>(
-      cm1, valid1, cm2, valid2,                      // inputs: inA, validA, inB, validB
-      cm_L1_1, valid_L1_1, read_L1_1,                // inputs: out, vout, inread from L2_1
-      tmpA_L1_1, vA_L1_1, sA_L1_1,                   // tmp variables internal to L1_1 merger
-      tmpB_L1_1, vB_L1_1, sB_L1_1,                   // tmp variables internal to L1_1 merger
-      &tmpA_L1_1_next, &vA_L1_1_next, &sA_L1_1_next, // tmp variables internal to L1_1 merger
-      &tmpB_L1_1_next, &vB_L1_1_next, &sB_L1_1_next, // tmp variables internal to L1_1 merger
-      &cm_L1_1_next, &valid_L1_1_next,               // outputs: out, vout
-      &read1_next, &read2_next                       // outputs: read1, read2 
-    );
-
-    // merger Layer 1 Part 2
-    merger<1,2>(
-      cm3, valid3, cm4, valid4,                      // inputs: inA, validA, inB, validB
-      cm_L1_2, valid_L1_2, read_L1_2,                // inputs: out, vout, inread from L2_1
-      tmpA_L1_2, vA_L1_2, sA_L1_2,                   // tmp variables internal to L1_2 merger
-      tmpB_L1_2, vB_L1_2, sB_L1_2,                   // tmp variables internal to L1_2 merger
-      &tmpA_L1_2_next, &vA_L1_2_next, &sA_L1_2_next, // tmp variables internal to L1_2 merger
-      &tmpB_L1_2_next, &vB_L1_2_next, &sB_L1_2_next, // tmp variables internal to L1_2 merger
-      &cm_L1_2_next, &valid_L1_2_next,               // outputs: out, vout
-      &read3_next, &read4_next                       // outputs: read3, read4 
-    );
-
-    // merger Layer 1 Part 3 
-    merger<1,3>(
-      cm5, valid5, cm6, valid6,                      // inputs: inA, validA, inB, validB
-      cm_L1_3, valid_L1_3, read_L1_3,                // inputs: out, vout, inread from L2_1
-      tmpA_L1_3, vA_L1_3, sA_L1_3,                   // tmp variables internal to L1_3 merger
-      tmpB_L1_3, vB_L1_3, sB_L1_3,                   // tmp variables internal to L1_3 merger
-      &tmpA_L1_3_next, &vA_L1_3_next, &sA_L1_3_next, // tmp variables internal to L1_3 merger
-      &tmpB_L1_3_next, &vB_L1_3_next, &sB_L1_3_next, // tmp variables internal to L1_3 merger
-      &cm_L1_3_next, &valid_L1_3_next,               // outputs: out, vout
-      &read5_next, &read6_next                       // outputs: read5, read6 
-    );
-
-    // merger Layer 1 Part 4  
-    merger<1,4>(
-      cm7, valid7, cm8, valid8,                      // inputs: inA, validA, inB, validB
-      cm_L1_4, valid_L1_4, read_L1_4,                // inputs: out, vout, inread from L2_1
-      tmpA_L1_4, vA_L1_4, sA_L1_4,                   // tmp variables internal to L1_4 merger
-      tmpB_L1_4, vB_L1_4, sB_L1_4,                   // tmp variables internal to L1_4 merger
-      &tmpA_L1_4_next, &vA_L1_4_next, &sA_L1_4_next, // tmp variables internal to L1_4 merger
-      &tmpB_L1_4_next, &vB_L1_4_next, &sB_L1_4_next, // tmp variables internal to L1_4 merger
-      &cm_L1_4_next, &valid_L1_4_next,               // outputs: out, vout
-      &read7_next, &read8_next                       // outputs: read7, read8 
-    );
-
-    // merger Layer 2 Part 1
-    merger<2,1>(
-      cm_L1_1_next, valid_L1_1_next,                 // inputs: inA, validA
-      cm_L1_2_next, valid_L1_2_next,                 // inputs: inB, validB
-      cm_L2_1, valid_L2_1, read_L2_1,                // inputs: out, vout, inread from L3_1
-      tmpA_L2_1, vA_L2_1, sA_L2_1,                   // tmp variables internal to L2_1 merger
-      tmpB_L2_1, vB_L2_1, sB_L2_1,                   // tmp variables internal to L2_1 merger
-      &tmpA_L2_1_next, &vA_L2_1_next, &sA_L2_1_next, // tmp variables internal to L2_1 merger
-      &tmpB_L2_1_next, &vB_L2_1_next, &sB_L2_1_next, // tmp variables internal to L2_1 merger
-      &cm_L2_1_next, &valid_L2_1_next,               // outputs: out, vout
-      &read_L1_1_next, &read_L1_2_next               // outputs: read_L1_1, read_L1_2
-    );
-
-    // merger Layer 2 Part 2
-    merger<2,2>(
-      cm_L1_3_next, valid_L1_3_next,                 // inputs: inA, validA 
-      cm_L1_4_next, valid_L1_4_next,                 // inputs: inB, validB
-      cm_L2_2, valid_L2_2, read_L2_2,                // inputs: out, vout, inread from L3_1
-      tmpA_L2_2, vA_L2_2, sA_L2_2,                   // tmp variables internal to L2_2 merger
-      tmpB_L2_2, vB_L2_2, sB_L2_2,                   // tmp variables internal to L2_2 merger
-      &tmpA_L2_2_next, &vA_L2_2_next, &sA_L2_2_next, // tmp variables internal to L2_2 merger
-      &tmpB_L2_2_next, &vB_L2_2_next, &sB_L2_2_next, // tmp variables internal to L2_2 merger
-      &cm_L2_2_next, &valid_L2_2_next,               // outputs: out, vout
-      &read_L1_3_next, &read_L1_4_next               // outputs: read_L1_3, read_L1_4
-    );
-
-    // merger Layer 3 Part 1
-    merger<3,1>(
-      cm_L2_1_next, valid_L2_1_next,           // inputs: inA, validA 
-      cm_L2_2_next, valid_L2_2_next,           // inputs: inB, validB
-      datastream, valid_L3, true,              // inputs: out, vout, true inread because last layer
-      tmpA_L3, vA_L3, sA_L3,                   // tmp variables internal to L3_1 merger
-      tmpB_L3, vB_L3, sB_L3,                   // tmp variables internal to L3_1 merger
-      &tmpA_L3_next, &vA_L3_next, &sA_L3_next, // tmp variables internal to L3_1 merger
-      &tmpB_L3_next, &vB_L3_next, &sB_L3_next, // tmp variables internal to L3_1 merger
-      &cm_L3_next, &valid_L3_next,             // outputs: out, vout
-      &read_L2_1_next, &read_L2_2_next         // outputs: read_L2_1, read_L2_2
-    );
-
-    // pipeline the variables
-    // set up the inputs for the next iteration of the loop
-
-    read1      = read1_next;
-    read2      = read2_next;
-    read3      = read3_next;
-    read4      = read4_next;
-    read5      = read5_next;
-    read6      = read6_next;
-    read7      = read7_next;
-    read8      = read8_next;
-
-    read_L1_1  = read_L1_1_next;
-    read_L1_2  = read_L1_2_next;
-    read_L1_3  = read_L1_3_next;
-    read_L1_4  = read_L1_4_next;
-    read_L2_1  = read_L2_1_next;
-    read_L2_2  = read_L2_2_next;
-
-    cm_L1_1    = cm_L1_1_next;
-    cm_L1_2    = cm_L1_2_next;
-    cm_L1_3    = cm_L1_3_next;
-    cm_L1_4    = cm_L1_4_next;
-    cm_L2_1    = cm_L2_1_next;
-    cm_L2_2    = cm_L2_2_next;
-    datastream = cm_L3_next;
-
-    valid_L1_1 = valid_L1_1_next;
-    valid_L1_2 = valid_L1_2_next;
-    valid_L1_3 = valid_L1_3_next;
-    valid_L1_4 = valid_L1_4_next;
-    valid_L2_1 = valid_L2_1_next;
-    valid_L2_2 = valid_L2_2_next;
-    valid_L3   = valid_L3_next;
-
-    tmpA_L1_1 = tmpA_L1_1_next;
-    tmpA_L1_2 = tmpA_L1_2_next;
-    tmpA_L1_3 = tmpA_L1_3_next;
-    tmpA_L1_4 = tmpA_L1_4_next;
-    tmpB_L1_1 = tmpB_L1_1_next;
-    tmpB_L1_2 = tmpB_L1_2_next;
-    tmpB_L1_3 = tmpB_L1_3_next;
-    tmpB_L1_4 = tmpB_L1_4_next;
-
-    tmpA_L2_1 = tmpA_L2_1_next;
-    tmpA_L2_2 = tmpA_L2_2_next;
-    tmpB_L2_1 = tmpB_L2_1_next;
-    tmpB_L2_2 = tmpB_L2_2_next;
-    tmpA_L3   = tmpA_L3_next;
-    tmpB_L3   = tmpB_L3_next;
-    
-    vA_L1_1   = vA_L1_1_next; 
-    vA_L1_2   = vA_L1_2_next; 
-    vA_L1_3   = vA_L1_3_next; 
-    vA_L1_4   = vA_L1_4_next; 
-    vB_L1_1   = vB_L1_1_next; 
-    vB_L1_2   = vB_L1_2_next; 
-    vB_L1_3   = vB_L1_3_next; 
-    vB_L1_4   = vB_L1_4_next; 
-    vA_L2_1   = vA_L2_1_next; 
-    vA_L2_2   = vA_L2_2_next; 
-    vB_L2_1   = vB_L2_1_next; 
-    vB_L2_2   = vB_L2_2_next;
-    vA_L3     = vA_L3_next;
-    vB_L3     = vB_L3_next; 
-
-    sA_L1_1   = sA_L1_1_next; 
-    sA_L1_2   = sA_L1_2_next; 
-    sA_L1_3   = sA_L1_3_next; 
-    sA_L1_4   = sA_L1_4_next; 
-    sB_L1_1   = sB_L1_1_next; 
-    sB_L1_2   = sB_L1_2_next; 
-    sB_L1_3   = sB_L1_3_next; 
-    sB_L1_4   = sB_L1_4_next; 
-    sA_L2_1   = sA_L2_1_next; 
-    sA_L2_2   = sA_L2_2_next; 
-    sB_L2_1   = sB_L2_1_next; 
-    sB_L2_2   = sB_L2_2_next;
-    sA_L3     = sA_L3_next;
-    sB_L3     = sB_L3_next; 
+    cmMerger.step(bx, match);
+    datastream = cmMerger.getOutput();
 
     //-----------------------------------------------------------------------------------------------------------
     //-------------------------------------- MATCH CALCULATION STEPS --------------------------------------------
@@ -813,55 +587,13 @@ void MatchCalculator(BXType bx,
     }
 
     if(newtracklet && goodmatch==true) { // Write out only the best match, based on the seeding 
-      switch (projseed) {
-        case 0:
-        if(FMMask<LAYER, PHISEC, TF::L1L2>()) {
-          fullmatch[0].write_mem(bx,bestmatch,nmcout1); // L1L2 seed
-          nmcout1++;
-        }
-        break;
-        case 1:
-        if(FMMask<LAYER, PHISEC, TF::L2L3>()) {
-          fullmatch[1].write_mem(bx,bestmatch,nmcout2); // L2L3 seed
-          nmcout2++;
-        }
-        break;
-        case 2:
-        if(FMMask<LAYER, PHISEC, TF::L3L4>()) {
-          fullmatch[2].write_mem(bx,bestmatch,nmcout3); // L3L4 seed
-          nmcout3++;
+      // Full match memory i holds the matches of seed i (TF::seed)
+      write_fullmatch : for (int i = 0; i < MaxFullMatchCopies; i++) {
+#pragma HLS unroll
+        if (projseed == i && (FMMask<LAYER, PHISEC>() & (1 << i))) {
+          fullmatch[i].write_mem(bx,bestmatch,nmcout[i]);
+          nmcout[i]++;
         }
-        break;
-        case 3:
-        if(FMMask<LAYER, PHISEC, TF::L5L6>()) {
-          fullmatch[3].write_mem(bx,bestmatch,nmcout4); // L5L6 seed
-          nmcout4++;
-        }
-        break;
-        case 4:
-        if(FMMask<LAYER, PHISEC, TF::D1D2>()) {
-          fullmatch[4].write_mem(bx,bestmatch,nmcout5); // D1D2 seed
-          nmcout5++;
-        }
-        break;
-        case 5:
-        if(FMMask<LAYER, PHISEC, TF::D3D4>()) {
-          fullmatch[5].write_mem(bx,bestmatch,nmcout6); // D3D4 seed
-          nmcout6++;
-        }
-        break;
-        case 6:
-        if(FMMask<LAYER, PHISEC, TF::L1D1>()) {
-          fullmatch[6].write_mem(bx,bestmatch,nmcout7); // L1D1 seed
-          nmcout7++;
-        }
-        break;
-        case 7:
-        if(FMMask<LAYER, PHISEC, TF::L2D1>()) {
-          fullmatch[7].write_mem(bx,bestmatch,nmcout8); // L2D1 seed
-          nmcout8++;
-        }
-        break;
       }
     }
 
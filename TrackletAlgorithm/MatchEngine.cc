@@ -1,6 +1,17 @@
 #include "MatchEngine.h"
+#include "LUTRegistry.h"
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
 
 void readTable(ap_uint<1> table[LSIZE]){
+#ifdef LUT_RUNTIME
+	#if LAYER >= 1 && LAYER <= 6
+	static const ap_uint<1>* tmp = LUTRegistry::get<ap_uint<1> >("ME/tables/METable_L" + std::to_string(LAYER) + ".tab", LSIZE);
+	#else
+	static const ap_uint<1> tmp[LSIZE] = {};
+	#endif
+#else
 	ap_uint<1> tmp[LSIZE]=
 	#if LAYER == 1
 #include "../emData/ME/tables/METable_L1.tab"
@@ -17,6 +28,7 @@ void readTable(ap_uint<1> table[LSIZE]){
 	#else
 {};
 	#endif
+#endif // LUT_RUNTIME
 
 	for (int i=0;i<LSIZE;i++){
 		table[i]=tmp[i];
@@ -70,6 +82,10 @@ void MatchEngine(const BXType bx, BXType& bx_o,
 	ap_uint<kNBits_MemAddrBinned> istub=0;
 	#pragma HLS dependence variable=istub intra WAR true
 
+#ifndef __SYNTHESIS__
+	LoopStatistics loopStats("MatchEngine::STEP_LOOP", kMaxProc - kMaxProcOffset(module::ME));
+#endif
+
 #ifdef DEBUG
 	std::cout << "ProjectionIndex\tStubIndex\t<=== (PASS/FAIL)" << std::endl;
 #endif
@@ -93,44 +109,67 @@ void MatchEngine(const BXType bx, BXType& bx_o,
 		// With this you have to assume the buffer will never be absolutely full
 		bool bufferNotEmpty = head_writeindex != tail_readindex;
 
-		// If we have more projections and the buffer is not full we read
-		// next projection and put in buffer if there are stubs in the 
-		// memory the to which the projection points
+#ifndef __SYNTHESIS__
+		loopStats.useful += bufferNotEmpty;
+		loopStats.stalled += (moreProjectionsAvailable && !bufferNotFull);
+#endif
+
+		// If we have more projections and the buffer is not full we read the
+		// next kNMEProjPerClock projections, from as many banks of the
+		// projection memory, and put in the buffer the z-bins with stubs to which
+		// they point. The projections are taken in order as long as their z-bins
+		// fit in the kNMEBinsPerClock free slots, so that a run of projections
+		// pointing to empty z-bins leaves the stub processing idle for half as
+		// many clocks.
 		if (moreProjectionsAvailable && bufferNotFull) {
-			auto const iprojectiontmp=iprojection;
-			auto const projectiondatatmp=inputProjectionData.read_mem(bx,iprojectiontmp);
-			iprojection++;
-			moreProjectionsAvailable=iprojection<nproj;
+			auto const head_writeindex_tmp=head_writeindex;
+			ap_uint<kNBits_MemAddr> naccepted=0;
+			ap_uint<2> nsaved=0;
+			bool accept=true;
 
-			// The first and last zbin the projection points to
-			auto const projectionzbitstmp=projectiondatatmp.getZBin();
-			ap_uint<MEBinsBits> zbinfirst=projectionzbitstmp.range(3,1);
-			ap_uint<MEBinsBits> zbinlast=zbinfirst + projectionzbitstmp.range(0,0);
+			READ_PROJECTIONS: for (unsigned int k=0; k<kNMEProjPerClock; ++k) {
+				#pragma HLS unroll
+				ap_uint<kNBits_MemAddr> iprojectiontmp=iprojection+k;
+				auto const projectiondatatmp=inputProjectionData.read_mem(bx,iprojectiontmp);
 
-			// Check if there are stubs in the memory
-			auto const nstubfirst = inputStubData.getEntries(bx,zbinfirst);
-			auto const nstublast  = inputStubData.getEntries(bx,zbinlast);
-			bool savefirst = (nstubfirst != 0);
-			bool savelast  = (nstublast != 0) && projectionzbitstmp.range(0,0);
-			auto const head_writeindex_tmp=head_writeindex;
+				// The first and last zbin the projection points to
+				auto const projectionzbitstmp=projectiondatatmp.getZBin();
+				ap_uint<MEBinsBits> zbinfirst=projectionzbitstmp.range(3,1);
+				ap_uint<MEBinsBits> zbinlast=zbinfirst + projectionzbitstmp.range(0,0);
 
-			if (savefirst) {
-				ap_uint<1> zero=0;
-				ap_uint<MEBinsBits+1> tmp=zbinfirst.concat(zero);
-				ap_uint<VMProjection<PROJECTIONTYPE>::kVMProjectionSize+MEBinsBits+1> tmp2=projectiondatatmp.raw().concat(tmp);
-				projectionBuffer[head_writeindex_tmp] = nstubfirst.concat(tmp2);
-			}
-			if (savelast) {
-				ap_uint<1> one=1;
-				ap_uint<MEBinsBits+1> tmp=zbinlast.concat(one);
-				ap_uint<VMProjection<PROJECTIONTYPE>::kVMProjectionSize+MEBinsBits+1> tmp2=projectiondatatmp.raw().concat(tmp);
-				ap_uint<kNBits_BufferAddr> head_writeindex_tmp_last = head_writeindex_tmp+savefirst;
-				projectionBuffer[head_writeindex_tmp_last] = nstublast.concat(tmp2);
+				// Check if there are stubs in the memory
+				auto const nstubfirst = inputStubData.getEntries(bx,zbinfirst);
+				auto const nstublast  = inputStubData.getEntries(bx,zbinlast);
+				bool savefirst = (nstubfirst != 0);
+				bool savelast  = (nstublast != 0) && projectionzbitstmp.range(0,0);
+
+				// Take the projection if it exists and its z-bins fit in the buffer
+				accept = accept && (iprojection+k < nproj) && (nsaved + savefirst + savelast <= kNMEBinsPerClock);
+				if (accept) {
+					if (savefirst) {
+						ap_uint<1> zero=0;
+						ap_uint<MEBinsBits+1> tmp=zbinfirst.concat(zero);
+						ap_uint<VMProjection<PROJECTIONTYPE>::kVMProjectionSize+MEBinsBits+1> tmp2=projectiondatatmp.raw().concat(tmp);
+						ap_uint<kNBits_BufferAddr> head_writeindex_tmp_first = head_writeindex_tmp+nsaved;
+						projectionBuffer[head_writeindex_tmp_first] = nstubfirst.concat(tmp2);
+					}
+					if (savelast) {
+						ap_uint<1> one=1;
+						ap_uint<MEBinsBits+1> tmp=zbinlast.concat(one);
+						ap_uint<VMProjection<PROJECTIONTYPE>::kVMProjectionSize+MEBinsBits+1> tmp2=projectiondatatmp.raw().concat(tmp);
+						ap_uint<kNBits_BufferAddr> head_writeindex_tmp_last = head_writeindex_tmp+nsaved+savefirst;
+						projectionBuffer[head_writeindex_tmp_last] = nstublast.concat(tmp2);
+					}
+					nsaved = nsaved + savefirst + savelast;
+					naccepted++;
+				}
 			}
+			iprojection = iprojection + naccepted;
+			moreProjectionsAvailable=iprojection<nproj;
 #ifdef DEBUG
-			std::cout << "Writing " << savefirst+savelast << " z-bins ==> head_writeindex " << head_writeindex << "-->";
+			std::cout << "Writing " << nsaved << " z-bins of " << naccepted << " projections ==> head_writeindex " << head_writeindex << "-->";
 #endif
-			head_writeindex = head_writeindex + savefirst + savelast;
+			head_writeindex = head_writeindex + nsaved;
 #ifdef DEBUG
 			std::cout << head_writeindex << std::endl;
 #endif
@@ -218,6 +257,13 @@ void MatchEngine(const BXType bx, BXType& bx_o,
 		}
 	}
 
+#ifndef __SYNTHESIS__
+	// Projections not read, and z-bins of projections left in the buffer
+	const ap_uint<kNBits_BufferAddr> nbuffered = head_writeindex - tail_readindex;
+	loopStats.leftover = (nproj - iprojection) + nbuffered;
+	loopStats.record();
+#endif
+
 	bx_o = bx;
 }
 
@@ -235,6 +281,9 @@ void MatchEngineTop(const BXType bx, BXType& bx_o,
     #pragma HLS resource variable=inputStubData->get_mem() latency=2
     #pragma HLS resource variable=inputProjectionData->get_mem() latency=2
 #endif
+    // kNMEProjPerClock banks of projections, read in the same clock
+    static_assert(kNMEProjPerClock == 2, "The projection memory is partitioned in kNMEProjPerClock banks");
+    #pragma HLS array_partition variable=inputProjectionData->get_mem() cyclic factor=2 dim=2
 
 	MatchEngine<LAYER,MODULETYPE,PROJECTIONTYPE>(bx, bx_o, inputStubData, inputProjectionData, outputCandidateMatch); 
 }
@@ -54,7 +54,9 @@
 				  + IS_REPRESENTIBLE_IN_D_BITS(32, N)    \
 				  )                                      \
 	  )
+#ifndef LAYER
 #define LAYER 3
+#endif
 //Options: BARREL and DISK
 #define PROJECTIONTYPE BARREL
 #if (LAYER >= 1) && (LAYER <= 3)
@@ -102,6 +104,11 @@ namespace ME {
 }
 constexpr unsigned int kZAdjustment = 8;
 
+// Projections read and screened per clock, from as many interleaved banks of
+// the projection memory, and z-bins written to the buffer per clock
+constexpr unsigned int kNMEProjPerClock = 2;
+constexpr unsigned int kNMEBinsPerClock = 2;
+
 /////////////////////////////
 // -- MATCH ENGINE FUNCTIONS
 void readTable(bool table[LSIZE]);
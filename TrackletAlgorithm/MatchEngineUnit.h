@@ -52,7 +52,7 @@ class MatchEngineUnit : public MatchEngineUnitBase<VMProjType> {
     good__ = false;
   }
   
-  inline void processPipeLine(ap_uint<1> *table) {
+  inline void processPipeLine(const ap_uint<1> *table) {
 #pragma HLS inline
     if (good__) {
       auto stubindex=stubdata__.getIndex();
@@ -210,7 +210,9 @@ inline MATCH read() {
 
 }
 
- inline void step(const VMStubMECM<VMSMEType> stubmem[2][1024]) {
+ // Reads the stubs from copy icopy of the VMStubME memory
+ template<class VMStubMEMemoryType>
+ inline void step(const VMStubMEMemoryType& stubmem, unsigned int icopy) {
 #pragma HLS inline
 #pragma HLS array_partition variable=nstubsall_ complete dim=1
 
@@ -290,7 +292,7 @@ inline MATCH read() {
 
    //Read stub memory and extract data fields
    ap_uint<10> stubadd=(iphiSave,zbin,istubtmp);
-   stubdata_ = stubmem[bx&1][stubadd];
+   stubdata_ = stubmem.read_mem(icopy, bx, stubadd);
    projfinephi__ = projfinephi_;
    projfinezadj_ = projfinezadj;
    isPSseed_ = isPSseed;
@@ -11,6 +11,10 @@
 #include "AllStubMemory.h"
 #include "FullMatchMemory.h"
 #include "MatchEngineUnit.h"
+#include "LUTRegistry.h"
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
 #include "hls_math.h"
 #include <iostream>
 #include <fstream>
@@ -147,6 +151,17 @@ namespace PR
 template<int L>
 void readTable(ap_uint<1> table[]){
 
+#ifdef LUT_RUNTIME
+  // Same tables as below
+  if (L==TF::L1 || L==TF::L3 || L==TF::L4) {
+    const int size = (L==TF::L4) ? 512 : 256;
+    static const ap_uint<1>* tmp = LUTRegistry::get<ap_uint<1> >(
+      std::string(L==TF::L3 ? "MP" : "ME") + "/tables/METable_L" + std::to_string(L+1) + ".tab", size);
+    for (int i=0;i<size;++i){
+      table[i]=tmp[i];
+    }
+  }
+#else
   if (L==TF::L1) {
     bool tmp[256]=
 #include "../emData/ME/tables/METable_L1.tab"
@@ -204,6 +219,7 @@ void readTable(ap_uint<1> table[]){
     }
   }
 */
+#endif // LUT_RUNTIME
 
 
 
@@ -231,6 +247,14 @@ ap_uint<width> iabs( ap_int<width> value )
 // Table for phi or z cuts
 template<bool phi, int L, int width, int depth>
 void readTable_Cuts(ap_uint<width> table[depth]){
+#ifdef LUT_RUNTIME
+  // Only the layers have tables, as below
+  if (L <= TF::L6) {
+    static const ap_uint<width>* tmp = LUTRegistry::get<ap_uint<width> >(
+      std::string(L == TF::L3 ? "MP/tables/MP_L" : "MC/tables/MC_L") + std::to_string(L+1) + "PHIC_" + (phi ? "phicut" : "zcut") + ".tab", depth);
+    for (int i = 0; i < depth; i++) table[i] = tmp[i];
+  }
+#else
   if (phi){ // phi cuts
     if (L==TF::L1){
       ap_uint<width> tmp[depth] =
@@ -302,6 +326,7 @@ void readTable_Cuts(ap_uint<width> table[depth]){
     }
  
   }
+#endif // LUT_RUNTIME
 
 } // end readTable_Cuts
 
@@ -495,32 +520,52 @@ void MatchCalculator(BXType bx,
   
 } //end MC
 
+//////////////////////////////
+// Lookup tables of a MatchProcessor, filled when the context is created. The
+// context is owned by the caller rather than kept in function statics, so that
+// several MatchProcessors (e.g. one per event or sector and thread) can run
+// concurrently in C simulation. It has one bend-rinv table per match engine
+// unit. The tables are only read, so the caller can build the context once and
+// share it; the caller also partitions them, see MatchProcessorTopL3.h.
+template<TF::layerDisk LAYER, unsigned int NMatchEngines = kNMatchEngines>
+struct MatchProcessorContext {
+  MatchProcessorContext() {
+  readtable: for(int iMEU = 0; iMEU < NMatchEngines; ++iMEU) {
+#pragma HLS unroll
+      readTable<LAYER>(table[iMEU]);
+    }
+    PR::zbinLUTinit(zbinLUT, PR::zbins_adjust_PSseed, PR::zbins_adjust_2Sseed);
+  }
+
+  //Table for bend-rinv consistency
+  ap_uint<1> table[NMatchEngines][(LAYER<TF::L4)?256:512]; //FIXME Need to figure out how to replace 256 with meaningful const.
+  //Range of z-bins of a projection
+  ap_uint<2*MEBinsBits> zbinLUT[128];
+};
+
 //////////////////////////////
 // MatchProcessor
 template<regionType PROJTYPE, regionType VMSMEType, regionType VMPTYPE, regionType ASTYPE, regionType APTYPE, regionType FMTYPE, unsigned int nINMEM, int maxFullMatchCopies,
-         TF::layerDisk LAYER=TF::L1, TF::layerDisk DISK=TF::D1, MC::imc PHISEC=MC::A>
+         TF::layerDisk LAYER=TF::L1, TF::layerDisk DISK=TF::D1, MC::imc PHISEC=MC::A, unsigned int NMatchEngines=kNMatchEngines>
 void MatchProcessor(BXType bx,
                       // because Vivado HLS cannot synthesize an array of
                       // pointers that point to stuff other than scalar or
                       // array of scalar ...
                       const TrackletProjectionMemory<PROJTYPE> projin[nINMEM],
-                      const VMStubMEMemoryCM<VMSMEType, 3, 3, kNMatchEngines>& instubdata,
+                      const VMStubMEMemoryCM<VMSMEType, 3, 3, NMatchEngines>& instubdata,
                       const AllStubMemory<ASTYPE>* allstub,
                       BXType& bx_o,
-                      FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies]
+                      FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies],
+                      const MatchProcessorContext<LAYER, NMatchEngines>& context
 ){
 #pragma HLS inline
+  static_assert(NMatchEngines >= 1 && NMatchEngines <= 8, "bestiMEU has 3 bits");
 
   
   using namespace PR;
 
-  //Initialize table for bend-rinv consistency
-  ap_uint<1> table[kNMatchEngines][(LAYER<TF::L4)?256:512]; //FIXME Need to figure out how to replace 256 with meaningful const.
-#pragma HLS ARRAY_PARTITION variable=table dim=0 complete
-  readtable: for(int iMEU = 0; iMEU < kNMatchEngines; ++iMEU) {
-#pragma HLS unroll
-    readTable<LAYER>(table[iMEU]); 
-  } 
+  //Table for bend-rinv consistency
+  const auto& table = context.table;
 
   // initialization:
   // check the number of entries in the input memories
@@ -569,7 +614,7 @@ void MatchProcessor(BXType bx,
 
   ProjectionRouterBufferArray<3,APTYPE> projbufferarray;
 
-  MatchEngineUnit<VMSMEType, BARREL, VMPTYPE, APTYPE> matchengine[kNMatchEngines];
+  MatchEngineUnit<VMSMEType, BARREL, VMPTYPE, APTYPE> matchengine[NMatchEngines];
 #pragma HLS ARRAY_PARTITION variable=matchengine complete dim=0
 #pragma HLS ARRAY_PARTITION variable=instubdata complete dim=1
 #pragma HLS ARRAY_PARTITION variable=numbersin complete dim=0
@@ -585,9 +630,7 @@ void MatchProcessor(BXType bx,
   bool validin = false; 
   bool validin_ = false; 
 
-  static ap_uint<2*MEBinsBits> zbinLUT[128];
-#pragma HLS ARRAY_PARTITION variable=zbinLUT complete dim=0
-  zbinLUTinit(zbinLUT, zbins_adjust_PSseed, zbins_adjust_2Sseed);
+  const auto& zbinLUT = context.zbinLUT;
 
   ap_uint<4> nvmstubs[8][8]; 
 #pragma HLS ARRAY_PARTITION variable=nvmstubs complete dim=0
@@ -598,6 +641,10 @@ void MatchProcessor(BXType bx,
      nvmstubs[izbin][3],nvmstubs[izbin][2],nvmstubs[izbin][1],nvmstubs[izbin][0]) = instubdata.getEntries8(bx, izbin);
   }
 
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("MatchProcessor::PROC_LOOP", kMaxProc-LoopItersCut);
+#endif
+
  PROC_LOOP: for (int istep = 0; istep < kMaxProc-LoopItersCut; ++istep) {
 #pragma HLS PIPELINE II=1 //rewind
 
@@ -611,15 +658,15 @@ void MatchProcessor(BXType bx,
       nallproj = 0;
     }
 
-    ap_uint<kNMatchEngines> idles;
-    ap_uint<kNMatchEngines> emptys;
-    typename ProjectionRouterBuffer<BARREL, ASTYPE>::TRKID trkids[kNMatchEngines];
+    ap_uint<NMatchEngines> idles;
+    ap_uint<NMatchEngines> emptys;
+    typename ProjectionRouterBuffer<BARREL, ASTYPE>::TRKID trkids[NMatchEngines];
 #pragma HLS ARRAY_PARTITION variable=trkids complete dim=0
 
 
     bool anyidle = false;
 
-  MEU_get_trkids: for(int iMEU = 0; iMEU < kNMatchEngines; ++iMEU) {
+  MEU_get_trkids: for(int iMEU = 0; iMEU < NMatchEngines; ++iMEU) {
 #pragma HLS unroll      
       matchengine[iMEU].set_empty();
       idles[iMEU] = matchengine[iMEU].idle();
@@ -629,11 +676,11 @@ void MatchProcessor(BXType bx,
     }
    
     
-    ap_uint<kNMatchEngines> smallest = ~emptys;
+    ap_uint<NMatchEngines> smallest = ~emptys;
 #pragma HLS ARRAY_PARTITION variable=trkids complete dim=0
-  MEU_smallest1: for(int iMEU1 = 0; iMEU1 < kNMatchEngines-1; ++iMEU1) {
+  MEU_smallest1: for(int iMEU1 = 0; iMEU1 < NMatchEngines-1; ++iMEU1) {
 #pragma HLS unroll
-  MEU_smallest2: for(int iMEU2 = iMEU1+1; iMEU2 < kNMatchEngines; ++iMEU2) {
+  MEU_smallest2: for(int iMEU2 = iMEU1+1; iMEU2 < NMatchEngines; ++iMEU2) {
 #pragma HLS unroll
 	smallest[iMEU1] = smallest[iMEU1] & (trkids[iMEU1]<trkids[iMEU2]);
         smallest[iMEU2] = smallest[iMEU2] & (trkids[iMEU2]<trkids[iMEU1]);
@@ -650,7 +697,7 @@ void MatchProcessor(BXType bx,
     }
     
     bool init = false;
-  MEU_LOOP: for(unsigned int iMEU = 0; iMEU < kNMatchEngines; ++iMEU) {
+  MEU_LOOP: for(unsigned int iMEU = 0; iMEU < NMatchEngines; ++iMEU) {
 #pragma HLS unroll
       auto &meu = matchengine[iMEU];
       
@@ -662,7 +709,7 @@ void MatchProcessor(BXType bx,
         meu.init(bx, tmpprojbuff, iphi, iMEU);
       }
 
-      else meu.step(instubdata.getMem(iMEU));
+      else meu.step(instubdata, iMEU);
 
       meu.processPipeLine(table[iMEU]);      
 
@@ -825,8 +872,25 @@ void MatchProcessor(BXType bx,
       validin = false;
     }// end if not near full
 
+#ifndef __SYNTHESIS__
+    // a projection was read or buffered, a match engine was busy or a match was calculated
+    loopStats.useful += (validin || validin_ || !idles.and_reduce() || hasMatch);
+    loopStats.stalled += (projBuffNearFull && mem_hasdata != 0);
+#endif
+
   } //end loop
 
+#ifndef __SYNTHESIS__
+  // Projections not read from the input memories, and those left in the projection buffer
+  for (int i = 0; i < nINMEM; i++) {
+    if (mem_hasdata[i]) loopStats.leftover += numbersin[i];
+  }
+  if (mem_hasdata != 0) loopStats.leftover -= mem_read_addr;
+  const ap_uint<kNBitsBuffer> nbuffered = projbufferarray.getWritePtr() - projbufferarray.getReadPtr();
+  loopStats.leftover += nbuffered;
+  loopStats.record();
+#endif
+
 
 } // end MatchProcessor()
 
@@ -2,7 +2,7 @@
 
 void MatchProcessorTopL3(BXType bx,
                          const TrackletProjectionMemory<BARRELPS> projin[maxTrackletProjections],
-                         const VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEngines>& instubdata,
+                         const VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEnginesL3>& instubdata,
                          const AllStubMemory<BARRELPS>* allstub,
                          BXType& bx_o,
                          FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies]) {
@@ -23,16 +23,7 @@ void MatchProcessorTopL3(BXType bx,
  #pragma HLS resource variable=fullmatch[6].get_mem() latency=2
  #pragma HLS resource variable=fullmatch[7].get_mem() latency=2
 
- const auto LAYER  = TF::L3;
- const auto DISK   = TF::D1;
-  const auto PHISEC = MC::C;
- MatchProcessor<BARRELPS, BARRELPS, BARREL, BARRELPS, BARRELPS, BARREL, maxTrackletProjections, maxFullMatchCopies, LAYER, DISK, PHISEC>
-                     (bx,
-                      projin,
-                      instubdata,
-                      allstub,
-                      bx_o,
-                      fullmatch);
+ MatchProcessorL3<kNMatchEnginesL3>(bx, projin, instubdata, allstub, bx_o, fullmatch);
 
 }
 
@@ -6,9 +6,45 @@
 constexpr int maxTrackletProjections(10);
 constexpr int maxFullMatchCopies(8);
 
+// Number of match engine units of the L3 MatchProcessor, i.e. of copies of its
+// VMStubME memory
+constexpr unsigned int kNMatchEnginesL3 = kNMatchEngines;
+
+// L3PHIC MatchProcessor with NMatchEngines match engine units. The top
+// function has kNMatchEnginesL3 of them; the C simulation can try others.
+template<unsigned int NMatchEngines>
+void MatchProcessorL3(BXType bx,
+                      const TrackletProjectionMemory<BARRELPS> projin[maxTrackletProjections],
+                      const VMStubMEMemoryCM<BARRELPS, 3, 3, NMatchEngines>& instubdata,
+                      const AllStubMemory<BARRELPS>* allstub,
+                      BXType& bx_o,
+                      FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies]) {
+#pragma HLS inline
+  const auto LAYER  = TF::L3;
+  const auto DISK   = TF::D1;
+  const auto PHISEC = MC::C;
+  // The C simulation builds the LUTs once, the first time it gets here.
+  // Synthesis fills them in place as before, which folds them to constants.
+#ifdef __SYNTHESIS__
+  const MatchProcessorContext<LAYER, NMatchEngines> context;
+#else
+  static const MatchProcessorContext<LAYER, NMatchEngines> context;
+#endif
+#pragma HLS ARRAY_PARTITION variable=context.table dim=0 complete
+#pragma HLS ARRAY_PARTITION variable=context.zbinLUT complete dim=0
+  MatchProcessor<BARRELPS, BARRELPS, BARREL, BARRELPS, BARRELPS, BARREL, maxTrackletProjections, maxFullMatchCopies, LAYER, DISK, PHISEC, NMatchEngines>
+                     (bx,
+                      projin,
+                      instubdata,
+                      allstub,
+                      bx_o,
+                      fullmatch,
+                      context);
+}
+
 void MatchProcessorTopL3(BXType bx,
                          const TrackletProjectionMemory<BARRELPS> projin[maxTrackletProjections],
-                         const VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEngines>& instubdata,
+                         const VMStubMEMemoryCM<BARRELPS, 3, 3, kNMatchEnginesL3>& instubdata,
                          const AllStubMemory<BARRELPS>* allstub,
                          BXType& bx_o,
                          FullMatchMemory<BARREL> fullmatch[maxFullMatchCopies]);
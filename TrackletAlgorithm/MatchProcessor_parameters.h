@@ -1,8 +1,36 @@
 #ifndef TrackletAlgorithm_MatchProcessor_parameters_h
 #define TrackletAlgorithm_MatchProcessor_parameters_h
 
+// The LUTs of the FIFO pointers and of the phi and z comparisons are built by
+// the make_ functions, with loops over their addresses. Only the C simulation
+// caches them: there CachedLUT<T, Make>::get() builds each of them once, the
+// first time it is used, and keeps it in a static object shared by all the
+// callers with the same template parameters, instead of rebuilding it in every
+// iteration of the processing loops. Synthesis still calls the make_
+// functions, whose unrolled loops it folds into constants (ap_uint is not a
+// literal type, so the LUTs cannot be constexpr). A C simulation compiled with
+// -DCSIM_UNCACHED_LUTS calls them too, which the MP_L3PHIC_uncached_bench
+// benchmark compares with MP_L3PHIC_bench.
+#if defined(__SYNTHESIS__) || defined(CSIM_UNCACHED_LUTS)
+template<class T> using LUTRef = const T;
+#else
+template<class T> using LUTRef = const T&;
+#endif
+
+template<class T, T (*Make)()>
+struct CachedLUT {
+  static LUTRef<T> get() {
+#if defined(__SYNTHESIS__) || defined(CSIM_UNCACHED_LUTS)
+    return Make();
+#else
+    static const T lut = Make();
+    return lut;
+#endif
+  }
+};
+
 template<int kNBitsBuffer>
-static const ap_uint<(1 << (2 * kNBitsBuffer))> nearFullUnit() {
+static ap_uint<(1 << (2 * kNBitsBuffer))> make_nearFullUnit() {
   ap_uint<(1 << (2 * kNBitsBuffer))> lut;
   for(int i = 0; i < (1 << (2 * kNBitsBuffer)); ++i) {
 #pragma HLS unroll
@@ -18,7 +46,7 @@ static const ap_uint<(1 << (2 * kNBitsBuffer))> nearFullUnit() {
 }
 
 template<int kNBitsBuffer>
-static const ap_uint<(1 << (2 * kNBitsBuffer))> nearFull3Unit() {
+static ap_uint<(1 << (2 * kNBitsBuffer))> make_nearFull3Unit() {
   ap_uint<(1 << (2 * kNBitsBuffer))> lut;
   for(int i = 0; i < (1 << (2 * kNBitsBuffer)); ++i) {
 #pragma HLS unroll
@@ -35,7 +63,7 @@ static const ap_uint<(1 << (2 * kNBitsBuffer))> nearFull3Unit() {
 }
 
 template<int kNBitsBuffer>
-static const ap_uint<(1 << (2 * kNBitsBuffer))> emptyUnit() {
+static ap_uint<(1 << (2 * kNBitsBuffer))> make_emptyUnit() {
   ap_uint<(1 << (2 * kNBitsBuffer))> lut;
   for(int i = 0; i < (1 << (2 * kNBitsBuffer)); ++i) {
 #pragma HLS unroll
@@ -49,7 +77,7 @@ static const ap_uint<(1 << (2 * kNBitsBuffer))> emptyUnit() {
 }
 
 template<int kNBitsBuffer>
-static const ap_uint<(1 << (2 * kNBitsBuffer))> geq() {
+static ap_uint<(1 << (2 * kNBitsBuffer))> make_geq() {
   ap_uint<(1 << (2 * kNBitsBuffer))> lut;
   for(int i = 0; i < (1 << (2 * kNBitsBuffer)); ++i) {
 #pragma HLS unroll
@@ -63,7 +91,7 @@ static const ap_uint<(1 << (2 * kNBitsBuffer))> geq() {
 }
 
 template<int kNBitsBuffer>
-static const ap_uint<(1 << kNBitsBuffer)> nextUnit() {
+static ap_uint<(1 << kNBitsBuffer)> make_nextUnit() {
   ap_uint<(1 << kNBitsBuffer)> lut;
   for(int i = 0; i < (1 << kNBitsBuffer); ++i) {
 #pragma HLS unroll
@@ -74,7 +102,7 @@ static const ap_uint<(1 << kNBitsBuffer)> nextUnit() {
 }
 
 template<int nbits, int max, bool lessThan>
-static const ap_uint<1 << nbits> isLessThanSize() {
+static ap_uint<1 << nbits> make_isLessThanSize() {
   ap_uint<1 << nbits> tab(0);
   ap_uint<nbits> Max(max);
   ap_uint<nbits> Min(-max);
@@ -91,7 +119,7 @@ static const ap_uint<1 << nbits> isLessThanSize() {
 }
 
 template<int nbits, int max, bool lessThan, int proj, int stub>
-static const ap_uint<1 << 2*nbits> isLessThanSize() {
+static ap_uint<1 << 2*nbits> make_isLessThanSize() {
   ap_uint<1 << 2*nbits> tab(0);
   ap_uint<nbits> Max(max);
   ap_uint<nbits> Min(-max);
@@ -112,4 +140,39 @@ static const ap_uint<1 << 2*nbits> isLessThanSize() {
   return tab;
 }
 
+template<int kNBitsBuffer>
+static LUTRef<ap_uint<(1 << (2 * kNBitsBuffer))> > nearFullUnit() {
+  return CachedLUT<ap_uint<(1 << (2 * kNBitsBuffer))>, make_nearFullUnit<kNBitsBuffer> >::get();
+}
+
+template<int kNBitsBuffer>
+static LUTRef<ap_uint<(1 << (2 * kNBitsBuffer))> > nearFull3Unit() {
+  return CachedLUT<ap_uint<(1 << (2 * kNBitsBuffer))>, make_nearFull3Unit<kNBitsBuffer> >::get();
+}
+
+template<int kNBitsBuffer>
+static LUTRef<ap_uint<(1 << (2 * kNBitsBuffer))> > emptyUnit() {
+  return CachedLUT<ap_uint<(1 << (2 * kNBitsBuffer))>, make_emptyUnit<kNBitsBuffer> >::get();
+}
+
+template<int kNBitsBuffer>
+static LUTRef<ap_uint<(1 << (2 * kNBitsBuffer))> > geq() {
+  return CachedLUT<ap_uint<(1 << (2 * kNBitsBuffer))>, make_geq<kNBitsBuffer> >::get();
+}
+
+template<int kNBitsBuffer>
+static LUTRef<ap_uint<(1 << kNBitsBuffer)> > nextUnit() {
+  return CachedLUT<ap_uint<(1 << kNBitsBuffer)>, make_nextUnit<kNBitsBuffer> >::get();
+}
+
+template<int nbits, int max, bool lessThan>
+static LUTRef<ap_uint<1 << nbits> > isLessThanSize() {
+  return CachedLUT<ap_uint<1 << nbits>, make_isLessThanSize<nbits, max, lessThan> >::get();
+}
+
+template<int nbits, int max, bool lessThan, int proj, int stub>
+static LUTRef<ap_uint<1 << 2*nbits> > isLessThanSize() {
+  return CachedLUT<ap_uint<1 << 2*nbits>, make_isLessThanSize<nbits, max, lessThan, proj, stub> >::get();
+}
+
 #endif
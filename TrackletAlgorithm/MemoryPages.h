@@ -0,0 +1,23 @@
+// Number of BX pages kept by the memories.
+//
+// The memories keep the entries of (1<<NBIT_BX) BXs, but the test benches only
+// use the BX of the current event. Compiled with -DCSIM_MEMORY_BX_PAGES=<n>,
+// the C simulation keeps only n pages per memory: page bx%n holds the last BX
+// written to it. Writing to a BX whose page holds another BX first empties the
+// page, and a BX without a page has no entries. With n=1 the memories are 8
+// times smaller, so that the memories of a whole chain fit in the caches.
+// Synthesis always keeps all the BXs.
+#ifndef TrackletAlgorithm_MemoryPages_h
+#define TrackletAlgorithm_MemoryPages_h
+
+template<unsigned int NBIT_BX>
+constexpr unsigned int nMemoryPages()
+{
+#if defined(CSIM_MEMORY_BX_PAGES) && !defined(__SYNTHESIS__)
+  return (CSIM_MEMORY_BX_PAGES > 0 && CSIM_MEMORY_BX_PAGES < (1u<<NBIT_BX)) ? CSIM_MEMORY_BX_PAGES : (1u<<NBIT_BX);
+#else
+  return 1u<<NBIT_BX;
+#endif
+}
+
+#endif
@@ -0,0 +1,275 @@
+// Occupancy statistics of the memories, for the C simulation only.
+//
+// The memories hold a fixed number of entries per BX (and per bin), and the
+// entries beyond that are dropped by write_mem. To size the memories and the
+// processing budgets, a memory can record for every event how many entries
+// were written to each bin and how many were dropped:
+//   memory.collectStatistics("VMSME_L3PHIC17n1");
+// An event ends when the memory is cleared, as the test benches do before each
+// event. Memories with the same name, e.g. the copies used by several threads,
+// are combined. The statistics of all memories are written by
+// MemoryStatistics::writeCSV() and writeJSON(), or at the end of the program
+// to the file given by the environment variable MEMORY_STATISTICS (.csv or
+// .json).
+#ifndef TrackletAlgorithm_MemoryStatistics_h
+#define TrackletAlgorithm_MemoryStatistics_h
+
+#ifndef __SYNTHESIS__
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class MemoryStatistics
+{
+public:
+
+  // Histogram of the number of entries per event
+  typedef std::map<unsigned int, unsigned long> Histogram;
+
+  struct BinStatistics {
+    unsigned int peak = 0;           // highest number of entries stored in an event
+    unsigned int peakDemand = 0;     // highest number of entries written, including the dropped ones
+    unsigned long overflows = 0;     // entries dropped
+    unsigned long overflowEvents = 0;
+    Histogram demand;                // entries written per event, including the dropped ones
+
+    void fill(unsigned int nstored, unsigned int ndropped) {
+      peak = std::max(peak, nstored);
+      peakDemand = std::max(peakDemand, nstored + ndropped);
+      overflows += ndropped;
+      if (ndropped) ++overflowEvents;
+      ++demand[nstored + ndropped];
+    }
+
+    void add(const BinStatistics& other) {
+      peak = std::max(peak, other.peak);
+      peakDemand = std::max(peakDemand, other.peakDemand);
+      overflows += other.overflows;
+      overflowEvents += other.overflowEvents;
+      for (const auto& h : other.demand) demand[h.first] += h.second;
+    }
+  };
+
+  // Registers the statistics of a memory with nbx BXs of nbins bins, each
+  // holding binDepth entries
+  static std::shared_ptr<MemoryStatistics> create(const std::string& name, unsigned int nbx,
+                                                  unsigned int nbins, unsigned int binDepth) {
+    std::shared_ptr<MemoryStatistics> stats(new MemoryStatistics(name, nbx, nbins, binDepth));
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.memories.push_back(stats);
+    return stats;
+  }
+
+  // Called by write_mem for every entry written, whether stored or dropped
+  void write(unsigned int bx, unsigned int bin, unsigned int nentry, bool stored) {
+    const unsigned int i = bx * nbins_ + bin;
+    if (stored) stored_[i] = std::max(stored_[i], nentry + 1);
+    else ++dropped_[i];
+    written_[bx] = true;
+    started_ = true;
+  }
+
+  // Adds the entries written since the last call as one event per BX written.
+  // If nothing was written, an empty event is added, except for the first
+  // call, which only marks the start of the first event.
+  void endEvent() {
+    if (not started_) {
+      started_ = true;
+      return;
+    }
+
+    bool empty = true;
+    for (unsigned int bx = 0; bx < nbx_; ++bx) {
+      if (not written_[bx]) continue;
+      fill(&stored_[bx * nbins_], &dropped_[bx * nbins_]);
+      written_[bx] = false;
+      empty = false;
+    }
+    if (empty) fill(nullptr, nullptr);
+
+    std::fill(stored_.begin(), stored_.end(), 0);
+    std::fill(dropped_.begin(), dropped_.end(), 0);
+  }
+
+  const std::string& name() const { return name_; }
+  unsigned int nbins() const { return nbins_; }
+  unsigned int binDepth() const { return binDepth_; }
+  unsigned long nevents() const { return nevents_; }
+  const BinStatistics& total() const { return total_; }
+  const BinStatistics& bin(unsigned int ibin) const { return bins_[ibin]; }
+
+  // Writes one line per memory ("all" bins) and per bin. The histogram column
+  // lists "entries:events" pairs.
+  static bool writeCSV(const std::string& fileName) {
+    return writeCSV(fileName, combined(registry()));
+  }
+
+  static bool writeJSON(const std::string& fileName) {
+    return writeJSON(fileName, combined(registry()));
+  }
+
+  // Writes CSV or JSON, depending on the file extension
+  static bool write(const std::string& fileName) {
+    return write(fileName, combined(registry()));
+  }
+
+private:
+
+  struct Registry;
+
+  MemoryStatistics(const std::string& name, unsigned int nbx, unsigned int nbins, unsigned int binDepth):
+    name_(name), nbx_(nbx), nbins_(nbins), binDepth_(binDepth),
+    stored_(nbx * nbins, 0), dropped_(nbx * nbins, 0), written_(nbx, false),
+    bins_(nbins)
+  {}
+
+  static bool write(const std::string& fileName, const std::vector<MemoryStatistics>& memories) {
+    const bool json = fileName.size() >= 5 && fileName.compare(fileName.size() - 5, 5, ".json") == 0;
+    return json ? writeJSON(fileName, memories) : writeCSV(fileName, memories);
+  }
+
+  static bool writeCSV(const std::string& fileName, const std::vector<MemoryStatistics>& memories) {
+    std::ofstream out(fileName);
+    out << "memory,bin,depth,events,peak,peak_demand,overflows,overflow_events,demand_histogram\n";
+    for (const auto& stats : memories) {
+      writeCSVLine(out, stats, "all", stats.nbins_ * stats.binDepth_, stats.total_);
+      if (stats.nbins_ > 1) {
+        for (unsigned int ibin = 0; ibin < stats.nbins_; ++ibin)
+          writeCSVLine(out, stats, std::to_string(ibin), stats.binDepth_, stats.bins_[ibin]);
+      }
+    }
+    return out.good();
+  }
+
+  static bool writeJSON(const std::string& fileName, const std::vector<MemoryStatistics>& memories) {
+    std::ofstream out(fileName);
+    out << "{\n  \"memories\": [";
+    bool first = true;
+    for (const auto& stats : memories) {
+      out << (first ? "\n" : ",\n") << "    {\n"
+          << "      \"name\": \"" << stats.name_ << "\",\n"
+          << "      \"nbins\": " << stats.nbins_ << ",\n"
+          << "      \"bin_depth\": " << stats.binDepth_ << ",\n"
+          << "      \"events\": " << stats.nevents_ << ",\n";
+      writeJSONStatistics(out, stats.total_, "      ");
+      out << ",\n      \"bins\": [";
+      for (unsigned int ibin = 0; ibin < stats.nbins_; ++ibin) {
+        out << (ibin ? ",\n" : "\n") << "        {\n"
+            << "          \"bin\": " << ibin << ",\n";
+        writeJSONStatistics(out, stats.bins_[ibin], "          ");
+        out << "\n        }";
+      }
+      out << "\n      ]\n    }";
+      first = false;
+    }
+    out << "\n  ]\n}\n";
+    return out.good();
+  }
+
+  void fill(const unsigned int* stored, const unsigned int* dropped) {
+    unsigned int nstored = 0, ndropped = 0;
+    for (unsigned int ibin = 0; ibin < nbins_; ++ibin) {
+      const unsigned int s = stored ? stored[ibin] : 0;
+      const unsigned int d = dropped ? dropped[ibin] : 0;
+      bins_[ibin].fill(s, d);
+      nstored += s;
+      ndropped += d;
+    }
+    total_.fill(nstored, ndropped);
+    ++nevents_;
+  }
+
+  void add(const MemoryStatistics& other) {
+    nevents_ += other.nevents_;
+    total_.add(other.total_);
+    for (unsigned int ibin = 0; ibin < nbins_; ++ibin) bins_[ibin].add(other.bins_[ibin]);
+  }
+
+  // The statistics of all memories, with the memories of the same name and
+  // layout combined, including the events in progress.
+  static std::vector<MemoryStatistics> combined(Registry& r) {
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    std::vector<MemoryStatistics> result;
+    std::map<std::string, unsigned int> index;
+    for (const auto& memory : r.memories) {
+      MemoryStatistics stats(*memory);
+      stats.endEvent();
+      const std::string key = stats.name_ + '/' + std::to_string(stats.nbins_) + '/' + std::to_string(stats.binDepth_);
+      auto it = index.find(key);
+      if (it == index.end()) {
+        index[key] = result.size();
+        result.push_back(stats);
+      }
+      else {
+        result[it->second].add(stats);
+      }
+    }
+    return result;
+  }
+
+  static void writeCSVLine(std::ostream& out, const MemoryStatistics& stats, const std::string& bin,
+                           unsigned int depth, const BinStatistics& s) {
+    out << stats.name_ << ',' << bin << ',' << depth << ',' << stats.nevents_ << ','
+        << s.peak << ',' << s.peakDemand << ',' << s.overflows << ',' << s.overflowEvents << ',';
+    for (auto h = s.demand.begin(); h != s.demand.end(); ++h)
+      out << (h == s.demand.begin() ? "" : " ") << h->first << ':' << h->second;
+    out << '\n';
+  }
+
+  static void writeJSONStatistics(std::ostream& out, const BinStatistics& s, const std::string& indent) {
+    out << indent << "\"peak\": " << s.peak << ",\n"
+        << indent << "\"peak_demand\": " << s.peakDemand << ",\n"
+        << indent << "\"overflows\": " << s.overflows << ",\n"
+        << indent << "\"overflow_events\": " << s.overflowEvents << ",\n"
+        << indent << "\"demand_histogram\": {";
+    for (auto h = s.demand.begin(); h != s.demand.end(); ++h)
+      out << (h == s.demand.begin() ? "" : ", ") << '"' << h->first << "\": " << h->second;
+    out << '}';
+  }
+
+  // All memories collecting statistics. The statistics are written to
+  // $MEMORY_STATISTICS when the program ends.
+  struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<MemoryStatistics> > memories;
+
+    ~Registry() {
+      const char* fileName = std::getenv("MEMORY_STATISTICS");
+      if (not fileName || memories.empty()) return;
+      if (not write(fileName, combined(*this)))
+        std::cerr << "Could not write the memory statistics to " << fileName << std::endl;
+    }
+  };
+
+  static Registry& registry() {
+    static Registry r;
+    return r;
+  }
+
+  std::string name_;
+  unsigned int nbx_, nbins_, binDepth_;
+
+  // Current event
+  std::vector<unsigned int> stored_;   // [bx][bin] highest entry stored + 1
+  std::vector<unsigned int> dropped_;  // [bx][bin] entries dropped
+  std::vector<bool> written_;          // [bx]
+  bool started_ = false;
+
+  // Events ended
+  unsigned long nevents_ = 0;
+  BinStatistics total_;
+  std::vector<BinStatistics> bins_;
+};
+
+#endif // __SYNTHESIS__
+
+#endif
@@ -3,6 +3,11 @@
 #define TrackletAlgorithm_MemoryTemplate_h
 
 #include <iostream>
+#include "MemoryPages.h"
+
+#ifndef __SYNTHESIS__
+#include "MemoryStatistics.h"
+#endif
 
 template<int> class AllStub;
 
@@ -21,8 +26,56 @@ public:
   
 protected:
 
-  DataType dataarray_[1<<NBIT_BX][1<<NBIT_ADDR];  // data array
-  NEntryT nentries_[1<<NBIT_BX];                  // number of entries
+  static constexpr unsigned int kNPages = nMemoryPages<NBIT_BX>(); // BXs kept, see MemoryPages.h
+
+  DataType dataarray_[kNPages][1<<NBIT_ADDR];  // data array
+  NEntryT nentries_[kNPages];                  // number of entries
+#ifndef __SYNTHESIS__
+  int pagebx_[kNPages];                        // BX held by each page
+  int nwritten_[kNPages];                      // highest address written since the last clear() + 1
+  std::shared_ptr<MemoryStatistics> stats_;    // occupancy statistics, if collected
+#endif
+
+  // Page holding a BX
+  static unsigned int page(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    return (unsigned int)bx % kNPages;
+#endif
+  }
+
+  // Page a BX is written to. In C simulation, a page still holding another BX
+  // is emptied first.
+  unsigned int writePage(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    const unsigned int ipage = page(bx);
+    if (pagebx_[ipage] != bx) {
+      resetPage(ipage);
+      pagebx_[ipage] = bx;
+    }
+    return ipage;
+#endif
+  }
+
+#ifndef __SYNTHESIS__
+  bool hasPage(BunchXingT bx) const { return pagebx_[page(bx)] == bx; }
+
+  // Only the addresses written since the last reset are reset
+  void resetPage(unsigned int ipage)
+  {
+    static const DataType data("0",16);
+    nentries_[ipage] = 0;
+    for (int addr=0; addr<nwritten_[ipage]; ++addr) {
+      dataarray_[ipage][addr] = data;
+    }
+    nwritten_[ipage] = 0;
+  }
+#endif
   
 public:
 
@@ -31,15 +84,29 @@ public:
 
   NEntryT getEntries(BunchXingT bx) const {
 #pragma HLS ARRAY_PARTITION variable=nentries_ complete dim=0
-	return nentries_[bx];
+#ifndef __SYNTHESIS__
+	if (not hasPage(bx)) return 0;
+#endif
+	return nentries_[page(bx)];
+  }
+
+  // Sets the number of entries of a BX, for the modules that write their
+  // entries by address
+  void setEntries(BunchXingT bx, NEntryT nentries) {
+#pragma HLS inline
+    nentries_[writePage(bx)] = nentries;
   }
 
-  const DataType (&get_mem() const)[1<<NBIT_BX][1<<NBIT_ADDR] {return dataarray_;}
+  const DataType (&get_mem() const)[kNPages][1<<NBIT_ADDR] {return dataarray_;}
 
   DataType read_mem(BunchXingT ibx, ap_uint<NBIT_ADDR> index) const
   {
 	// TODO: check if valid
-	return dataarray_[ibx][index];
+#ifndef __SYNTHESIS__
+	static const DataType empty("0",16);
+	if (not hasPage(ibx)) return empty;
+#endif
+	return dataarray_[page(ibx)][index];
   }
 
   template<class SpecType>
@@ -58,11 +125,21 @@ public:
   bool write_mem(BunchXingT ibx, DataType data, int addr_index)
   {
 #pragma HLS inline
+#ifndef __SYNTHESIS__
+    if (stats_) stats_->write(ibx, 0, addr_index, addr_index < (1<<NBIT_ADDR));
+#endif
     if (addr_index < (1<<NBIT_ADDR)) {
-      dataarray_[ibx][addr_index] = data;
+      const unsigned int ipage = writePage(ibx);
+      dataarray_[ipage][addr_index] = data;
+#ifndef __SYNTHESIS__
+      if (addr_index >= nwritten_[ipage]) nwritten_[ipage] = addr_index + 1;
+#endif
       
-      #ifdef CMSSW_GIT_HASH
-      nentries_[ibx] = addr_index + 1;
+      // The firmware memories count their entries. The C simulation counts
+      // them too with CSIM_MEMORY_ENTRY_COUNT, so that the next module of a
+      // chain reads them.
+      #if defined(CMSSW_GIT_HASH) || defined(CSIM_MEMORY_ENTRY_COUNT)
+      nentries_[ipage] = addr_index + 1;
       #endif
       
       return true;
@@ -75,31 +152,37 @@ public:
 #ifndef __SYNTHESIS__
   MemoryTemplate()
   {
+       for (unsigned int ipage=0; ipage<kNPages; ++ipage) pagebx_[ipage] = ipage;
+       for (auto& n : nwritten_) n = (1<<NBIT_ADDR);
        clear();
   }
 
   ~MemoryTemplate(){}
 
+  // Only the addresses written since the last clear() are reset
   void clear()
   {
-    DataType data("0",16);
-    MEM_RST: for (size_t ibx=0; ibx<(1<<NBIT_BX); ++ibx) {
-      nentries_[ibx] = 0;
-      for (size_t addr=0; addr<(1<<NBIT_ADDR); ++addr) {
-        write_mem(ibx,data,addr);
-      }
+    if (stats_) stats_->endEvent();
+    MEM_RST: for (unsigned int ipage=0; ipage<kNPages; ++ipage) {
+      resetPage(ipage);
     }
   }
 
+  // Records the occupancy of the memory in each event, see MemoryStatistics.h
+  void collectStatistics(const std::string& name)
+  {
+    stats_ = MemoryStatistics::create(name, 1<<NBIT_BX, 1, 1<<NBIT_ADDR);
+  }
+
   // write memory from text file
   bool write_mem(BunchXingT ibx, const char* datastr, int base=16)
   {
 	DataType data(datastr, base);
-	int nent = nentries_[ibx]; 
+	int nent = getEntries(ibx); 
 	bool success = write_mem(ibx, data, nent);
 
-	#ifndef CMSSW_GIT_HASH
-	if (success) nentries_[ibx] ++;
+	#if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+	if (success) nentries_[page(ibx)] ++;
 	#endif
 	return success;
   }
@@ -107,11 +190,23 @@ public:
   bool write_mem(BunchXingT ibx, const std::string datastr, int base=16)
   {
 	DataType data(datastr.c_str(), base);
-	int nent = nentries_[ibx];
+	int nent = getEntries(ibx);
+	bool success = write_mem(ibx, data, nent);
+
+	#if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+	if (success) nentries_[page(ibx)] ++;
+	#endif
+	return success;
+  }
+
+  // write memory from binary memory print
+  bool write_mem(BunchXingT ibx, const DataType& data)
+  {
+	int nent = getEntries(ibx);
 	bool success = write_mem(ibx, data, nent);
 
-	#ifndef CMSSW_GIT_HASH
-	if (success) nentries_[ibx] ++;
+	#if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+	if (success) nentries_[page(ibx)] ++;
 	#endif
 	return success;
   }
@@ -125,12 +220,12 @@ public:
 
   void print_entry(BunchXingT bx, ap_uint<NBIT_ADDR> index) const
   {
-	print_data(dataarray_[bx][index]);
+	print_data(read_mem(bx,index));
   }
 
   void print_mem(BunchXingT bx) const
   {
-	for (int i = 0; i <  nentries_[bx]; ++i) {
+	for (int i = 0; i < getEntries(bx); ++i) {
 	  std::cout << bx << " " << i << " ";
 	  print_entry(bx,i);
 	}
@@ -139,7 +234,7 @@ public:
   void print_mem() const
   {
 	for (int ibx = 0; ibx < (1<<NBIT_BX); ++ibx) {
-	  for (int i = 0; i < nentries_[ibx]; ++i) {
+	  for (int i = 0; i < getEntries(ibx); ++i) {
 		std::cout << ibx << " " << i << " ";
 		print_entry(ibx,i);
 	  }
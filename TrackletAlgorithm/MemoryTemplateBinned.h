@@ -2,10 +2,13 @@
 #ifndef TrackletAlgorithm_MemoryTemplateBinned_h
 #define TrackletAlgorithm_MemoryTemplateBinned_h
 
+#include "MemoryPages.h"
+
 #ifndef __SYNTHESIS__
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include "MemoryStatistics.h"
 #endif
 
 
@@ -26,12 +29,61 @@ public:
 protected:
   enum BitWidths {
     kNBxBins = 1<<NBIT_BX,
+    kNPages = nMemoryPages<NBIT_BX>(), // BXs kept, see MemoryPages.h
     kNSlots = 1<<NBIT_BIN,
     kNMemDepth = 1<<NBIT_ADDR
   };
 
-  DataType dataarray_[kNBxBins][kNMemDepth];  // data array
-  NEntryT nentries_[kNBxBins][kNSlots];     // number of entries
+  DataType dataarray_[kNPages][kNMemDepth];  // data array
+  NEntryT nentries_[kNPages][kNSlots];     // number of entries
+#ifndef __SYNTHESIS__
+  int pagebx_[kNPages];                     // BX held by each page
+  int nwritten_[kNPages][kNSlots];          // highest entry written in each bin since the last clear() + 1
+  std::shared_ptr<MemoryStatistics> stats_; // occupancy statistics, if collected
+#endif
+
+  // Page holding a BX
+  static unsigned int page(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    return (unsigned int)bx % kNPages;
+#endif
+  }
+
+  // Page a BX is written to. In C simulation, a page still holding another BX
+  // is emptied first.
+  unsigned int writePage(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    const unsigned int ipage = page(bx);
+    if (pagebx_[ipage] != bx) {
+      resetPage(ipage);
+      pagebx_[ipage] = bx;
+    }
+    return ipage;
+#endif
+  }
+
+#ifndef __SYNTHESIS__
+  bool hasPage(BunchXingT bx) const { return pagebx_[page(bx)] == bx; }
+
+  // Only the entries written since the last reset are reset
+  void resetPage(unsigned int ipage)
+  {
+    static const DataType data("0",16);
+    for (unsigned int ibin=0; ibin<kNSlots; ++ibin) {
+      nentries_[ipage][ibin] = 0;
+      for (int addr=0; addr<nwritten_[ipage][ibin]; ++addr) {
+        dataarray_[ipage][(1<<(kNBitDataAddr))*ibin+addr] = data;
+      }
+      nwritten_[ipage][ibin] = 0;
+    }
+  }
+#endif
   
 public:
 
@@ -42,32 +94,51 @@ public:
 
   NEntryT getEntries(BunchXingT bx, ap_uint<NBIT_BIN> ibin) const {
 #pragma HLS ARRAY_PARTITION variable=nentries_ complete dim=0
-	return nentries_[bx][ibin];
+#ifndef __SYNTHESIS__
+	if (not hasPage(bx)) return 0;
+#endif
+	return nentries_[page(bx)][ibin];
   }
 
-  const DataType (&get_mem() const)[1<<NBIT_BX][1<<NBIT_ADDR] {return dataarray_;}
+  const DataType (&get_mem() const)[kNPages][1<<NBIT_ADDR] {return dataarray_;}
 
   DataType read_mem(BunchXingT ibx, ap_uint<NBIT_ADDR> index) const
   {
     // TODO: check if valid
-    return dataarray_[ibx][index];
+#ifndef __SYNTHESIS__
+    static const DataType empty("0",16);
+    if (not hasPage(ibx)) return empty;
+#endif
+    return dataarray_[page(ibx)][index];
   }
   
   DataType read_mem(BunchXingT ibx, ap_uint<NBIT_BIN> slot,
 		    ap_uint<NBIT_ADDR> index) const
   {
     // TODO: check if valid
-    return dataarray_[ibx][(1<<(kNBitDataAddr))*slot+index];
+    return read_mem(ibx, (1<<(kNBitDataAddr))*slot+index);
   }
 
   bool write_mem(BunchXingT ibx, ap_uint<NBIT_BIN> slot, DataType data, int nentry_ibx)
   {
 #pragma HLS inline
+#ifndef __SYNTHESIS__
+	if (stats_) stats_->write(ibx, slot, nentry_ibx, nentry_ibx < ((1<<kNBitDataAddr)-1));
+#endif
 	if (nentry_ibx < ((1<<kNBitDataAddr)-1)) { // Temporary "-1" to only allow 15 (7 for VMSME DISK) stubs per bin instead of 16 (8) to match emulation
 	  // write address for slot: 1<<(kNBitDataAddr) * slot + nentry_ibx
-	  dataarray_[ibx][(1<<(kNBitDataAddr))*slot+nentry_ibx] = data;
+	  const unsigned int ipage = writePage(ibx);
+	  dataarray_[ipage][(1<<(kNBitDataAddr))*slot+nentry_ibx] = data;
+#ifndef __SYNTHESIS__
+	  if (nentry_ibx >= nwritten_[ipage][slot]) nwritten_[ipage][slot] = nentry_ibx + 1;
+#endif
+	  // The firmware memories count their entries. The C simulation counts
+	  // them too with CSIM_MEMORY_ENTRY_COUNT, so that the next module of a
+	  // chain reads them.
 	  #ifdef CMSSW_GIT_HASH
-	  nentries_[ibx][slot]++;
+	  nentries_[ipage][slot]++;
+	  #elif defined(CSIM_MEMORY_ENTRY_COUNT)
+	  if (nentry_ibx >= nentries_[ipage][slot]) nentries_[ipage][slot] = nentry_ibx + 1;
 	  #endif
 	  return true;
 	}
@@ -85,24 +156,29 @@ public:
   
   MemoryTemplateBinned()
   {
+        for (unsigned int ipage=0; ipage<kNPages; ++ipage) pagebx_[ipage] = ipage;
+        for (auto& bx : nwritten_)
+          for (auto& n : bx) n = (1<<kNBitDataAddr)-1;
         clear();
   }
 
   ~MemoryTemplateBinned(){}
 
+  // Only the entries written since the last clear() are reset
   void clear()
   {
-    DataType data("0",16);
-    for (size_t ibx=0; ibx<kNBxBins; ++ibx) {
-      for (size_t ibin=0; ibin<kNSlots; ++ibin) {
-        nentries_[ibx][ibin] = 0;
-        for (size_t addr=0; addr<((1<<kNBitDataAddr)-1); ++addr) { // Temporary "-1" to only allow 15 (7 for VMSME DISK) stubs per bin instead of 16 (8) to match emulation
-          write_mem(ibx,ibin,data,addr);
-        }
-      }
+    if (stats_) stats_->endEvent();
+    for (unsigned int ipage=0; ipage<kNPages; ++ipage) {
+      resetPage(ipage);
     }
   }
 
+  // Records the occupancy of each bin in each event, see MemoryStatistics.h
+  void collectStatistics(const std::string& name)
+  {
+    stats_ = MemoryStatistics::create(name, kNBxBins, kNSlots, (1<<kNBitDataAddr)-1);
+  }
+
   ///////////////////////////////////
   std::vector<std::string> split(const std::string& s, char delimiter)
   {
@@ -126,10 +202,21 @@ public:
     // Originally: atoi(split(line, ' ').front().c_str()); but that didn't work for disks with 16 bins
 
     DataType data(datastr.c_str(), base);
-    int nent = nentries_[bx][slot];
+    int nent = getEntries(bx, slot);
+    bool success = write_mem(bx, slot, data, nent);
+    #if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+    if (success) nentries_[page(bx)][slot] ++;
+    #endif
+    return success;
+  }
+
+  // write memory from binary memory print
+  bool write_mem(BunchXingT bx, ap_uint<NBIT_BIN> slot, const DataType& data)
+  {
+    int nent = getEntries(bx, slot);
     bool success = write_mem(bx, slot, data, nent);
-    #ifndef CMSSW_GIT_HASH
-    if (success) nentries_[bx][slot] ++;
+    #if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+    if (success) nentries_[page(bx)][slot] ++;
     #endif
     return success;
   }
@@ -144,13 +231,13 @@ public:
 
   void print_entry(BunchXingT bx, ap_uint<NBIT_ADDR> index) const
   {
-	print_data(dataarray_[bx][index]);
+	print_data(read_mem(bx,index));
   }
 
   void print_mem(BunchXingT bx) const
   {
 	for(int slot=0;slot<(kNSlots);slot++) {
-	  for (int i = 0; i < nentries_[bx][slot]; ++i) {
+	  for (int i = 0; i < getEntries(bx,slot); ++i) {
 		std::cout << bx << " " << i << " ";
 		print_entry(bx, i + slot*(1<<(kNBitDataAddr)) );
  	  }
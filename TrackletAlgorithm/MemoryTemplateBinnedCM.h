@@ -2,11 +2,14 @@
 #ifndef TrackletAlgorithm_MemoryTemplateBinnedCM_h
 #define TrackletAlgorithm_MemoryTemplateBinnedCM_h
 
+#include "MemoryPages.h"
+
 #ifndef __SYNTHESIS__
 #include <iostream>
 #include <sstream>
 #include <vector>
 #include <bitset>
+#include "MemoryStatistics.h"
 #endif
 
 template<class DataType, unsigned int NBIT_BX, unsigned int NBIT_ADDR,
@@ -27,14 +30,67 @@ class MemoryTemplateBinnedCM{
  protected:
   enum BitWidths {
     kNBxBins = 1<<NBIT_BX,
+    kNPages = nMemoryPages<NBIT_BX>(), // BXs kept, see MemoryPages.h
     kNSlots = 1<<NBIT_BIN,
     kNMemDepth = 1<<NBIT_ADDR
   };
 
-  DataType dataarray_[NCOPY][kNBxBins][kNMemDepth];  // data array
+  DataType dataarray_[NCOPY][kNPages][kNMemDepth];  // data array
+
+  ap_uint<8> binmask8_[kNPages][8];
+  ap_uint<32> nentries8_[kNPages][8];
+#ifndef __SYNTHESIS__
+  int pagebx_[kNPages];             // BX held by each page
+  int nwritten_[kNPages][kNSlots];  // highest entry written in each bin since the last clear() + 1
+  std::shared_ptr<MemoryStatistics> stats_; // occupancy statistics, if collected
+#endif
+
+  // Page holding a BX
+  static unsigned int page(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    return (unsigned int)bx % kNPages;
+#endif
+  }
+
+  // Page a BX is written to. In C simulation, a page still holding another BX
+  // is emptied first.
+  unsigned int writePage(BunchXingT bx) {
+#pragma HLS inline
+#ifdef __SYNTHESIS__
+    return bx;
+#else
+    const unsigned int ipage = page(bx);
+    if (pagebx_[ipage] != bx) {
+      resetPage(ipage);
+      pagebx_[ipage] = bx;
+    }
+    return ipage;
+#endif
+  }
 
-  ap_uint<8> binmask8_[kNBxBins][8];
-  ap_uint<32> nentries8_[kNBxBins][8];
+#ifndef __SYNTHESIS__
+  bool hasPage(BunchXingT bx) const { return pagebx_[page(bx)] == bx; }
+
+  // Only the entries written since the last reset are reset
+  void resetPage(unsigned int ipage) {
+    static const DataType data("0",16);
+    for (unsigned int i = 0; i < kNSlots; ++i) {
+      for (int j = 0; j < nwritten_[ipage][i]; ++j) {
+        for (unsigned int icopy = 0; icopy < NCOPY; ++icopy) {
+          dataarray_[icopy][ipage][getNEntryPerBin()*i+j] = data;
+        }
+      }
+      nwritten_[ipage][i] = 0;
+    }
+    for (unsigned int ibin = 0; ibin < 8; ++ibin) {
+      nentries8_[ipage][ibin] = 0;
+      binmask8_[ipage][ibin] = 0;
+    }
+  }
+#endif
 
   
  public:
@@ -48,17 +104,23 @@ class MemoryTemplateBinnedCM{
   NEntryT getEntries(BunchXingT bx, ap_uint<NBIT_BIN> slot) const {
     ap_uint<3> ibin,ireg;
     (ibin,ireg)=slot;
-    return nentries8_[bx][ibin].range(ireg*4+3,ireg*4);
+    return getEntries8(bx, ibin).range(ireg*4+3,ireg*4);
   }
 
   ap_uint<32> getEntries8(BunchXingT bx, ap_uint<3> ibin) const {
     #pragma HLS ARRAY_PARTITION variable=nentries8_ complete dim=0
-    return nentries8_[bx][ibin];
+#ifndef __SYNTHESIS__
+    if (not hasPage(bx)) return 0;
+#endif
+    return nentries8_[page(bx)][ibin];
   }
 
   ap_uint<8> getBinMask8(BunchXingT bx, ap_uint<3> ibin) const {
     #pragma HLS ARRAY_PARTITION variable=binmask8_ complete dim=0
-    return binmask8_[bx][ibin];
+#ifndef __SYNTHESIS__
+    if (not hasPage(bx)) return 0;
+#endif
+    return binmask8_[page(bx)][ibin];
   }
 
   NEntryT getEntries(BunchXingT bx) const {
@@ -69,27 +131,31 @@ class MemoryTemplateBinnedCM{
     return val;
   }
   
-  const DataType (&getMem(unsigned int icopy) const)[1<<NBIT_BX][1<<NBIT_ADDR] {
+  const DataType (&getMem(unsigned int icopy) const)[kNPages][1<<NBIT_ADDR] {
 #pragma HLS ARRAY_PARTITION variable=dataarray_ dim=1
     return dataarray_[icopy];
   }
 
 
-  const DataType (&get_mem() const)[NCOPY][1<<NBIT_BX][1<<NBIT_ADDR] {
+  const DataType (&get_mem() const)[NCOPY][kNPages][1<<NBIT_ADDR] {
     return dataarray_;
   }
 
   DataType read_mem(unsigned int icopy, BunchXingT ibx, ap_uint<NBIT_ADDR> index) const {
 #pragma HLS ARRAY_PARTITION variable=dataarray_ dim=1
     // TODO: check if valid
-    return dataarray_[icopy][ibx][index];
+#ifndef __SYNTHESIS__
+    static const DataType empty("0",16);
+    if (not hasPage(ibx)) return empty;
+#endif
+    return dataarray_[icopy][page(ibx)][index];
   }
   
   DataType read_mem(unsigned int icopy, BunchXingT ibx, ap_uint<NBIT_BIN> slot,
 		    ap_uint<NBIT_ADDR> index) const {
 #pragma HLS ARRAY_PARTITION variable=dataarray_ dim=1
     // TODO: check if valid
-    return dataarray_[icopy][ibx][getNEntryPerBin()*slot+index];
+    return read_mem(icopy, ibx, getNEntryPerBin()*slot+index);
   }
   
   bool write_mem(BunchXingT ibx, ap_uint<NBIT_BIN> slot, DataType data, int nentry_ibx) {
@@ -97,19 +163,29 @@ class MemoryTemplateBinnedCM{
 
 #pragma HLS inline
 
+#ifndef __SYNTHESIS__
+    if (stats_) stats_->write(ibx, slot, nentry_ibx, nentry_ibx < getNEntryPerBin()-1);
+#endif
     if (nentry_ibx < getNEntryPerBin()-1) { // Max 15 stubs in each memory due to 4 bit nentries
       // write address for slot: getNEntryPerBin() * slot + nentry_ibx
+      const unsigned int ipage = writePage(ibx);
   
     writememloop:for (unsigned int icopy=0;icopy<NCOPY;icopy++) {
 #pragma HLS unroll
-	dataarray_[icopy][ibx][getNEntryPerBin()*slot+nentry_ibx] = data;
+	dataarray_[icopy][ipage][getNEntryPerBin()*slot+nentry_ibx] = data;
       }
+#ifndef __SYNTHESIS__
+      if (nentry_ibx >= nwritten_[ipage][slot]) nwritten_[ipage][slot] = nentry_ibx + 1;
+#endif
 
-      #ifdef CMSSW_GIT_HASH
+      // The firmware memories count their entries. The C simulation counts
+      // them too with CSIM_MEMORY_ENTRY_COUNT, so that the next module of a
+      // chain reads them.
+      #if defined(CMSSW_GIT_HASH) || defined(CSIM_MEMORY_ENTRY_COUNT)
       ap_uint<3> ibin,ireg;
       (ireg,ibin)=slot;
-      nentries8_[ibx][ibin].range(ireg*4+3,ireg*4)=nentry_ibx+1;
-      binmask8_[ibx][ibin].set_bit(ireg,true);
+      nentries8_[ipage][ibin].range(ireg*4+3,ireg*4)=nentry_ibx+1;
+      binmask8_[ipage][ibin].set_bit(ireg,true);
       #endif
 
       return true;
@@ -129,29 +205,27 @@ class MemoryTemplateBinnedCM{
 #ifndef __SYNTHESIS__
 
   MemoryTemplateBinnedCM() {
+    for (unsigned int ipage = 0; ipage < kNPages; ++ipage) pagebx_[ipage] = ipage;
+    for (auto& bx : nwritten_)
+      for (auto& n : bx) n = getNEntryPerBin();
     clear();
   }
   
   ~MemoryTemplateBinnedCM() {}
   
+  // Only the entries written since the last clear() are reset
   void clear() {
-    
-    DataType data("0",16);
-    for (size_t ibx=0; ibx<(kNBxBins); ++ibx) {
-      // Clear data
-      for (int i = 0; i < getNBins(); ++i ) {
-        for (int j = 0; j < getNEntryPerBin(); ++j) {
-          write_mem(ibx, i, data, j);
-        }
-      }
-      // Clear nentries8 and binmask8
-      for (unsigned int ibin = 0; ibin < getNBins()/8; ++ibin) {
-        nentries8_[ibx][ibin] = 0;
-        binmask8_[ibx][ibin] = 0;
-      }
+    if (stats_) stats_->endEvent();
+    for (unsigned int ipage = 0; ipage < kNPages; ++ipage) {
+      resetPage(ipage);
     }
   }
 
+  // Records the occupancy of each bin in each event, see MemoryStatistics.h
+  void collectStatistics(const std::string& name) {
+    stats_ = MemoryStatistics::create(name, kNBxBins, kNSlots, getNEntryPerBin()-1);
+  }
+
 
   ///////////////////////////////////
   std::vector<std::string> split(const std::string& s, char delimiter)
@@ -176,15 +250,33 @@ class MemoryTemplateBinnedCM{
 
     ap_uint<3> ibin,ireg;
     (ireg,ibin)=slot;
-    ap_uint<4> nentry_ibx = nentries8_[ibx][ibin].range(ireg*4+3,ireg*4);
+    ap_uint<4> nentry_ibx = getEntries8(ibx, ibin).range(ireg*4+3,ireg*4);
     
     DataType data(datastr.c_str(), base);
 
     bool success = write_mem(ibx, slot, data, nentry_ibx);
-    #ifndef CMSSW_GIT_HASH
+    #if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
+    if (success) {
+      nentries8_[page(ibx)][ibin].range(ireg*4+3,ireg*4)=nentry_ibx+1;
+      binmask8_[page(ibx)][ibin].set_bit(ireg,true);
+    }
+    #endif
+
+    return success;
+  }
+
+  // write memory from binary memory print
+  bool write_mem(BunchXingT ibx, ap_uint<NBIT_BIN> slot, const DataType& data)
+  {
+    ap_uint<3> ibin,ireg;
+    (ireg,ibin)=slot;
+    ap_uint<4> nentry_ibx = getEntries8(ibx, ibin).range(ireg*4+3,ireg*4);
+
+    bool success = write_mem(ibx, slot, data, nentry_ibx);
+    #if !defined(CMSSW_GIT_HASH) && !defined(CSIM_MEMORY_ENTRY_COUNT)
     if (success) {
-      nentries8_[ibx][ibin].range(ireg*4+3,ireg*4)=nentry_ibx+1;
-      binmask8_[ibx][ibin].set_bit(ireg,true);
+      nentries8_[page(ibx)][ibin].range(ireg*4+3,ireg*4)=nentry_ibx+1;
+      binmask8_[page(ibx)][ibin].set_bit(ireg,true);
     }
     #endif
 
@@ -209,7 +301,7 @@ class MemoryTemplateBinnedCM{
 	for(int slot=0;slot<8;slot++) {
       //std::cout << "slot "<<slot<<" entries "
       //		<<nentries_[bx%NBX].range((slot+1)*4-1,slot*4)<<endl;
-      for (int i = 0; i < nentries8_[bx][slot]; ++i) {
+      for (int i = 0; i < getEntries8(bx,slot); ++i) {
 		std::cout << bx << " " << i << " ";
 		print_entry(bx, i + slot*getNEntryPerBin() );
       }
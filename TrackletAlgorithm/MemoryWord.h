@@ -0,0 +1,181 @@
+// Storage of the data words of the memories.
+//
+// The data classes (AllStub, VMStubME, TrackletProjection, ...) keep their
+// word of W bits in a MemoryWord<W>::type and access the fields through
+//   getBits<MSB,LSB>(data_)         instead of data_.range(MSB,LSB)
+//   setBits<MSB,LSB>(data_, value)  instead of data_.range(MSB,LSB) = value
+//   fromMemoryWord<W>(data_)        to return the word as an ap_uint<W>
+//   toMemoryWord<W>(word)           to store an ap_uint<W>
+// By default the word is an ap_uint<W> and these are the usual range() calls.
+// A C simulation compiled with -DCSIM_NATIVE_MEMORY_WORDS (set by the CMake
+// build, option CSIM_NATIVE_MEMORY_WORDS) keeps words of up to 64 (128) bits in
+// a uint64_t (unsigned __int128) and extracts the fields with shifts and masks,
+// which avoids building an ap_range_ref for every field. The MemoryWord test
+// checks that both give the same fields.
+#ifndef TrackletAlgorithm_MemoryWord_h
+#define TrackletAlgorithm_MemoryWord_h
+
+#include "ap_int.h"
+
+template<int W, bool NATIVE = false> struct MemoryWordImpl { typedef ap_uint<W> type; };
+
+template<int MSB, int LSB, int W>
+inline ap_uint<MSB-LSB+1> getBits(const ap_uint<W>& word)
+{
+#pragma HLS inline
+  return word.range(MSB,LSB);
+}
+
+template<int MSB, int LSB, int W, class T>
+inline void setBits(ap_uint<W>& word, const T& value)
+{
+#pragma HLS inline
+  word.range(MSB,LSB) = value;
+}
+
+template<int W>
+inline ap_uint<W> fromMemoryWord(const ap_uint<W>& word)
+{
+#pragma HLS inline
+  return word;
+}
+
+template<int W>
+inline ap_uint<W> toMemoryWord(const ap_uint<W>& word, const ap_uint<W>*)
+{
+#pragma HLS inline
+  return word;
+}
+
+#if !defined(__SYNTHESIS__) && defined(CSIM_NATIVE_MEMORY_WORDS)
+
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 MemoryWordNative;
+constexpr int kMemoryWordNativeBits = 128;
+#else
+typedef uint64_t MemoryWordNative;
+constexpr int kMemoryWordNativeBits = 64;
+#endif
+
+template<int W> struct MemoryWordImpl<W, true> {
+  typedef typename std::conditional<(W <= 64), uint64_t, MemoryWordNative>::type type;
+};
+
+template<int W> struct MemoryWord : MemoryWordImpl<W, (W <= kMemoryWordNativeBits)> {};
+
+// Mask of the N lowest bits
+template<class T, int N>
+constexpr T lowBits()
+{
+  return ~T(0) >> (8*sizeof(T) - N);
+}
+
+// The bits of a value, as for an assignment to an ap_range_ref
+template<class T, int K>
+inline T nativeBits(const ap_uint<K>& value)
+{
+  if (K <= 64) return value.to_uint64();
+  T bits = 0;
+  for (int i = 0; i < K && i < int(8*sizeof(T)); i += 64)
+    bits |= T(ap_uint<K>(value >> i).to_uint64()) << i;
+  return bits;
+}
+
+// A negative value is sign extended, as by an assignment to a wider field
+template<class T, int K>
+inline T nativeBits(const ap_int<K>& value)
+{
+  const T bits = nativeBits<T>(ap_uint<K>(value));
+  if (K >= int(8*sizeof(T)) || value >= 0) return bits;
+  return bits | ~lowBits<T, (K < int(8*sizeof(T))) ? K : 1>();
+}
+
+template<class T, class V>
+inline typename std::enable_if<std::is_arithmetic<V>::value, T>::type nativeBits(const V& value)
+{
+  return T(value);
+}
+
+// Any other expression (range, concatenation, arithmetic result)
+template<class T, class V>
+inline typename std::enable_if<not std::is_arithmetic<V>::value, T>::type nativeBits(const V& value)
+{
+  return nativeBits<T>(ap_uint<kMemoryWordNativeBits>(value));
+}
+
+template<int MSB, int LSB>
+inline ap_uint<MSB-LSB+1> getBits(uint64_t word)
+{
+  return ap_uint<MSB-LSB+1>((word >> LSB) & lowBits<uint64_t, MSB-LSB+1>());
+}
+
+template<int MSB, int LSB, class T>
+inline void setBits(uint64_t& word, const T& value)
+{
+  const uint64_t mask = lowBits<uint64_t, MSB-LSB+1>() << LSB;
+  word = (word & ~mask) | ((nativeBits<uint64_t>(value) << LSB) & mask);
+}
+
+template<int W>
+inline ap_uint<W> fromMemoryWord(uint64_t word)
+{
+  return ap_uint<W>(word);
+}
+
+template<int W>
+inline uint64_t toMemoryWord(const ap_uint<W>& word, const uint64_t*)
+{
+  return word.to_uint64();
+}
+
+#ifdef __SIZEOF_INT128__
+template<int MSB, int LSB>
+inline ap_uint<MSB-LSB+1> getBits(unsigned __int128 word)
+{
+  const unsigned __int128 bits = (word >> LSB) & lowBits<unsigned __int128, MSB-LSB+1>();
+  if (MSB-LSB+1 <= 64) return ap_uint<MSB-LSB+1>(uint64_t(bits));
+  ap_uint<MSB-LSB+1> value = uint64_t(bits >> 64);
+  value <<= 64;
+  value |= uint64_t(bits);
+  return value;
+}
+
+template<int MSB, int LSB, class T>
+inline void setBits(unsigned __int128& word, const T& value)
+{
+  const unsigned __int128 mask = lowBits<unsigned __int128, MSB-LSB+1>() << LSB;
+  word = (word & ~mask) | ((nativeBits<unsigned __int128>(value) << LSB) & mask);
+}
+
+template<int W>
+inline ap_uint<W> fromMemoryWord(unsigned __int128 word)
+{
+  return getBits<W-1,0>(word);
+}
+
+template<int W>
+inline unsigned __int128 toMemoryWord(const ap_uint<W>& word, const unsigned __int128*)
+{
+  return nativeBits<unsigned __int128>(word);
+}
+#endif
+
+#else
+
+template<int W> struct MemoryWord : MemoryWordImpl<W> {};
+
+#endif
+
+// Converts an ap_uint<W> (or a concatenation of fields) to the storage of a
+// MemoryWord<W>
+template<int W>
+inline typename MemoryWord<W>::type toMemoryWord(const ap_uint<W>& word)
+{
+#pragma HLS inline
+  return toMemoryWord(word, static_cast<const typename MemoryWord<W>::type*>(nullptr));
+}
+
+#endif
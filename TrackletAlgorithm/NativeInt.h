@@ -0,0 +1,133 @@
+// Signed and unsigned integers of W <= 64 bits held in native 64-bit integers,
+// for the C simulation only.
+//
+// NativeInt<W> follows the width rules of ap_int<W>: the result of a + b or
+// a - b is one bit wider than the wider operand, a * b is as wide as both
+// operands together, a & b is as wide as the wider operand, a << n and a >> n
+// keep the width of a, and an int operand counts as 32 bits. Widths are capped
+// at 64 bits, so a wider intermediate result keeps only its 64 low bits, which
+// is exact as long as it is assigned to a variable of at most 64 bits before it
+// is shifted right or compared. Assigning a value to a NativeInt<W> keeps its W
+// low bits and sign extends them, as for an ap_int<W>.
+//
+// They are used by the native version of TC::calculate_LXLY, see
+// emData/generate_TC_native.py.
+#ifndef TrackletAlgorithm_NativeInt_h
+#define TrackletAlgorithm_NativeInt_h
+
+#ifndef __SYNTHESIS__
+
+#include <cstdint>
+#include <type_traits>
+
+constexpr int nativeIntWidth(int w) { return w > 64 ? 64 : w; }
+constexpr int nativeIntMax(int a, int b) { return a > b ? a : b; }
+
+template<int W>
+class NativeInt
+{
+  static_assert(W > 0 && W <= 64, "NativeInt holds at most 64 bits");
+
+public:
+
+  constexpr NativeInt(): value_(0) {}
+
+  template<class T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+  constexpr NativeInt(T value): value_(wrap(int64_t(value))) {}
+
+  template<int K>
+  constexpr NativeInt(const NativeInt<K>& value): value_(wrap(value.value())) {}
+
+  // From ap_int, ap_uint and their expressions
+  template<class T, typename std::enable_if<not std::is_arithmetic<T>::value, int>::type = 0>
+  NativeInt(const T& value): value_(wrap(value.to_int64())) {}
+
+  constexpr int64_t value() const { return value_; }
+
+  NativeInt<W> operator<<(int shift) const { return NativeInt<W>(int64_t(uint64_t(value_) << shift)); }
+  NativeInt<W> operator>>(int shift) const { return NativeInt<W>(value_ >> shift); }
+  NativeInt<nativeIntWidth(W+1)> operator-() const { return NativeInt<nativeIntWidth(W+1)>(-value_); }
+
+private:
+
+  static constexpr int64_t wrap(int64_t value) {
+    return (W >= 64) ? value : int64_t(uint64_t(value) << (64 - W)) >> (64 - W);
+  }
+
+  int64_t value_;
+};
+
+template<int W>
+class NativeUInt
+{
+  static_assert(W > 0 && W < 64, "NativeUInt holds less than 64 bits");
+
+public:
+
+  NativeUInt(): value_(0) {}
+
+  template<int K>
+  NativeUInt(const NativeInt<K>& value): value_(uint64_t(value.value()) & kMask) {}
+
+  NativeUInt(uint64_t value): value_(value & kMask) {}
+
+  // Used as an address
+  operator uint64_t() const { return value_; }
+
+private:
+
+  static constexpr uint64_t kMask = (uint64_t(1) << W) - 1;
+
+  uint64_t value_;
+};
+
+// WIDTH is the width of the result, given the widths A and B of the operands.
+// An int operand counts as a NativeInt<32>.
+#define NATIVE_INT_BINARY_OPERATOR(OP, WIDTH)                                                      \
+  template<int A, int B>                                                                           \
+  inline NativeInt<nativeIntWidth(WIDTH)> operator OP(const NativeInt<A>& a, const NativeInt<B>& b) \
+  {                                                                                                \
+    return NativeInt<nativeIntWidth(WIDTH)>(int64_t(uint64_t(a.value()) OP uint64_t(b.value())));  \
+  }                                                                                                \
+  template<int A>                                                                                  \
+  inline auto operator OP(const NativeInt<A>& a, int b) -> decltype(a OP NativeInt<32>(b))         \
+  {                                                                                                \
+    return a OP NativeInt<32>(b);                                                                  \
+  }                                                                                                \
+  template<int B>                                                                                  \
+  inline auto operator OP(int a, const NativeInt<B>& b) -> decltype(NativeInt<32>(a) OP b)         \
+  {                                                                                                \
+    return NativeInt<32>(a) OP b;                                                                  \
+  }
+
+NATIVE_INT_BINARY_OPERATOR(+, nativeIntMax(A, B) + 1)
+NATIVE_INT_BINARY_OPERATOR(-, nativeIntMax(A, B) + 1)
+NATIVE_INT_BINARY_OPERATOR(*, A + B)
+NATIVE_INT_BINARY_OPERATOR(&, nativeIntMax(A, B))
+NATIVE_INT_BINARY_OPERATOR(|, nativeIntMax(A, B))
+
+#undef NATIVE_INT_BINARY_OPERATOR
+
+#define NATIVE_INT_COMPARISON(OP)                                                    \
+  template<int A, int B>                                                             \
+  inline bool operator OP(const NativeInt<A>& a, const NativeInt<B>& b)              \
+  {                                                                                  \
+    return a.value() OP b.value();                                                   \
+  }                                                                                  \
+  template<int A>                                                                    \
+  inline bool operator OP(const NativeInt<A>& a, int64_t b) { return a.value() OP b; } \
+  template<int B>                                                                    \
+  inline bool operator OP(int64_t a, const NativeInt<B>& b) { return a OP b.value(); }
+
+NATIVE_INT_COMPARISON(<)
+NATIVE_INT_COMPARISON(<=)
+NATIVE_INT_COMPARISON(>)
+NATIVE_INT_COMPARISON(>=)
+NATIVE_INT_COMPARISON(==)
+NATIVE_INT_COMPARISON(!=)
+
+#undef NATIVE_INT_COMPARISON
+
+#endif // __SYNTHESIS__
+
+#endif
@@ -7,6 +7,10 @@
 #include "AllProjectionMemory.h"
 #include "VMProjectionMemory.h"
 
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
 //#include <assert.h>
 
 namespace PR
@@ -76,6 +80,10 @@ void ProjectionRouter(BXType bx,
   ap_uint<kNBits_MemAddr> numbersin[nINMEM];
   ap_uint<kNBits_MemAddr> mem_read_addr;
 
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("ProjectionRouter::PROC_LOOP", kMaxProc - kMaxProcOffset(module::PR));
+#endif
+
   PROC_LOOP: for (int istep = 0; istep < kMaxProc - kMaxProcOffset(module::PR); ++istep) {
 #pragma HLS PIPELINE II=1 rewind
     if (istep == 0) {
@@ -102,6 +110,9 @@ void ProjectionRouter(BXType bx,
     // read inputs
     TrackletProjection<PROJTYPE> tproj;
     bool validin = read_input_mems<PROJTYPE,nINMEM>(bx, mem_hasdata, numbersin, mem_read_addr, projin, tproj);
+#ifndef __SYNTHESIS__
+    loopStats.useful += validin;
+#endif
 
     if (validin) {
 
@@ -207,6 +218,15 @@ void ProjectionRouter(BXType bx,
 
   } // end of PROC_LOOP
 
+#ifndef __SYNTHESIS__
+  // Projections not read, in the memory being read and the ones after it
+  for (int i = 0; i < nINMEM; i++) {
+    if (mem_hasdata[i]) loopStats.leftover += numbersin[i];
+  }
+  if (mem_hasdata != 0) loopStats.leftover -= mem_read_addr;
+  loopStats.record();
+#endif
+
   bx_o = bx;
   
 } // ProjectionRouter
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_StubPairMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // Data object definition
@@ -28,11 +29,11 @@ public:
 
   // Constructors
   StubPair(const StubPairData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<kStubPairSize>(newdata))
   {}
 
   StubPair(const SPInnerIndex innerindex, const SPOuterIndex outerindex):
-    data_( (innerindex,outerindex) )
+    data_(toMemoryWord<kStubPairSize>((innerindex,outerindex)))
   {}
   
   StubPair():
@@ -43,35 +44,35 @@ public:
   StubPair(const char* datastr, int base=16)
   {
     StubPairData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<kStubPairSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return kStubPairSize;}
 
-  StubPairData raw() const {return data_;}
+  StubPairData raw() const {return fromMemoryWord<kStubPairSize>(data_);}
   
   SPInnerIndex getInnerIndex() const {
-    return data_.range(kSPInnerIndexMSB,kSPInnerIndexLSB);
+    return getBits<kSPInnerIndexMSB,kSPInnerIndexLSB>(data_);
   }
 
   SPOuterIndex getOuterIndex() const {
-    return data_.range(kSPOuterIndexMSB,kSPOuterIndexLSB);
+    return getBits<kSPOuterIndexMSB,kSPOuterIndexLSB>(data_);
   }
 
   // Setter
   void setInnerIndex(const SPInnerIndex id) {
-    data_.range(kSPInnerIndexMSB,kSPInnerIndexLSB) = id;
+    setBits<kSPInnerIndexMSB,kSPInnerIndexLSB>(data_, id);
   }
 
   void setOuterIndex(const SPOuterIndex id) {
-    data_.range(kSPOuterIndexMSB,kSPOuterIndexLSB) = id;
+    setBits<kSPOuterIndexMSB,kSPOuterIndexLSB>(data_, id);
   }
 
 private:
   
-  StubPairData data_;
+  MemoryWord<kStubPairSize>::type data_;
   
 };
 
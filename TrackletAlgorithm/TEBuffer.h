@@ -25,11 +25,13 @@ class TEData {
     kTEDatarzdiffmaxLSB = kTEDatastartMSB + 1,
     kTEDatarzdiffmaxMSB = kTEDatarzdiffmaxLSB + TrackletEngineUnit<BARRELPS>::kNBitsRZFine - 1,
     kTEDataAllStubLSB = kTEDatarzdiffmaxMSB + 1,
-    kTEDataAllStubMSB = kTEDataAllStubLSB + AllStubInner<BARRELPS>::kAllStubInnerSize - 1
+    kTEDataAllStubMSB = kTEDataAllStubLSB + AllStubInner<BARRELPS>::kAllStubInnerSize - 1,
+    kTEDataLongListLSB = kTEDataAllStubMSB + 1,
+    kTEDataLongListMSB = kTEDataLongListLSB
   };
 
   typedef ap_uint<kNBitsIMem> IMEM;
-  typedef ap_uint<kTEDataAllStubMSB+1> TEDATA;
+  typedef ap_uint<kTEDataLongListMSB+1> TEDATA;
 
  TEData():
   data_(0)
@@ -55,6 +57,12 @@ class TEData {
     return data_.range(kTEDataStubMaskMSB,kTEDataStubMaskLSB);
   }
 
+  // The stub has more outer-stub candidates than the TrackletProcessor
+  // dispatches to any idle TE unit
+  ap_uint<1> getLongList() const {
+    return data_[kTEDataLongListLSB];
+  }
+
  TEData(const TEData& tedata):
   data_(tedata.data_)
   {}
@@ -67,9 +75,10 @@ class TEData {
 	 const TrackletEngineUnit<BARRELPS>::RZFINE rzbinfirst, 
 	 const TrackletEngineUnit<BARRELPS>::RZBIN start, 
 	 const TrackletEngineUnit<BARRELPS>::RZFINE rzdiffmax, 
-	 const AllStubInner<BARRELPS>::AllStubInnerData stub
+	 const AllStubInner<BARRELPS>::AllStubInnerData stub,
+	 const ap_uint<1> longlist = 0
 	 ):
-  data_( (stub, rzdiffmax, start, rzbinfirst, stubmask) )
+  data_( (longlist, stub, rzdiffmax, start, rzbinfirst, stubmask) )
     {}
 
   TEDATA raw() const {return data_;}
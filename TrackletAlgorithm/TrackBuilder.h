@@ -5,6 +5,10 @@
 #include "FullMatchMemory.h"
 #include "TrackFitMemory.h"
 
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
 static const unsigned short kNBitsTBBuffer = 1;
 static const unsigned short kMinNMatches = 2;
 static const unsigned short kInvalidTrackletID = 0x3FFF;
@@ -98,6 +102,11 @@ void TrackBuilder(
 
   IndexType nTracks = 0;
 
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("TrackBuilder::full_matches", kMaxProc);
+  unsigned int nMatchesRead = 0;
+#endif
+
   full_matches : for (unsigned short i = 0; i < kMaxProc; i++) {
 #pragma HLS pipeline II=1 rewind
 
@@ -160,6 +169,12 @@ void TrackBuilder(
       min_id = (disk_valid[j] ? disk_id_0 : min_id);
     }
 
+#ifndef __SYNTHESIS__
+    loopStats.useful += (min_id != kInvalidTrackletID);
+    for (unsigned short j = 0; j < NFMBarrel; j++) nMatchesRead += barrel_valid[j];
+    for (unsigned short j = 0; j < NFMDisk; j++) nMatchesRead += disk_valid[j];
+#endif
+
     // Initialize a TrackFit object using the tracklet parameters associated
     // with the minimum tracklet ID.
     const TCIDType &TCID = (min_id != kInvalidTrackletID) ? (min_id >> kNBits_MemAddr) : TrackletIDType(0);
@@ -285,12 +300,20 @@ void TrackBuilder(
     }
     nTracks += (nMatches >= kMinNMatches ? 1 : 0);
 
+#ifndef __SYNTHESIS__
+    // Stalled if a full match is waiting in a memory whose buffer is full
+    bool stalled = false;
+#endif
+
     // Update the circular buffer indices and read a new element from each of
     // the input full-match memories.
     barrel_circular_buffer_update : for (unsigned short j = 0; j < NFMBarrel; j++) {
       barrel_read_index[j] += (barrel_valid[j] ? 1 : 0);
       const ap_uint<kNBitsTBBuffer> barrel_next_write_index = barrel_write_index[j] + 1;
       const ap_uint<1> barrel_not_full = (barrel_next_write_index != barrel_read_index[j]);
+#ifndef __SYNTHESIS__
+      stalled |= (!empty && !barrel_not_full && barrel_mem_index[j] < barrelFullMatches[j].getEntries(bx));
+#endif
       getFM<BARREL>(bx, barrelFullMatches[j], barrel_mem_index[j], barrel_fm[j][barrel_write_index[j]]);
       barrel_mem_index[j] += ((empty || barrel_not_full) ? 1 : 0);
       barrel_write_index[j] += ((empty || barrel_not_full) ? 1 : 0);
@@ -300,12 +323,28 @@ void TrackBuilder(
       disk_read_index[j] += (disk_valid[j] ? 1 : 0);
       const ap_uint<kNBitsTBBuffer> disk_next_write_index = disk_write_index[j] + 1;
       const ap_uint<1> disk_not_full = (disk_next_write_index != disk_read_index[j]);
+#ifndef __SYNTHESIS__
+      stalled |= (!empty && !disk_not_full && disk_mem_index[j] < diskFullMatches[j].getEntries(bx));
+#endif
       getFM<DISK>(bx, diskFullMatches[j], disk_mem_index[j], disk_fm[j][disk_write_index[j]]);
       disk_mem_index[j] += ((empty || disk_not_full) ? 1 : 0);
       disk_write_index[j] += ((empty || disk_not_full) ? 1 : 0);
     }
+
+#ifndef __SYNTHESIS__
+    loopStats.stalled += stalled;
+#endif
   }
 
+#ifndef __SYNTHESIS__
+  // Full matches not used, whether still in the memories or in the buffers
+  unsigned int nMatchesIn = 0;
+  for (unsigned short j = 0; j < NFMBarrel; j++) nMatchesIn += barrelFullMatches[j].getEntries(bx);
+  for (unsigned short j = 0; j < NFMDisk; j++) nMatchesIn += diskFullMatches[j].getEntries(bx);
+  loopStats.leftover = nMatchesIn - nMatchesRead;
+  loopStats.record();
+#endif
+
   bx_o = bx;
 }
 
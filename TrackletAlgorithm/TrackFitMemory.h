@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_TrackFitMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // TrackFitBase is where we define the bit widths.
@@ -89,6 +90,13 @@ public:
   static constexpr unsigned kTFHitCountMSB(const unsigned i) {
     return (kTFHitCountLSB(i) + TrackFitBase::kTFHitCountSize - 1);
   }
+
+  // Field MSB..LSB of a TrackFit read from one of its words (the track word or
+  // a stub word), whose LSB in the TrackFit is WordLSB
+  template<unsigned MSB, unsigned LSB, unsigned WordLSB, int W>
+  static ap_uint<MSB - LSB + 1> getWordBits(const ap_uint<W>& word) {
+    return word.range(MSB - WordLSB, LSB - WordLSB);
+  }
 };
 
 // Data object definition:
@@ -139,11 +147,11 @@ public:
 
   // Constructors
   TrackFit(const TrackFitData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<TrackFitBase::kTrackFitSize>(newdata))
   {}
 
   TrackFit(const TFTRACKINDEX trackIndex, const TFSEEDTYPE seedtype) :
-    data_( ((((((((((((((((((((((((((((((((((((((((((((((((((((((0,seedtype),TFRINV(0)),TFPHI0(0)),TFZ0(0)),TFT(0)),TFHITMAP(0)),
+    data_(toMemoryWord<TrackFitBase::kTrackFitSize>( ((((((((((((((((((((((((((((((((((((((((((((((((((((((0,seedtype),TFRINV(0)),TFPHI0(0)),TFZ0(0)),TFT(0)),TFHITMAP(0)),
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFBARRELSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBZRESID(0)),
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFBARRELSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBZRESID(0)),
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFBARRELSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBZRESID(0)),
@@ -151,7 +159,7 @@ public:
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFDISKSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBRRESID(0)),
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFDISKSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBRRESID(0)),
              TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFDISKSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBRRESID(0)),
-             TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFDISKSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBRRESID(0)) )
+             TFVALID(0)),trackIndex),TFSTUBINDEX(0)),TFDISKSTUBR(0)),TFSTUBPHIRESID(0)),TFSTUBRRESID(0)) ))
 
   {}
 
@@ -163,37 +171,37 @@ public:
   TrackFit(const char* datastr, int base = 16)
   {
     TrackFitData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<TrackFitBase::kTrackFitSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return TrackFitBase::kTrackFitSize;}
 
-  TrackFitData raw() const {return data_;}
+  TrackFitData raw() const {return fromMemoryWord<TrackFitBase::kTrackFitSize>(data_);}
 
   TFVALID getTrackValid() const {
-    return data_.range(kTFTrackValidMSB,kTFTrackValidLSB);
+    return getBits<kTFTrackValidMSB,kTFTrackValidLSB>(data_);
   }
 
   TFSEEDTYPE getSeedType() const {
-    return data_.range(kTFSeedTypeMSB,kTFSeedTypeLSB);
+    return getBits<kTFSeedTypeMSB,kTFSeedTypeLSB>(data_);
   }
 
   TFRINV getRinv() const {
-    return data_.range(kTFRinvMSB,kTFRinvLSB);
+    return getBits<kTFRinvMSB,kTFRinvLSB>(data_);
   }
 
   TFPHI0 getPhi0() const {
-    return data_.range(kTFPhi0MSB,kTFPhi0LSB);
+    return getBits<kTFPhi0MSB,kTFPhi0LSB>(data_);
   }
 
   TFZ0 getZ0() const {
-    return data_.range(kTFZ0MSB,kTFZ0LSB);
+    return getBits<kTFZ0MSB,kTFZ0LSB>(data_);
   }
 
   TFT getT() const {
-    return data_.range(kTFTMSB,kTFTLSB);
+    return getBits<kTFTMSB,kTFTLSB>(data_);
   }
 
   // The hit map tells how many stubs are matched to the track in each possible
@@ -206,160 +214,160 @@ public:
   // --- L3  L4  L5  L6  D1  D2  D3  D4 ---
   // 0b(001 001 001 001 000 000 000 000) = 0x249000
   TFHITMAP getHitMap() const {
-    return data_.range(kTFHitMapMSB,kTFHitMapLSB);
+    return getBits<kTFHitMapMSB,kTFHitMapLSB>(data_);
   }
 
   template<uint8_t Hit>
   TFHITCOUNT getHitCount() const {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFHitCountMSB(Hit),TrackFitBits::kTFHitCountLSB(Hit));
+    return getBits<TrackFitBits::kTFHitCountMSB(Hit),TrackFitBits::kTFHitCountLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFVALID getStubValid() const {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubValidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubValidLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFTRACKINDEX getTrackIndex() const {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFTrackIndexMSB(Hit),TrackFitBits::kTFTrackIndexLSB(Hit));
+    return getBits<TrackFitBits::kTFTrackIndexMSB(Hit),TrackFitBits::kTFTrackIndexLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFSTUBINDEX getStubIndex() const {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubIndexMSB(Hit),TrackFitBits::kTFStubIndexLSB(Hit));
+    return getBits<TrackFitBits::kTFStubIndexMSB(Hit),TrackFitBits::kTFStubIndexLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFBARRELSTUBR getBarrelStubR() const {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit));
+    return getBits<TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFDISKSTUBR getDiskStubR() const {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit));
+    return getBits<TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFSTUBPHIRESID getStubPhiResid() const {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubPhiResidMSB(Hit),TrackFitBits::kTFStubPhiResidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubPhiResidMSB(Hit),TrackFitBits::kTFStubPhiResidLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFSTUBZRESID getStubZResid() const {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   TFSTUBRRESID getStubRResid() const {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_);
   }
 
   TrackWord getTrackWord() const {
-    return data_.range(kTFTrackValidMSB,kTFHitMapLSB);
+    return getBits<kTFTrackValidMSB,kTFHitMapLSB>(data_);
   }
 
   template<uint8_t Hit>
   BarrelStubWord getBarrelStubWord() const {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_);
   }
 
   template<uint8_t Hit>
   DiskStubWord getDiskStubWord() const {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    return data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit));
+    return getBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_);
   }
 
   // Setter
   void setTrackValid(const TFVALID valid) {
-    data_.range(kTFTrackValidMSB,kTFTrackValidLSB) = valid;
+    setBits<kTFTrackValidMSB,kTFTrackValidLSB>(data_, valid);
   }
 
   void setSeedType(const TFSEEDTYPE seedtype) {
-    data_.range(kTFSeedTypeMSB,kTFSeedTypeLSB) = seedtype;
+    setBits<kTFSeedTypeMSB,kTFSeedTypeLSB>(data_, seedtype);
   }
 
   void setRinv(const TFRINV rinv) {
-    data_.range(kTFRinvMSB,kTFRinvLSB) = rinv;
+    setBits<kTFRinvMSB,kTFRinvLSB>(data_, rinv);
   }
 
   void setPhi0(const TFPHI0 phi0) {
-    data_.range(kTFPhi0MSB,kTFPhi0LSB) = phi0;
+    setBits<kTFPhi0MSB,kTFPhi0LSB>(data_, phi0);
   }
 
   void setZ0(const TFZ0 z0) {
-    data_.range(kTFZ0MSB,kTFZ0LSB) = z0;
+    setBits<kTFZ0MSB,kTFZ0LSB>(data_, z0);
   }
 
   void setT(const TFT t) {
-    data_.range(kTFTMSB,kTFTLSB) = t;
+    setBits<kTFTMSB,kTFTLSB>(data_, t);
   }
 
   void setHitMap(const TFHITMAP hitmap) {
-    data_.range(kTFHitMapMSB,kTFHitMapLSB) = hitmap;
+    setBits<kTFHitMapMSB,kTFHitMapLSB>(data_, hitmap);
   }
 
   template<uint8_t Hit>
   void setHitCount(const TFHITCOUNT hitcount) {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFHitCountMSB(Hit),TrackFitBits::kTFHitCountLSB(Hit)) = hitcount;
+    setBits<TrackFitBits::kTFHitCountMSB(Hit),TrackFitBits::kTFHitCountLSB(Hit)>(data_, hitcount);
   }
 
   template<uint8_t Hit>
   void setStubValid(const TFVALID valid) {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubValidLSB(Hit)) = valid;
+    setBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubValidLSB(Hit)>(data_, valid);
   }
 
   template<uint8_t Hit>
   void setTrackIndex(const TFTRACKINDEX trackindex) {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFTrackIndexMSB(Hit),TrackFitBits::kTFTrackIndexLSB(Hit)) = trackindex;
+    setBits<TrackFitBits::kTFTrackIndexMSB(Hit),TrackFitBits::kTFTrackIndexLSB(Hit)>(data_, trackindex);
   }
 
   template<uint8_t Hit>
   void setStubIndex(const TFSTUBINDEX stubindex) {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubIndexMSB(Hit),TrackFitBits::kTFStubIndexLSB(Hit)) = stubindex;
+    setBits<TrackFitBits::kTFStubIndexMSB(Hit),TrackFitBits::kTFStubIndexLSB(Hit)>(data_, stubindex);
   }
 
   template<uint8_t Hit>
   void setBarrelStubR(const TFBARRELSTUBR barrelstubr) {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)) = barrelstubr;
+    setBits<TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)>(data_, barrelstubr);
   }
 
   template<uint8_t Hit>
   void setDiskStubR(const TFDISKSTUBR diskstubr) {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)) = diskstubr;
+    setBits<TrackFitBits::kTFStubRMSB(Hit),TrackFitBits::kTFStubRLSB(Hit)>(data_, diskstubr);
   }
 
   template<uint8_t Hit>
   void setStubPhiResid(const TFSTUBPHIRESID stubphiresid) {
     static_assert(Hit >= 0 && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubPhiResidMSB(Hit),TrackFitBits::kTFStubPhiResidLSB(Hit)) = stubphiresid;
+    setBits<TrackFitBits::kTFStubPhiResidMSB(Hit),TrackFitBits::kTFStubPhiResidLSB(Hit)>(data_, stubphiresid);
   }
 
   template<uint8_t Hit>
   void setStubZResid(const TFSTUBZRESID stubzresid) {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)) = stubzresid;
+    setBits<TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_, stubzresid);
   }
 
   template<uint8_t Hit>
   void setStubRResid(const TFSTUBRRESID stubrresid) {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)) = stubrresid;
+    setBits<TrackFitBits::kTFStubRZResidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_, stubrresid);
   }
 
   template<uint8_t Hit>
@@ -385,24 +393,24 @@ public:
   }
 
   void setTrackWord(const TrackWord &word) {
-    data_.range(kTFTrackValidMSB,kTFHitMapLSB) = word;
+    setBits<kTFTrackValidMSB,kTFHitMapLSB>(data_, word);
   }
 
   template<uint8_t Hit>
   void setBarrelStubWord(const BarrelStubWord &word) {
     static_assert(Hit >= 0 && Hit <= kNBarrelStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)) = word;
+    setBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_, word);
   }
 
   template<uint8_t Hit>
   void setDiskStubWord(const DiskStubWord &word) {
     static_assert(Hit >= kNBarrelStubs && Hit <= kNStubs - 1, "Invalid hit number.");
-    data_.range(TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)) = word;
+    setBits<TrackFitBits::kTFStubValidMSB(Hit),TrackFitBits::kTFStubRZResidLSB(Hit)>(data_, word);
   }
 
 private:
 
-  TrackFitData data_;
+  MemoryWord<TrackFitBase::kTrackFitSize>::type data_;
 
 };
 
@@ -140,6 +140,10 @@ namespace TC {
     Types::der_rD * const der_rD_output
   );
 
+  template<TF::seed Seed> void seedingRadii(Types::rmean &r1mean, Types::rmean &r2mean, Types::rmean rproj[4]);
+
+  template<TF::seed Seed> bool barrelSelection(const Types::rmean rproj[4], Types::rinv * const rinv, TrackletParameters::PHI0PAR * const phi0, Types::z0 * const z0, TrackletParameters::TPAR * const t, Types::phiL phiL[4], Types::zL zL[4], Types::flag valid_proj[4], Types::phiD phiD[4], Types::rD rD[4], Types::flag valid_proj_disk[4]);
+
   template<TF::seed Seed> bool barrelSeeding(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<OuterRegion<Seed>()> &outerStub, Types::rinv * const rinv, TrackletParameters::PHI0PAR * const phi0, Types::z0 * const z0, TrackletParameters::TPAR * const t, Types::phiL phiL[4], Types::zL zL[4], Types::der_phiL * const der_phiL, Types::der_zL * const der_zL, Types::flag valid_proj[4], Types::phiD phiD[4], Types::rD rD[4], Types::der_phiD * const der_phiD, Types::der_rD * const der_rD, Types::flag valid_proj_disk[4]);
 
   template<TF::seed Seed, TC::itc iTC> const TrackletProjection<BARRELPS>::TProjTCID ID();
@@ -173,6 +177,72 @@ namespace TC {
       ap_uint<kNBits_MemAddr> nproj_barrel_2s[N_PROJOUT_BARREL2S],
       ap_uint<kNBits_MemAddr> nproj_disk[N_PROJOUT_DISK]
   );
+
+  template<TF::seed Seed, uint32_t TPROJMaskBarrel, uint32_t TPROJMaskDisk> void
+  writeTracklet(
+      const BXType bx,
+      const StubPair::SPInnerIndex innerIndex,
+      const StubPair::SPOuterIndex outerIndex,
+      const TrackletProjection<BARRELPS>::TProjTCID TCID,
+      TrackletProjection<BARRELPS>::TProjTrackletIndex &trackletIndex,
+      TrackletParameterMemory * const trackletParameters,
+      TrackletProjectionMemory<BARRELPS> projout_barrel_ps[N_PROJOUT_BARRELPS],
+      TrackletProjectionMemory<BARREL2S> projout_barrel_2s[N_PROJOUT_BARREL2S],
+      TrackletProjectionMemory<DISK> projout_disk[N_PROJOUT_DISK],
+      ap_uint<kNBits_MemAddr> &npar,
+      ap_uint<kNBits_MemAddr> nproj_barrel_ps[N_PROJOUT_BARRELPS],
+      ap_uint<kNBits_MemAddr> nproj_barrel_2s[N_PROJOUT_BARREL2S],
+      ap_uint<kNBits_MemAddr> nproj_disk[N_PROJOUT_DISK],
+      const bool success,
+      const Types::rinv rinv,
+      const TrackletParameters::PHI0PAR phi0,
+      const Types::z0 z0,
+      const TrackletParameters::TPAR t,
+      const Types::phiL phiL[4],
+      const Types::zL zL[4],
+      const Types::der_phiL der_phiL,
+      const Types::der_zL der_zL,
+      const Types::flag valid_proj[4],
+      const Types::phiD phiD[4],
+      const Types::rD rD[4],
+      const Types::der_phiD der_phiD,
+      const Types::der_rD der_rD,
+      const Types::flag valid_proj_disk[4]
+  );
+
+#ifndef __SYNTHESIS__
+// Number of stub pairs whose tracklet parameters are calculated at once by
+// calculate_LXLY_batch in a C simulation using the native version
+// (-DCSIM_TC_BATCH=<n>, 8 by default); 1 processes them one by one, as in
+// synthesis.
+#if !defined(CSIM_NATIVE_CALCULATE_LXLY)
+  constexpr int kNBatch = 1;
+#elif defined(CSIM_TC_BATCH)
+  constexpr int kNBatch = (CSIM_TC_BATCH > 0) ? CSIM_TC_BATCH : 1;
+#else
+  constexpr int kNBatch = 8;
+#endif
+
+  template<TF::seed Seed, uint32_t TPROJMaskBarrel, uint32_t TPROJMaskDisk, int N> void
+  processStubPairs(
+      const BXType bx,
+      const int nStubPairs,
+      const StubPair::SPInnerIndex innerIndex[N],
+      const AllStub<InnerRegion<Seed>()> innerStub[N],
+      const StubPair::SPOuterIndex outerIndex[N],
+      const AllStub<OuterRegion<Seed>()> outerStub[N],
+      const TrackletProjection<BARRELPS>::TProjTCID TCID,
+      TrackletProjection<BARRELPS>::TProjTrackletIndex &trackletIndex,
+      TrackletParameterMemory * const trackletParameters,
+      TrackletProjectionMemory<BARRELPS> projout_barrel_ps[N_PROJOUT_BARRELPS],
+      TrackletProjectionMemory<BARREL2S> projout_barrel_2s[N_PROJOUT_BARREL2S],
+      TrackletProjectionMemory<DISK> projout_disk[N_PROJOUT_DISK],
+      ap_uint<kNBits_MemAddr> &npar,
+      ap_uint<kNBits_MemAddr> nproj_barrel_ps[N_PROJOUT_BARRELPS],
+      ap_uint<kNBits_MemAddr> nproj_barrel_2s[N_PROJOUT_BARREL2S],
+      ap_uint<kNBits_MemAddr> nproj_disk[N_PROJOUT_DISK]
+  );
+#endif
 }
 
 template<TF::seed Seed, TC::itc iTC> constexpr uint8_t NASMemInner();
@@ -199,14 +269,16 @@ TrackletCalculator(
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TrackletCalculator_calculate_LXLY.h"
+#include "TrackletCalculator_calculate_LXLY_native.h"
+#include "TrackletCalculator_calculate_LXLY_batch.h"
 #include "TrackletCalculator_parameters.h"
 
-// This function calls calculate_LXLY, defined in
-// TrackletCalculator_calculate_LXLY.h, and applies cuts to the results.
-template<TF::seed Seed> bool
-TC::barrelSeeding(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<OuterRegion<Seed>()> &outerStub, TC::Types::rinv * const rinv, TrackletParameters::PHI0PAR * const phi0, TC::Types::z0 * const z0, TrackletParameters::TPAR * const t, TC::Types::phiL phiL[4], TC::Types::zL zL[4], TC::Types::der_phiL * const der_phiL, TC::Types::der_zL * const der_zL, TC::Types::flag valid_proj[4], TC::Types::phiD phiD[4], TC::Types::rD rD[4], TC::Types::der_phiD * const der_phiD, TC::Types::der_rD * const der_rD, TC::Types::flag valid_proj_disk[4])
+// Returns the mean radii of the two seeding layers and of the four layers the
+// tracklets are projected to.
+template<TF::seed Seed> void
+TC::seedingRadii(TC::Types::rmean &r1mean, TC::Types::rmean &r2mean, TC::Types::rmean rproj[4])
 {
-  TC::Types::rmean r1mean, r2mean, rproj[4];
+#pragma HLS inline
   switch (Seed) {
     case TF::L1L2:
       r1mean   = rmean[TF::L1];
@@ -233,8 +305,23 @@ TC::barrelSeeding(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<O
       r2mean   = rmean[TF::L6];
       break;
   }
+}
+
+// This function calls calculate_LXLY, defined in
+// TrackletCalculator_calculate_LXLY.h, and applies cuts to the results.
+template<TF::seed Seed> bool
+TC::barrelSeeding(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<OuterRegion<Seed>()> &outerStub, TC::Types::rinv * const rinv, TrackletParameters::PHI0PAR * const phi0, TC::Types::z0 * const z0, TrackletParameters::TPAR * const t, TC::Types::phiL phiL[4], TC::Types::zL zL[4], TC::Types::der_phiL * const der_phiL, TC::Types::der_zL * const der_zL, TC::Types::flag valid_proj[4], TC::Types::phiD phiD[4], TC::Types::rD rD[4], TC::Types::der_phiD * const der_phiD, TC::Types::der_rD * const der_rD, TC::Types::flag valid_proj_disk[4])
+{
+  TC::Types::rmean r1mean, r2mean, rproj[4];
+  TC::seedingRadii<Seed>(r1mean, r2mean, rproj);
   TC::Types::zmean zproj[4] = {zmean[TF::D1], zmean[TF::D2], zmean[TF::D3], zmean[TF::D4]};
+  // A C simulation compiled with -DCSIM_NATIVE_CALCULATE_LXLY (set by the CMake
+  // build) uses the bit-identical native version
+#if defined(__SYNTHESIS__) || !defined(CSIM_NATIVE_CALCULATE_LXLY)
   calculate_LXLY<Seed, InnerRegion<Seed>(), OuterRegion<Seed>()>(
+#else
+  calculate_LXLY_native<Seed, InnerRegion<Seed>(), OuterRegion<Seed>()>(
+#endif
       innerStub.getR(),
       innerStub.getPhi(),
       innerStub.getZ(),
@@ -278,6 +365,15 @@ TC::barrelSeeding(const AllStub<InnerRegion<Seed>()> &innerStub, const AllStub<O
       der_rD
   );
 
+  return TC::barrelSelection<Seed>(rproj, rinv, phi0, z0, t, phiL, zL, valid_proj, phiD, rD, valid_proj_disk);
+}
+
+// Applies the cuts to the tracklet parameters and projections calculated by
+// calculate_LXLY.
+template<TF::seed Seed> bool
+TC::barrelSelection(const TC::Types::rmean rproj[4], TC::Types::rinv * const rinv, TrackletParameters::PHI0PAR * const phi0, TC::Types::z0 * const z0, TrackletParameters::TPAR * const t, TC::Types::phiL phiL[4], TC::Types::zL zL[4], TC::Types::flag valid_proj[4], TC::Types::phiD phiD[4], TC::Types::rD rD[4], TC::Types::flag valid_proj_disk[4])
+{
+#pragma HLS inline
 // Determine which layer projections are valid.
   valid_proj: for (ap_uint<3> i = 0; i < N_LAYER - 2; i++) {
     valid_proj[i] = true;
@@ -446,6 +542,44 @@ TC::processStubPair(
   success = TC::barrelSeeding<Seed>(innerStub, outerStub, &rinv, &phi0, &z0, &t, phiL, zL, &der_phiL, &der_zL, valid_proj, phiD, rD, &der_phiD, &der_rD, valid_proj_disk);
 
 // Write the tracklet parameters and projections to the output memories.
+  TC::writeTracklet<Seed, TPROJMaskBarrel, TPROJMaskDisk>(bx, innerIndex, outerIndex, TCID, trackletIndex, trackletParameters, projout_barrel_ps, projout_barrel_2s, projout_disk, npar, nproj_barrel_ps, nproj_barrel_2s, nproj_disk, success, rinv, phi0, z0, t, phiL, zL, der_phiL, der_zL, valid_proj, phiD, rD, der_phiD, der_rD, valid_proj_disk);
+}
+
+// Writes the tracklet parameters and projections of a stub pair to the
+// appropriate memories.
+template<TF::seed Seed, uint32_t TPROJMaskBarrel, uint32_t TPROJMaskDisk> void
+TC::writeTracklet(
+    const BXType bx,
+    const StubPair::SPInnerIndex innerIndex,
+    const StubPair::SPOuterIndex outerIndex,
+    const TrackletProjection<BARRELPS>::TProjTCID TCID,
+    TrackletProjection<BARRELPS>::TProjTrackletIndex &trackletIndex,
+    TrackletParameterMemory * const trackletParameters,
+    TrackletProjectionMemory<BARRELPS> projout_barrel_ps[N_PROJOUT_BARRELPS],
+    TrackletProjectionMemory<BARREL2S> projout_barrel_2s[N_PROJOUT_BARREL2S],
+    TrackletProjectionMemory<DISK> projout_disk[N_PROJOUT_DISK],
+    ap_uint<kNBits_MemAddr> &npar,
+    ap_uint<kNBits_MemAddr> nproj_barrel_ps[N_PROJOUT_BARRELPS],
+    ap_uint<kNBits_MemAddr> nproj_barrel_2s[N_PROJOUT_BARREL2S],
+    ap_uint<kNBits_MemAddr> nproj_disk[N_PROJOUT_DISK],
+    const bool success,
+    const TC::Types::rinv rinv,
+    const TrackletParameters::PHI0PAR phi0,
+    const TC::Types::z0 z0,
+    const TrackletParameters::TPAR t,
+    const TC::Types::phiL phiL[4],
+    const TC::Types::zL zL[4],
+    const TC::Types::der_phiL der_phiL,
+    const TC::Types::der_zL der_zL,
+    const TC::Types::flag valid_proj[4],
+    const TC::Types::phiD phiD[4],
+    const TC::Types::rD rD[4],
+    const TC::Types::der_phiD der_phiD,
+    const TC::Types::der_rD der_rD,
+    const TC::Types::flag valid_proj_disk[4]
+)
+{
+#pragma HLS inline
   const TrackletParameters tpar(innerIndex, outerIndex, rinv, phi0, z0, t);
   if (success) trackletParameters->write_mem(bx, tpar, npar++);
 
@@ -513,6 +647,80 @@ TC::processStubPair(
   if (success) trackletIndex++;
 }
 
+#ifndef __SYNTHESIS__
+// Processes nStubPairs <= N stub pairs as processStubPair does, but with the
+// tracklet parameters and projections of all of them calculated at once by
+// calculate_LXLY_batch. The results are written in the order of the stub pairs.
+template<TF::seed Seed, uint32_t TPROJMaskBarrel, uint32_t TPROJMaskDisk, int N> void
+TC::processStubPairs(
+    const BXType bx,
+    const int nStubPairs,
+    const StubPair::SPInnerIndex innerIndex[N],
+    const AllStub<InnerRegion<Seed>()> innerStub[N],
+    const StubPair::SPOuterIndex outerIndex[N],
+    const AllStub<OuterRegion<Seed>()> outerStub[N],
+    const TrackletProjection<BARRELPS>::TProjTCID TCID,
+    TrackletProjection<BARRELPS>::TProjTrackletIndex &trackletIndex,
+    TrackletParameterMemory * const trackletParameters,
+    TrackletProjectionMemory<BARRELPS> projout_barrel_ps[N_PROJOUT_BARRELPS],
+    TrackletProjectionMemory<BARREL2S> projout_barrel_2s[N_PROJOUT_BARREL2S],
+    TrackletProjectionMemory<DISK> projout_disk[N_PROJOUT_DISK],
+    ap_uint<kNBits_MemAddr> &npar,
+    ap_uint<kNBits_MemAddr> nproj_barrel_ps[N_PROJOUT_BARRELPS],
+    ap_uint<kNBits_MemAddr> nproj_barrel_2s[N_PROJOUT_BARREL2S],
+    ap_uint<kNBits_MemAddr> nproj_disk[N_PROJOUT_DISK]
+)
+{
+// The unused entries of the batch repeat the last stub pair.
+  int64_t r1[N], phi1[N], z1[N], r2[N], phi2[N], z2[N];
+  for (int i = 0; i < N; i++) {
+    const int j = (i < nStubPairs) ? i : nStubPairs - 1;
+    r1[i] = innerStub[j].getR();
+    phi1[i] = innerStub[j].getPhi();
+    z1[i] = innerStub[j].getZ();
+    r2[i] = outerStub[j].getR();
+    phi2[i] = outerStub[j].getPhi();
+    z2[i] = outerStub[j].getZ();
+  }
+
+  TC::Types::rmean r1mean, r2mean, rproj[4];
+  TC::seedingRadii<Seed>(r1mean, r2mean, rproj);
+
+  int64_t rinv[N], phi0[N], t[N], z0[N];
+  int64_t phiL[N_LAYER - 2][N], zL[N_LAYER - 2][N], der_phiL[N], der_zL[N];
+  int64_t phiD[N_DISK - 1][N], rD[N_DISK - 1][N], der_phiD[N], der_rD[N];
+
+// Calculate the tracklet parameters and projections.
+  TC::calculate_LXLY_batch<Seed, InnerRegion<Seed>(), OuterRegion<Seed>(), N>(
+      r1, phi1, z1, r2, phi2, z2,
+      r1mean, r2mean, rproj[0], rproj[1], rproj[2], rproj[3],
+      zmean[TF::D1], zmean[TF::D2], zmean[TF::D3], zmean[TF::D4],
+      rinv, phi0, t, z0,
+      phiL[0], phiL[1], phiL[2], phiL[3], zL[0], zL[1], zL[2], zL[3], der_phiL, der_zL,
+      phiD[0], phiD[1], phiD[2], phiD[3], rD[0], rD[1], rD[2], rD[3], der_phiD, der_rD
+  );
+
+// Apply the cuts and write the tracklet parameters and projections to the
+// output memories.
+  for (int i = 0; i < nStubPairs; i++) {
+    TC::Types::rinv rinv_i = rinv[i];
+    TrackletParameters::PHI0PAR phi0_i = phi0[i];
+    TC::Types::z0 z0_i = z0[i];
+    TrackletParameters::TPAR t_i = t[i];
+    TC::Types::phiL phiL_i[N_LAYER - 2] = {phiL[0][i], phiL[1][i], phiL[2][i], phiL[3][i]};
+    TC::Types::zL zL_i[N_LAYER - 2] = {zL[0][i], zL[1][i], zL[2][i], zL[3][i]};
+    TC::Types::phiD phiD_i[N_DISK - 1] = {phiD[0][i], phiD[1][i], phiD[2][i], phiD[3][i]};
+    TC::Types::rD rD_i[N_DISK - 1] = {rD[0][i], rD[1][i], rD[2][i], rD[3][i]};
+    TC::Types::flag valid_proj[N_LAYER - 2];
+    TC::Types::flag valid_proj_disk[N_DISK - 1];
+
+    const bool success = TC::barrelSelection<Seed>(rproj, &rinv_i, &phi0_i, &z0_i, &t_i, phiL_i, zL_i, valid_proj, phiD_i, rD_i, valid_proj_disk);
+
+    TC::writeTracklet<Seed, TPROJMaskBarrel, TPROJMaskDisk>(bx, innerIndex[i], outerIndex[i], TCID, trackletIndex, trackletParameters, projout_barrel_ps, projout_barrel_2s, projout_disk, npar, nproj_barrel_ps, nproj_barrel_2s, nproj_disk, success, rinv_i, phi0_i, z0_i, t_i, phiL_i, zL_i, der_phiL[i], der_zL[i], valid_proj, phiD_i, rD_i, der_phiD[i], der_rD[i], valid_proj_disk);
+  }
+}
+#endif
+
 // This is the primary interface for the TrackletCalculator.
 template<
 TF::seed Seed, // seed layer combination (TF::L1L2, TF::L3L4, etc.)
@@ -559,6 +767,42 @@ TrackletCalculator(
 
   const TrackletProjection<BARRELPS>::TProjTCID TCID = TC::ID<Seed, iTC>();
 
+#ifndef __SYNTHESIS__
+// In C simulation, the stub pairs are collected in batches of TC::kNBatch,
+// whose tracklet parameters are calculated at once, and processed in the same
+// order as by the loop below.
+  if (TC::kNBatch > 1) {
+    StubPair::SPInnerIndex innerIndex[TC::kNBatch];
+    StubPair::SPOuterIndex outerIndex[TC::kNBatch];
+    AllStub<InnerRegion<Seed>()> innerStub[TC::kNBatch];
+    AllStub<OuterRegion<Seed>()> outerStub[TC::kNBatch];
+    int nStubPairs = 0;
+
+    for (TC::Types::nSP i = 0; i < kMaxProc - kMaxProcOffset(module::TC); i++) {
+      TC::Types::nSPMem iSPMem;
+      TC::Types::nSP iSP = i;
+      bool done;
+      TC::getIndices<NSPMem>(bx, stubPairs, iSPMem, iSP, done);
+      if (done) break;
+
+      innerIndex[nStubPairs] = stubPairs[iSPMem].read_mem(bx, iSP).getInnerIndex();
+      outerIndex[nStubPairs] = stubPairs[iSPMem].read_mem(bx, iSP).getOuterIndex();
+      innerStub[nStubPairs] = innerStubs[(ASInnerMask<Seed, iTC>() & (1 << iSPMem)) >> iSPMem].read_mem(bx, innerIndex[nStubPairs]);
+      outerStub[nStubPairs] = outerStubs[(ASOuterMask<Seed, iTC>() & (1 << iSPMem)) >> iSPMem].read_mem(bx, outerIndex[nStubPairs]);
+
+      if (++nStubPairs == TC::kNBatch) {
+        TC::processStubPairs<Seed, TPROJMaskBarrel<Seed, iTC>(), TPROJMaskDisk<Seed, iTC>(), TC::kNBatch>(bx, nStubPairs, innerIndex, innerStub, outerIndex, outerStub, TCID, trackletIndex, trackletParameters, projout_barrel_ps, projout_barrel_2s, projout_disk, npar, nproj_barrel_ps, nproj_barrel_2s, nproj_disk);
+        nStubPairs = 0;
+      }
+    }
+    if (nStubPairs > 0)
+      TC::processStubPairs<Seed, TPROJMaskBarrel<Seed, iTC>(), TPROJMaskDisk<Seed, iTC>(), TC::kNBatch>(bx, nStubPairs, innerIndex, innerStub, outerIndex, outerStub, TCID, trackletIndex, trackletParameters, projout_barrel_ps, projout_barrel_2s, projout_disk, npar, nproj_barrel_ps, nproj_barrel_2s, nproj_disk);
+
+    bx_o = bx;
+    return;
+  }
+#endif
+
 // Loop over all stub pairs.
   stub_pairs: for (TC::Types::nSP i = 0; i < kMaxProc - kMaxProcOffset(module::TC); i++) {
 #pragma HLS pipeline II=1 rewind
@@ -5,6 +5,10 @@
 #include "VMStubTEOuterMemory.h"
 #include "StubPairMemory.h"
 
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
 #include "hls_math.h"
 #include <string>
 
@@ -101,6 +105,10 @@ void TrackletEngine(
   ap_uint<kNBits_MemAddrBinned> istubouter = 0;
 #pragma HLS dependence variable=istubouter intra WAR true
 
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("TrackletEngine::main", kMaxProc - kMaxProcOffset(module::TE));
+#endif
+
   //
   // main loop
   //
@@ -120,6 +128,11 @@ void TrackletEngine(
 	  // buffer is not empty when current write index and read index are different
 	  const ap_uint<1> buffernotempty = (writeindex!=readindex);
 
+#ifndef __SYNTHESIS__
+	  loopStats.useful += buffernotempty;
+	  loopStats.stalled += (morestubinner && !buffernotfull);
+#endif
+
 	  // buffer is not full and there are more inner stubs to read in...
 	  if(morestubinner && buffernotfull) {
 		  auto const innerstubdatatmp  = instubinnerdata.read_mem(bx,istubinner);
@@ -222,6 +235,13 @@ void TrackletEngine(
       	 }
   }
 
+#ifndef __SYNTHESIS__
+  // inner stubs not read, and z-bins of inner stubs left in the buffer
+  const ap_uint<kNBits_BufferAddr> nbuffered = writeindex-readindex;
+  loopStats.leftover = (nstubinner-istubinner) + nbuffered;
+  loopStats.record();
+#endif
+
   bx_o = bx;
 }
 
@@ -3,6 +3,7 @@
 
 #include "Constants.h"
 #include "VMStubTEOuterMemoryCM.h"
+#include "LUTRegistry.h"
 
 template<int VMSTEType>
 class TrackletEngineUnit {
@@ -13,7 +14,8 @@ class TrackletEngineUnit {
     kNBitsRZBin=3,
     kNBitsRZFine=3,
     kNBitsPhiBins=3,
-    kNBitsPTLut=256
+    kNBitsPTLut=256,
+    kMaxCandidates=2*(1<<kNBitsPhiBins)*15 //Outer stubs in the bins of two RZbins
   };
 
   typedef ap_uint<VMStubTEOuter<VMSTEType>::kVMSTEOIDSize+kNBits_MemAddr+AllStub<BARRELPS>::kAllStubSize> STUBID;
@@ -25,6 +27,7 @@ class TrackletEngineUnit {
   typedef ap_uint<kNBitsPhiBins+1> MEMINDEX;  //Index into MEMMASK and MEMSTUBS
   typedef ap_uint<2*(1<<kNBitsPhiBins)> MEMMASK;  //Bit mask for used bins for two RZbins
   typedef ap_uint<2*(1<<kNBitsPhiBins)*4> MEMSTUBS; //Number of stubs in bins for two RZbins //FIXME for 4
+  typedef ap_uint<8> NCANDIDATES; //Number of outer stubs in the bins of a MEMMASK
 
 
  TrackletEngineUnit() {
@@ -35,11 +38,16 @@ class TrackletEngineUnit {
 
     idle_ = true;
 
+#ifdef LUT_RUNTIME
+    static const ap_uint<1>* stubptinnertmp = LUTRegistry::get<ap_uint<1> >("TP/tables/TP_L1L2D_stubptinnercut.tab", kNBitsPTLut);
+    static const ap_uint<1>* stubptoutertmp = LUTRegistry::get<ap_uint<1> >("TP/tables/TP_L1L2D_stubptoutercut.tab", kNBitsPTLut);
+#else
     ap_uint<1> stubptinnertmp[kNBitsPTLut] =
 #include "../emData/TP/tables/TP_L1L2D_stubptinnercut.tab"
     
     ap_uint<1> stubptoutertmp[kNBitsPTLut] =
 #include "../emData/TP/tables/TP_L1L2D_stubptoutercut.tab"
+#endif
 
  for(unsigned int i=0;i<kNBitsPTLut;i++) {
    stubptinnerlutnew_[i] = stubptinnertmp[i];
@@ -82,6 +90,18 @@ class TrackletEngineUnit {
      mask.test(14) ? n[14] : n[15];
  }
 
+ // Number of outer stubs an inner stub is tried with, i.e. the stubs in the
+ // bins of its mask
+ static NCANDIDATES calcNCandidates(MEMSTUBS nstubs, MEMMASK mask) {
+#pragma HLS inline
+   NCANDIDATES n = 0;
+ sumcandidates: for (unsigned int i = 0; i < 2*(1<<kNBitsPhiBins); i++) {
+#pragma HLS unroll
+     n += mask.test(i) ? NCANDIDATES(nstubs.range(4*i+3,4*i)) : NCANDIDATES(0);
+   }
+   return n;
+ }
+
  void reset(int instance) {
    writeindex_ = 0;
    readindex_ = 0;
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_TrackletParameterMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // Data object definition
@@ -44,11 +45,11 @@ public:
 	
   // Constructors
   TrackletParameters(const TrackletParameterData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<kTrackletParameterSize>(newdata))
   {}
 
   TrackletParameters(const STUBINDEX id1, const STUBINDEX id2, const RINVPAR rinv, const PHI0PAR phi0, const Z0PAR z0, const TPAR t):
-    data_( (((((id1,id2),rinv),phi0),z0),t) )
+    data_(toMemoryWord<kTrackletParameterSize>((((((id1,id2),rinv),phi0),z0),t)))
   {}
   
   TrackletParameters():
@@ -59,67 +60,67 @@ public:
   TrackletParameters(const char* datastr, int base=16)
   {
     TrackletParameterData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<kTrackletParameterSize>(newdata);
   }
   #endif
   
   // Getter
   static constexpr int getWidth() {return kTrackletParameterSize;}
 
-  TrackletParameterData raw() const {return data_;}
+  TrackletParameterData raw() const {return fromMemoryWord<kTrackletParameterSize>(data_);}
 
   STUBINDEX getStubIndexOuter() const {
-    return data_.range(kTParStubIndexOuterMSB,kTParStubIndexOuterLSB);
+    return getBits<kTParStubIndexOuterMSB,kTParStubIndexOuterLSB>(data_);
   }
 
   STUBINDEX getStubIndexInner() const {
-    return data_.range(kTParStubIndexInnerMSB,kTParStubIndexInnerLSB);
+    return getBits<kTParStubIndexInnerMSB,kTParStubIndexInnerLSB>(data_);
   }
 
   TPAR getT() const {
-    return data_.range(kTParTMSB,kTParTLSB);
+    return getBits<kTParTMSB,kTParTLSB>(data_);
   }
 
   Z0PAR getZ0() const {
-    return data_.range(kTParZ0MSB,kTParZ0LSB);
+    return getBits<kTParZ0MSB,kTParZ0LSB>(data_);
   }
 
   PHI0PAR getPhi0() const {
-    return data_.range(kTParPhi0MSB,kTParPhi0LSB);
+    return getBits<kTParPhi0MSB,kTParPhi0LSB>(data_);
   }
 
   RINVPAR getRinv() const {
-    return data_.range(kTParRinvMSB,kTParRinvLSB);
+    return getBits<kTParRinvMSB,kTParRinvLSB>(data_);
   }
   
   // Setter
   void setStubIndexInner(const STUBINDEX id) {
-    data_.range(kTParStubIndexInnerMSB,kTParStubIndexInnerLSB) = id;
+    setBits<kTParStubIndexInnerMSB,kTParStubIndexInnerLSB>(data_, id);
   }
 
   void setStubIndexOuter(const STUBINDEX id) {
-    data_.range(kTParStubIndexOuterMSB,kTParStubIndexOuterLSB) = id;
+    setBits<kTParStubIndexOuterMSB,kTParStubIndexOuterLSB>(data_, id);
   }
   
   void setT(const TPAR t) {
-    data_.range(kTParTMSB,kTParTLSB) = t;
+    setBits<kTParTMSB,kTParTLSB>(data_, t);
   }
   
   void setZ0(const Z0PAR z0) {
-    data_.range(kTParZ0MSB,kTParZ0LSB) = z0;
+    setBits<kTParZ0MSB,kTParZ0LSB>(data_, z0);
   }
 
   void setPhi0(const PHI0PAR phi0) {
-    data_.range(kTParPhi0MSB,kTParPhi0LSB) = phi0;
+    setBits<kTParPhi0MSB,kTParPhi0LSB>(data_, phi0);
   }
   
   void setRinv(const RINVPAR rinv) {
-    data_.range(kTParRinvMSB,kTParRinvLSB) = rinv;
+    setBits<kTParRinvMSB,kTParRinvLSB>(data_, rinv);
   }
   
 private:
   
-  TrackletParameterData data_;
+  MemoryWord<kTrackletParameterSize>::type data_;
   
 };
 
@@ -46,7 +46,7 @@ void TrackletProcessor_L1L2D(
     const ap_uint<8> regionlut[2048],
     const AllStubInnerMemory<BARRELPS> innerStubs[2],
     const AllStubMemory<BARRELPS>* outerStubs,
-    const VMStubTEOuterMemoryCM<BARRELPS, kNbitsrzbin, kNbitsphibin, kNTEUnits> outerVMStubs,
+    const VMStubTEOuterMemoryCM<BARRELPS, kNbitsrzbin, kNbitsphibin, kNTEUnitsL1L2D> outerVMStubs,
     TrackletParameterMemory * trackletParameters,
     TrackletProjectionMemory<BARRELPS> projout_barrel_ps[TC::N_PROJOUT_BARRELPS],
     TrackletProjectionMemory<BARREL2S> projout_barrel_2s[TC::N_PROJOUT_BARREL2S],
@@ -63,16 +63,20 @@ void TrackletProcessor_L1L2D(
 #pragma HLS array_partition variable=projout_barrel_2s complete
 #pragma HLS array_partition variable=projout_disk complete
 
+  TrackletProcessorContext<kNTEUnitsL1L2D> context;
+#pragma HLS array_partition variable=context.teunits complete dim=1
+
  TP_L1L2D: TrackletProcessor<TF::L1L2, 
 			     TC::D, 
-			     kNTEUnits,
+			     kNTEUnitsL1L2D,
 			     BARRELPS, 
 			     BARRELPS,
 			     1, //Outer phi region
 			     kNbitsrzbin,
 			     kNbitsphibin,
 			     2, //Number of inner AS memories
-			     108>(bx, 
+			     108,
+			     kTELongListL1L2D>(bx, 
 				  lut, 
 				  regionlut, 
 				  innerStubs, 
@@ -81,7 +85,8 @@ void TrackletProcessor_L1L2D(
 				  trackletParameters,
 				  projout_barrel_ps,
 				  projout_barrel_2s,
-				  projout_disk
+				  projout_disk,
+				  context
 				  );
 
 }
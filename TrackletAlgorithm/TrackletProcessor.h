@@ -10,6 +10,9 @@
 #include "VMStubTEOuterMemoryCM.h"
 #include "TEBuffer.h"
 #include "TrackletEngineUnit.h"
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
 
 
 namespace TC {
@@ -172,12 +175,26 @@ template<TF::seed Seed, TC::itc iTC> constexpr uint32_t TPROJMaskDisk();
 ap_uint<1> nearFullTEBuff(const ap_uint<3>&, const ap_uint<3>&);
 ap_uint<(1<<(2*TrackletEngineUnit<BARRELPS>::kNBitsBuffer))> nearFullTEUnitInit();
 
+// Number of bits of the index of a TE unit
+constexpr int nTEUnitBits(int nTEUnits) {
+  return (nTEUnits <= 2) ? 1 : 1 + nTEUnitBits((nTEUnits + 1) / 2);
+}
+
+// TE units of TP_L1L2D, i.e. copies of its VMStubTEOuter memory, and the
+// number of outer-stub candidates above which an inner stub is dispatched to
+// the last idle TE unit. With kMaxCandidates, every stub goes to the first idle
+// unit, so that the tracklets come out in the order of the emulation, which
+// TP_L1L2D checks entry by entry; the TP_L1L2D_dispatch test bench runs other
+// numbers of units and long-list dispatch.
+constexpr uint8_t kNTEUnitsL1L2D = kNTEUnits;
+constexpr uint8_t kTELongListL1L2D = TrackletEngineUnit<BARRELPS>::kMaxCandidates;
+
 void TrackletProcessor_L1L2D(const BXType bx,
 			     const ap_uint<1+2*TrackletEngineUnit<BARRELPS>::kNBitsRZFine+TrackletEngineUnit<BARRELPS>::kNBitsRZBin> lut[1<<(kNbitszfinebintable+kNbitsrfinebintable)],
 			     const ap_uint<(1<<TrackletEngineUnit<BARRELPS>::kNBitsPhiBins)> regionlut[1<<(AllStubInner<BARRELPS>::kASBendSize+AllStubInner<BARRELPS>::kASFinePhiSize)],
 			     const AllStubInnerMemory<BARRELPS> innerStubs[2],
 			     const AllStubMemory<BARRELPS>* outerStubs,
-			     const VMStubTEOuterMemoryCM<BARRELPS, kNbitsrzbin, kNbitsphibin, kNTEUnits> outerVMStubs,
+			     const VMStubTEOuterMemoryCM<BARRELPS, kNbitsrzbin, kNbitsphibin, kNTEUnitsL1L2D> outerVMStubs,
 			     TrackletParameterMemory * trackletParameters,
 			     TrackletProjectionMemory<BARRELPS> projout_barrel_ps[TC::N_PROJOUT_BARRELPS],
 			     TrackletProjectionMemory<BARREL2S> projout_barrel_2s[TC::N_PROJOUT_BARREL2S],
@@ -187,6 +204,7 @@ void TrackletProcessor_L1L2D(const BXType bx,
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TrackletCalculator_calculate_LXLY.h"
+#include "TrackletCalculator_calculate_LXLY_native.h"
 #include "TrackletProcessor_parameters.h"
 
 // This function calls calculate_LXLY, defined in
@@ -222,7 +240,13 @@ TC::barrelSeeding(const AllStub<InnerRegion> &innerStub, const AllStub<OuterRegi
       break;
   }
   TC::Types::zmean zproj[4] = {zmean[TF::D1], zmean[TF::D2], zmean[TF::D3], zmean[TF::D4]};
+  // A C simulation compiled with -DCSIM_NATIVE_CALCULATE_LXLY (set by the CMake
+  // build) uses the bit-identical native version
+#if defined(__SYNTHESIS__) || !defined(CSIM_NATIVE_CALCULATE_LXLY)
   calculate_LXLY<Seed, InnerRegion, OuterRegion>(
+#else
+  calculate_LXLY_native<Seed, InnerRegion, OuterRegion>(
+#endif
       innerStub.getR(),
       innerStub.getPhi(),
       innerStub.getZ(),
@@ -493,6 +517,17 @@ TC::processStubPair(
 
 
 
+// State of a TrackletProcessor: the TE buffer and the TE units. Both are reset
+// at the start of each event, but the context is owned by the caller rather
+// than kept in function statics, so that several TrackletProcessors (e.g. one
+// per event or sector and thread) can run concurrently in C simulation. The
+// caller partitions teunits, see TrackletProcessor.cc.
+template<uint8_t NTEUnits>
+struct TrackletProcessorContext {
+  TEBuffer tebuffer;
+  TrackletEngineUnit<BARRELPS> teunits[NTEUnits];
+};
+
 // This is the primary interface for the TrackletProcessor.
 template<
 TF::seed Seed, // seed layer combination (TC::L1L2, TC::L3L4, etc.)
@@ -506,7 +541,9 @@ TF::seed Seed, // seed layer combination (TC::L1L2, TC::L3L4, etc.)
   uint8_t RZBins,         // number of RZ bins in outer layer/disk
   uint8_t PhiBins,        // number of Phi bins in outer layer/dsik
   uint8_t NASMemInner, // number of inner all-stub memories
-  uint16_t N // maximum number of steps
+  uint16_t N, // maximum number of steps
+  uint8_t LongList = TrackletEngineUnit<BARRELPS>::kMaxCandidates // inner stubs with more outer-stub
+                    // candidates go to the last idle TE unit, the others to the first idle one
 > void
 TrackletProcessor(
     const BXType bx,
@@ -514,15 +551,17 @@ TrackletProcessor(
     const ap_uint<(1<<TrackletEngineUnit<BARRELPS>::kNBitsPhiBins)> regionlut[1<<(AllStubInner<BARRELPS>::kASBendSize+AllStubInner<BARRELPS>::kASFinePhiSize)],
     const AllStubInnerMemory<InnerRegion> innerStubs[NASMemInner],
     const AllStubMemory<OuterRegion>* outerStubs,
-    const VMStubTEOuterMemoryCM<OuterRegion,RZBins,PhiBins,kNTEUnits>& outerVMStubs,
+    const VMStubTEOuterMemoryCM<OuterRegion,RZBins,PhiBins,NTEUnits>& outerVMStubs,
     TrackletParameterMemory * const trackletParameters,
     TrackletProjectionMemory<BARRELPS> projout_barrel_ps[TC::N_PROJOUT_BARRELPS],
     TrackletProjectionMemory<BARREL2S> projout_barrel_2s[TC::N_PROJOUT_BARREL2S],
-    TrackletProjectionMemory<DISK> projout_disk[TC::N_PROJOUT_DISK]
+    TrackletProjectionMemory<DISK> projout_disk[TC::N_PROJOUT_DISK],
+    TrackletProcessorContext<NTEUnits>& context
 )
 {
 
   static_assert(Seed == TF::L1L2, "Only L1L2 seeds have been implemented so far.");
+  static_assert(NTEUnits >= 1 && NTEUnits <= 16, "The TE units are found with 32-bit clz/ctz");
 
   int npar = 0;
   int nproj_barrel_ps[TC::N_PROJOUT_BARRELPS] = {0};
@@ -537,7 +576,7 @@ TrackletProcessor(
   constexpr unsigned int NBitsPhiRegion=2;
   constexpr unsigned int NfinephiBits=NBitsPhiRegion+TrackletEngineUnit<BARRELPS>::kNBitsPhiBins+VMStubTEOuterBase<BARRELPS>::kVMSTEOFinePhiSize;
 
-  static TEBuffer tebuffer;
+  TEBuffer& tebuffer = context.tebuffer;
   static_assert(NASMemInner <= 2, "Only handling up to two inner AS memories");
   tebuffer.setMemBegin(0);
   tebuffer.setMemEnd(NASMemInner);
@@ -545,8 +584,7 @@ TrackletProcessor(
 
   tebuffer.reset();
 
-  TrackletEngineUnit<BARRELPS> teunits[NTEUnits];
-#pragma HLS array_partition variable=teunits complete dim=1
+  TrackletEngineUnit<BARRELPS> (&teunits)[NTEUnits] = context.teunits;
 
  reset_teunits: for (unsigned i = 0; i < NTEUnits; i++) {
 #pragma HLS unroll
@@ -583,6 +621,15 @@ TrackletProcessor(
   vmstubsmask[NRZBINS-1]=(ap_uint<8>(0),outerVMStubs.getBinMask8(bx,NRZBINS-1));
 
 
+#ifndef __SYNTHESIS__
+  LoopStatistics loopStats("TrackletProcessor::istep_loop", N);
+  // Busy (not idle) and stalled (on a nearly full stub-pair buffer) cycles of each TE unit
+  std::vector<std::string> teunitNames;
+  std::vector<LoopStatistics> teunitStats;
+  for (unsigned int k = 0; k < NTEUnits; k++) teunitNames.push_back("TrackletProcessor::teunit" + std::to_string(k));
+  for (unsigned int k = 0; k < NTEUnits; k++) teunitStats.emplace_back(teunitNames[k].c_str(), N);
+#endif
+
  istep_loop: for(unsigned istep=0;istep<N;istep++) {
 #pragma HLS pipeline II=1
 
@@ -616,7 +663,7 @@ TrackletProcessor(
 
     ap_uint<NTEUnits> teunearfull, teunotempty, teuidle;
 
-    constexpr int NTEUBits=3; //ceil(log2(NTEUnits));
+    constexpr int NTEUBits=nTEUnitBits(NTEUnits);
 
   prefetchteudata: for (unsigned k = 0; k < NTEUnits; k++){
 #pragma HLS unroll
@@ -627,9 +674,19 @@ TrackletProcessor(
       teuidle[k]=teunits[k].idle_;
     }
 
-    ap_uint<NTEUBits> iTEfirstidle = __builtin_ctz(teuidle);
-    ap_uint<NTEUBits> iTE = (((1<<NTEUBits)-1)&__builtin_clz(teunotempty));
+    //clz and ctz of 0 are undefined: with no idle unit (or no unit with
+    //data) the index is not used, so it is computed with an extra bit set
+    ap_uint<NTEUBits> iTEfirstidle = __builtin_ctz(ap_uint<NTEUnits+1>((ap_uint<1>(1), teuidle)));
+    ap_uint<NTEUBits> iTElastidle = (((1<<NTEUBits)-1)&__builtin_clz(teuidle|1));
+    iTElastidle=~iTElastidle;
+    ap_uint<NTEUBits> iTE = (((1<<NTEUBits)-1)&__builtin_clz(teunotempty|1));
     iTE=~iTE;
+
+    //The TC reads the stub pairs of the highest unit with data, so a stub
+    //with many candidates goes to the last idle unit: its stub pairs are read
+    //before those of the units below it, and are read as they come once the
+    //units above it are empty, instead of filling the buffer of the unit
+    ap_uint<NTEUBits> iTEinit = TEData(tebuffer.buffer_[readptr]).getLongList()?iTElastidle:iTEfirstidle;
     ap_uint<1> HaveTEData = teunotempty.or_reduce();    
     ap_uint<1> idlete = teuidle.or_reduce();
     tebuffer.readptr_ = (idlete&&TEBufferData)?readptrnext:readptr;
@@ -667,7 +724,7 @@ TrackletProcessor(
     //initialized if there is data in TE Buffer from above
   step_teunits: for (unsigned int k = 0 ; k < NTEUnits; k++){
 #pragma HLS unroll
-      ap_uint<1> init=teuidle[k]&&TEBufferData&&(k==iTEfirstidle);
+      ap_uint<1> init=teuidle[k]&&TEBufferData&&(k==iTEinit);
       //second step
 
       TrackletEngineUnit<BARRELPS>::INDEX writeindexnext=teuwriteindex[k]+1;
@@ -822,8 +879,12 @@ TrackletProcessor(
     //goodstub means that we had a valid inner stub
     ap_uint<1> addtedata=valid&&havestubs&&goodstub___;
     
+    //Stubs with more candidates than LongList are dispatched to the last idle TE unit
+    ap_uint<1> longlist = (LongList < TrackletEngineUnit<BARRELPS>::kMaxCandidates) &&
+      (TrackletEngineUnit<BARRELPS>::calcNCandidates(vmstubsentries[start], stubmask) > LongList);
+
     //Create TEData and save in buffer - but only increment point if data good
-    TEData tedatatmp(stubmask, rzfinebinfirst,start, rzdiffmax,stub___.raw());
+    TEData tedatatmp(stubmask, rzfinebinfirst,start, rzdiffmax,stub___.raw(),longlist);
     tebuffer.buffer_[tebuffer.writeptr_] = tedatatmp.raw();
     tebuffer.writeptr_ = addtedata?writeptrnext:tebuffer.writeptr_;
     
@@ -885,8 +946,29 @@ TrackletProcessor(
     
     //Read stub from memory - BRAM with latency of one or two clks
     stub__ = innerStubs[imem].read_mem(bx,istub__);
+
+#ifndef __SYNTHESIS__
+    loopStats.useful += HaveTEData;
+    loopStats.stalled += (validmem && validstub && tebufferfull);
+    for (unsigned int k = 0; k < NTEUnits; k++) {
+      teunitStats[k].useful += !teuidle[k];
+      teunitStats[k].stalled += (!teuidle[k] && teunearfull[k]);
+    }
+#endif
     
   } //end of istep
+
+#ifndef __SYNTHESIS__
+  //Inner stubs not read, and TE buffer entries not sent to the TE units
+  for (unsigned int imem = tebuffer.getMem(); imem < NASMemInner; imem++) {
+    loopStats.leftover += innerStubs[imem].getEntries(bx);
+    if (imem == tebuffer.getMem()) loopStats.leftover -= tebuffer.getIStub();
+  }
+  const TEBuffer::TEBUFFERINDEX nbuffered = tebuffer.writeptr_ - tebuffer.readptr_;
+  loopStats.leftover += nbuffered;
+  loopStats.record();
+  for (const auto& stats : teunitStats) stats.record();
+#endif
   
 }
 
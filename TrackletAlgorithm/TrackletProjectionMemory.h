@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_TrackletProjectionMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // TrackletProjectionBase is where we define the bit widths, which depend on
@@ -106,11 +107,11 @@ public:
 
   // Constructors
   TrackletProjection(const TrackletProjectionData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<TrackletProjectionBase<TProjType>::kTrackletProjectionSize>(newdata))
   {}
 
   TrackletProjection(const TProjTCID tcid, const TProjTrackletIndex trackletIndex, const TProjPHI phi, const TProjRZ z, const TProjPHIDER phider, const TProjRZDER zder):
-    data_( (((((tcid,trackletIndex),phi),z),phider),zder) )
+    data_(toMemoryWord<TrackletProjectionBase<TProjType>::kTrackletProjectionSize>((((((tcid,trackletIndex),phi),z),phider),zder)))
   {}
   
   TrackletProjection():
@@ -121,14 +122,14 @@ public:
   TrackletProjection(const char* datastr, int base=16)
   {
     TrackletProjectionData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<TrackletProjectionBase<TProjType>::kTrackletProjectionSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return TrackletProjectionBase<TProjType>::kTrackletProjectionSize;}
 
-  TrackletProjectionData raw() const {return data_;}
+  TrackletProjectionData raw() const {return fromMemoryWord<TrackletProjectionBase<TProjType>::kTrackletProjectionSize>(data_);}
 
   // TCID is a unique identifier assigned to each TC. It is a concatenation of
   // the seed and iTC numbers:
@@ -150,15 +151,15 @@ public:
   //   C -> 2
   //   ...
   TProjTCID getTCID() const {
-    return data_.range(kTProjTCIDMSB,kTProjTCIDLSB);
+    return getBits<kTProjTCIDMSB,kTProjTCIDLSB>(data_);
   }
 
   TProjSeed getSeed() const {
-    return data_.range(kTProjSeedMSB,kTProjSeedLSB);
+    return getBits<kTProjSeedMSB,kTProjSeedLSB>(data_);
   }
 
   TProjITC getITC() const {
-    return data_.range(kTProjITCMSB,kTProjITCLSB);
+    return getBits<kTProjITCMSB,kTProjITCLSB>(data_);
   }
 
   // The tracklets in an event are indexed starting from zero, and the indices
@@ -166,56 +167,56 @@ public:
   // TC has tracklet index zero, the second tracklet written by any given TC
   // has tracklet index one, etc.
   TProjTrackletIndex getTrackletIndex() const {
-    return data_.range(kTProjTrackletIndexMSB,kTProjTrackletIndexLSB);
+    return getBits<kTProjTrackletIndexMSB,kTProjTrackletIndexLSB>(data_);
   }
 
   TProjPHI getPhi() const {
-    return data_.range(kTProjPhiMSB,kTProjPhiLSB);
+    return getBits<kTProjPhiMSB,kTProjPhiLSB>(data_);
   }
 
   TProjRZ getRZ() const {
-    return data_.range(kTProjRZMSB,kTProjRZLSB);
+    return getBits<kTProjRZMSB,kTProjRZLSB>(data_);
   }
 
   // The phi derivative is d(phi)/d(r) at the given layer/disk
   TProjPHIDER getPhiDer() {
-    return data_.range(kTProjPhiDMSB,kTProjPhiDLSB);
+    return getBits<kTProjPhiDMSB,kTProjPhiDLSB>(data_);
   }
 
   // The r/z derivative is d(z)/d(r) at the given layer and d(r)/d(z) at the
   // given disk
   TProjRZDER getRZDer() {
-    return data_.range(kTProjRZDMSB,kTProjRZDLSB);
+    return getBits<kTProjRZDMSB,kTProjRZDLSB>(data_);
   }
 
  // Setter
   void setTCID(const TProjTCID id) {
-    data_.range(kTProjTCIDMSB,kTProjTCIDLSB) = id;
+    setBits<kTProjTCIDMSB,kTProjTCIDLSB>(data_, id);
   }
 
   void setTrackletIndex(const TProjTrackletIndex id) {
-    data_.range(kTProjTrackletIndexMSB,kTProjTrackletIndexLSB) = id;
+    setBits<kTProjTrackletIndexMSB,kTProjTrackletIndexLSB>(data_, id);
   }
 
   void setPhi(const TProjPHI phi) {
-    data_.range(kTProjPhiMSB,kTProjPhiLSB) = phi;
+    setBits<kTProjPhiMSB,kTProjPhiLSB>(data_, phi);
   }
 
   void setRZ(const TProjRZ z) {
-    data_.range(kTProjRZMSB,kTProjRZLSB) = z;
+    setBits<kTProjRZMSB,kTProjRZLSB>(data_, z);
   }
 
   void setPhiDer(const TProjPHIDER phider) {
-    data_.range(kTProjPhiDMSB,kTProjPhiDLSB) = phider;
+    setBits<kTProjPhiDMSB,kTProjPhiDLSB>(data_, phider);
   }
 
   void setRZDer(const TProjRZDER zder) {
-    data_.range(kTProjRZDMSB,kTProjRZDLSB) = zder;
+    setBits<kTProjRZDMSB,kTProjRZDLSB>(data_, zder);
   }
   
 private:
   
-  TrackletProjectionData data_;
+  typename MemoryWord<TrackletProjectionBase<TProjType>::kTrackletProjectionSize>::type data_;
 
 };
 
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_VMProjectionMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // VMProjectionBase is where we define the bit widths, which depend on the class template parameter.
@@ -74,19 +75,19 @@ public:
 
   // Constructors
   VMProjection(const VMProjData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>(newdata))
   {}
 
   // This constructor is only used for projections in BARREL
   VMProjection(const VMPID id, const VMPZBIN zbin, const VMPFINEZ finez, const VMPFINEPHI finephi, const VMPRINV rinv, const bool ps):
-    data_( (id, zbin, finez, finephi, rinv, ps) )
+    data_(toMemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>((id, zbin, finez, finephi, rinv, ps)))
   {
     static_assert(VMProjType == BARREL, "Constructor should only be used for BARREL projections");
   }
 
   // This constructor is only used for projections in DISK
   VMProjection(const VMPID id, const VMPZBIN zbin, const VMPFINEZ finez, const VMPFINEPHI finephi, const VMPRINV rinv):
-    data_( (id, zbin ,finez , finephi, rinv) )
+    data_(toMemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>((id, zbin ,finez , finephi, rinv)))
   {
     static_assert(VMProjType == DISK, "Constructor should only be used for DISK projections");
   }
@@ -99,71 +100,71 @@ public:
   VMProjection(const char* datastr, int base=16)
   {
     VMProjData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>(newdata);
   }
   #endif
   
   // Getter
   static constexpr int getWidth() {return VMProjectionBase<VMProjType>::kVMProjectionSize;}
 
-  VMProjData raw() const {return data_;}
+  VMProjData raw() const {return fromMemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>(data_);}
   
   VMPID getIndex() const {
-    return data_.range(kVMProjIndexMSB,kVMProjIndexLSB);
+    return getBits<kVMProjIndexMSB,kVMProjIndexLSB>(data_);
   }
 
   VMPZBIN getZBin() const {
-    return data_.range(kVMProjZBinMSB,kVMProjZBinLSB);
+    return getBits<kVMProjZBinMSB,kVMProjZBinLSB>(data_);
   }
 
   VMPFINEZ getFineZ() const {
-    return data_.range(kVMProjFineZMSB,kVMProjFineZLSB);
+    return getBits<kVMProjFineZMSB,kVMProjFineZLSB>(data_);
   }
 
   VMPFINEPHI getFinePhi() const {
-    return data_.range(kVMProjFinePhiMSB,kVMProjFinePhiLSB);
+    return getBits<kVMProjFinePhiMSB,kVMProjFinePhiLSB>(data_);
   }
   
   VMPRINV getRInv() const {
-    return data_.range(kVMProjRinvMSB,kVMProjRinvLSB);
+    return getBits<kVMProjRinvMSB,kVMProjRinvLSB>(data_);
   }
 
   // This getter is only used for projections in BARREL
   bool getIsPSSeed() const {
     static_assert("VMProjType == BARREL", "Getter should only be used for BARREL projections");
-    return data_.range(kVMProjIsPSSeedLSB,kVMProjIsPSSeedMSB);
+    return getBits<kVMProjIsPSSeedLSB,kVMProjIsPSSeedMSB>(data_);
   }
   
   // Setter
   void setIndex(const VMPID id) {
-    data_.range(kVMProjIndexMSB,kVMProjIndexLSB) = id;
+    setBits<kVMProjIndexMSB,kVMProjIndexLSB>(data_, id);
   }
   
   void setZBin(const VMPZBIN zbin) {
-    data_.range(kVMProjZBinMSB,kVMProjZBinLSB) = zbin;
+    setBits<kVMProjZBinMSB,kVMProjZBinLSB>(data_, zbin);
   }
   
   void setFineZ(const VMPFINEZ finez) {
-    data_.range(kVMProjFineZMSB,kVMProjFineZLSB) = finez;
+    setBits<kVMProjFineZMSB,kVMProjFineZLSB>(data_, finez);
   }
 
   void setFinePhi(const VMPFINEPHI finephi) {
-    data_.range(kVMProjFinePhiMSB,kVMProjFinePhiLSB) = finephi;
+    setBits<kVMProjFinePhiMSB,kVMProjFinePhiLSB>(data_, finephi);
   }
   
   void setRInv(const VMPRINV rinv) {
-    data_.range(kVMProjRinvMSB,kVMProjRinvLSB) = rinv;
+    setBits<kVMProjRinvMSB,kVMProjRinvLSB>(data_, rinv);
   }
   
   // This setter is only used for projections in BARREL
   void setIsPSSeed(const bool psseed) {
     static_assert("VMProjType == BARREL", "Setter should only be used for BARREL projections");
-    data_.range(kVMProjIsPSSeedLSB,kVMProjIsPSSeedMSB) = psseed;
+    setBits<kVMProjIsPSSeedLSB,kVMProjIsPSSeedMSB>(data_, psseed);
   }
   
 private:
   
-  VMProjData data_;
+  typename MemoryWord<VMProjectionBase<VMProjType>::kVMProjectionSize>::type data_;
   
 };
 
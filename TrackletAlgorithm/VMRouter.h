@@ -26,6 +26,10 @@
 #include "VMStubTEInnerMemory.h"
 #include "VMStubTEOuterMemory.h"
 
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
 
 /////////////////////////////////////////
 // Constants
@@ -606,10 +610,11 @@ void VMRouter(const BXType bx, BXType& bx_o, const int fineBinTable[], const int
 
 	// The first memory numbers, the position of the first non-zero bit in the mask
 	// Do not change these to ap_uint as cosim will fail
-	static const int firstME = firstMemNumber(maskME); // ME memory
-	static const int firstTEI = firstMemNumber(maskTEI); // TE Inner memory
-	static const int firstOL = firstMemNumber(maskOL); // TE Overlap memory
-	static const int firstTEO = firstMemNumber(maskTEO); // TE Inner memory
+	// Not static: VMRouters of different phi regions share this function
+	const int firstME = firstMemNumber(maskME); // ME memory
+	const int firstTEI = firstMemNumber(maskTEI); // TE Inner memory
+	const int firstOL = firstMemNumber(maskOL); // TE Overlap memory
+	const int firstTEO = firstMemNumber(maskTEO); // TE Inner memory
 
 	// Number of memories/VMs for one coarse phi region
 	constexpr int nvmME = (Layer) ? nvmmelayers[Layer-1] : nvmmedisks[Disk-1]; // ME memories
@@ -662,6 +667,10 @@ void VMRouter(const BXType bx, BXType& bx_o, const int fineBinTable[], const int
 	// Main Loop
 	constexpr int maxLoop = kMaxProc;
 
+#ifndef __SYNTHESIS__
+	LoopStatistics loopStats("VMRouter::TOPLEVEL", maxLoop);
+#endif
+
 	TOPLEVEL: for (int i = 0; i < maxLoop; ++i) {
 #pragma HLS PIPELINE II=1 rewind
 
@@ -698,6 +707,10 @@ void VMRouter(const BXType bx, BXType& bx_o, const int fineBinTable[], const int
 		else
 			++read_addr;
 
+#ifndef __SYNTHESIS__
+		loopStats.useful += !noStubsLeft;
+#endif
+
 		if (noStubsLeft) continue; // End here if we already have processed all stubs
 		// Note: putting the continue here rather than at the start of the loop seems to yield better timing.
 
@@ -904,6 +917,14 @@ void VMRouter(const BXType bx, BXType& bx_o, const int fineBinTable[], const int
 		} // End TE Overlap memories
 	} // Outside main loop
 
+#ifndef __SYNTHESIS__
+	// Stubs not read
+	for (int i = 0; i < nInputMems + nInputDisk2SMems; i++) {
+		if (hasStubs[i]) loopStats.leftover += nInputs[i];
+	}
+	loopStats.record();
+#endif
+
 	bx_o = bx;
 } // End VMRouter
 
@@ -20,6 +20,10 @@
 #include "VMStubMEMemoryCM.h"
 #include "VMStubTEOuterMemoryCM.h"
 
+#ifndef __SYNTHESIS__
+#include "LoopStatistics.h"
+#endif
+
 /////////////////////////////////////////
 // Constants
 
@@ -238,6 +242,10 @@ void VMRouterCM(const BXType bx, BXType& bx_o,
 
 	constexpr int maxLoop = kMaxProc;
 
+#ifndef __SYNTHESIS__
+	LoopStatistics loopStats("VMRouterCM::TOPLEVEL", maxLoop);
+#endif
+
 	TOPLEVEL: for (int i = 0; i < maxLoop; ++i) {
 #pragma HLS PIPELINE II=1 rewind
 
@@ -272,6 +280,10 @@ void VMRouterCM(const BXType bx, BXType& bx_o,
 		if (resetNext) read_addr = 0;
 		else ++read_addr;
 
+#ifndef __SYNTHESIS__
+		loopStats.useful += !noStubsLeft;
+#endif
+
 		if (noStubsLeft) continue; // End here if we already have processed all stubs
 		// Note: putting the continue here rather than at the start of the loop seems to yield better timing.
 
@@ -428,6 +440,14 @@ void VMRouterCM(const BXType bx, BXType& bx_o,
 
 	} // Outside main loop
 
+#ifndef __SYNTHESIS__
+	// Stubs not read
+	for (int i = 0; i < nInputMems + nInputDisk2SMems; i++) {
+		if (hasStubs[i]) loopStats.leftover += nInputs[i];
+	}
+	loopStats.record();
+#endif
+
 	bx_o = bx;
 } // End VMRouterCM
 
@@ -1,4 +1,5 @@
 #include "VMRouterCMTop.h"
+#include "LUTRegistry.h"
 
 // VMRouter Top Function for layer 2, AllStub region A
 // Sort stubs into smaller regions in phi, i.e. Virtual Modules (VMs).
@@ -41,6 +42,16 @@ void VMRouterCMTop(const BXType bx, BXType& bx_o
 	// LUT with the corrected r/z. It is corrected for the average r (z) of the barrel (disk).
 	// Includes both coarse r/z position (bin), and finer region each r/z bin is divided into.
 	// Indexed using r and z position bits
+#ifdef LUT_RUNTIME
+	const std::string layerDisk = (kLAYER > 0) ? "L" + std::to_string(kLAYER) : "D" + std::to_string(kDISK);
+	static const int* const METable = LUTRegistry::get<int>("VMRCM/tables/VMRME_" + layerDisk + ".tab");
+#if kDISK == 1 || kDISK == 2 || kDISK == 4
+	static const int* const TEDiskTable = LUTRegistry::get<int>("VMRCM/tables/VMRTE_" + layerDisk + ".tab");
+#endif
+#if kDISK == 0
+	static const int* const phiCorrTable = LUTRegistry::get<int>("VMRCM/tables/VMPhiCorr" + layerDisk + ".tab");
+#endif
+#else // LUT_RUNTIME
 #if kLAYER == 1
 		static const int METable[] =
 	#include "../emData/VMRCM/tables/VMRME_L1.tab"
@@ -109,6 +120,7 @@ void VMRouterCMTop(const BXType bx, BXType& bx_o
 		static const int phiCorrTable[] =
 	#include "../emData/VMRCM/tables/VMPhiCorrL6.tab"
 #endif
+#endif // LUT_RUNTIME
 
 
 	/////////////////////////
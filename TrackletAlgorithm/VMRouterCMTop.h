@@ -17,12 +17,19 @@
 
 ////////////////////////////////////////////
 // Values for that are specified with regards to the VMR region
-// Changed manually
+// Changed manually, or from the compiler command line (e.g. -DkLAYER=1 -DkPHIREGION=E)
 
+#ifndef kLAYER
 #define kLAYER 2 // Which barrel layer number the data is coming from
+#endif
+#ifndef kDISK
 #define kDISK 0 // Which disk number the data is coming from, 0 if not disk
+#endif
+#ifndef kPHIREGION
+#define kPHIREGION A // Which AllStub/PhiRegion
+#endif
 
-constexpr phiRegions phiRegion = phiRegions::A; // Which AllStub/PhiRegion
+constexpr phiRegions phiRegion = phiRegions::kPHIREGION;
 
 
 ///////////////////////////////////////////////
@@ -4,6 +4,8 @@
 // Hardcoded number of memories and masks from the wiring.
 // NOTE: this file is incomplete. Please add the missing numbers
 
+#include "LUTRegistry.h"
+
 // Enums used to get the correct parameters
 enum class phiRegions : char {A = 'A', B = 'B', C = 'C', D = 'D', E = 'E', F = 'F', G = 'G', H = 'H'};
 
@@ -28,7 +30,7 @@ template<TF::layerDisk LayerDisk, phiRegions Phi> constexpr int getBendCutTableS
 
 // Help function that converts an array of 0s and 1s to an ap_uint
 template<int arraySize>
-inline ap_uint<arraySize> arrayToInt(ap_uint<1> array[arraySize]) {
+inline ap_uint<arraySize> arrayToInt(const ap_uint<1> array[arraySize]) {
   ap_uint<arraySize> number;
   for(int i = 0; i < arraySize; i++) {
     #pragma HLS unroll
@@ -37,6 +39,104 @@ inline ap_uint<arraySize> arrayToInt(ap_uint<1> array[arraySize]) {
   return number;
 }
 
+#ifdef LUT_RUNTIME
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// The C simulation reads the same LUTs as the getters below at run time, see
+// LUTRegistry.h, with getters common to all layers/disks and phi regions that
+// build the names of the tables from them.
+
+inline std::string layerDiskName(TF::layerDisk layerDisk) {
+  return (layerDisk < TF::D1) ? "L" + std::to_string(layerDisk - TF::L1 + 1) : "D" + std::to_string(layerDisk - TF::D1 + 1);
+}
+
+// Table emData/VMR/tables/<name>.tab, or nullptr for the layers/disks without one
+inline const int* getVMRTable(bool exists, const std::string& name) {
+  return exists ? LUTRegistry::get<int>("VMR/tables/" + name + ".tab") : nullptr;
+}
+
+template<TF::layerDisk LayerDisk> const int* getPhiCorrTable(){
+  static const int* lut = getVMRTable(LayerDisk <= TF::L6, "VMPhiCorr" + layerDiskName(LayerDisk));
+  return lut;
+}
+// Inner layers/disks of the L1L2, L2L3, L3L4, L5L6 and D1D2 seeds
+template<TF::layerDisk LayerDisk> const int* getRzBitsInnerTable(){
+  static const int* lut = getVMRTable(LayerDisk == TF::L1 || LayerDisk == TF::L2 || LayerDisk == TF::L3 || LayerDisk == TF::L5 || LayerDisk == TF::D1,
+                                      "VMTableInner" + layerDiskName(LayerDisk) + layerDiskName(TF::layerDisk(LayerDisk + 1)));
+  return lut;
+}
+// Inner layers of the L1D1 and L2D1 seeds
+template<TF::layerDisk LayerDisk> const int* getRzBitsOverlapTable(){
+  static const int* lut = getVMRTable(LayerDisk == TF::L1 || LayerDisk == TF::L2, "VMTableInner" + layerDiskName(LayerDisk) + "D1");
+  return lut;
+}
+// Outer layers/disks of the seeds (D4 is not used yet)
+template<TF::layerDisk LayerDisk> const int* getRzBitsOuterTable(){
+  static const int* lut = getVMRTable(LayerDisk == TF::L2 || LayerDisk == TF::L3 || LayerDisk == TF::L4 || LayerDisk == TF::L6 || LayerDisk == TF::D1 || LayerDisk == TF::D2,
+                                      "VMTableOuter" + layerDiskName(LayerDisk));
+  return lut;
+}
+template<TF::layerDisk LayerDisk, phiRegions Phi> const int* getFineBinTable(){
+  static const int* lut = getVMRTable(true, "VMR_" + layerDiskName(LayerDisk) + "PHI" + char(Phi) + "_finebin");
+  return lut;
+}
+
+// TE memories of each VMRouter, in the order of the bend-cut tables, given
+// for each memory as "<memory>n<copies>", e.g. "L2PHIX1n5-7" for VMSTE_L2PHIX1n5,
+// n6 and n7 or "D1PHIX1n1,2,5". The memories with fewer copies than the others
+// are padded with empty tables. Defined with the parameters of each VMRouter.
+template<TF::layerDisk LayerDisk, phiRegions Phi> struct BendCutTableNames;
+
+// Bend-cut tables of the memory copies listed in memories
+template<int size>
+std::vector<ap_uint<size> > readBendCutTables(const std::string& memories) {
+  std::vector<std::vector<ap_uint<size> > > rows;
+  unsigned int ncopies = 0;
+  std::istringstream memoryStream(memories);
+  std::string memory;
+  while (memoryStream >> memory) {
+    const size_t n = memory.rfind('n');
+    rows.emplace_back();
+    std::istringstream copyStream(memory.substr(n + 1));
+    std::string copies;
+    while (std::getline(copyStream, copies, ',')) {
+      const size_t dash = copies.find('-');
+      const int first = std::stoi(copies.substr(0, dash));
+      const int last = (dash == std::string::npos) ? first : std::stoi(copies.substr(dash + 1));
+      for (int copy = first; copy <= last; ++copy) {
+        const std::string name = "VMR/tables/VMSTE_" + memory.substr(0, n) + "n" + std::to_string(copy) + "_vmbendcut.tab";
+        rows.back().push_back(arrayToInt<size>(LUTRegistry::get<ap_uint<1> >(name, size)));
+      }
+    }
+    ncopies = std::max<unsigned int>(ncopies, rows.back().size());
+  }
+
+  std::vector<ap_uint<size> > tables;
+  for (auto& row : rows) {
+    row.resize(ncopies, 0);
+    tables.insert(tables.end(), row.begin(), row.end());
+  }
+  return tables;
+}
+
+template<TF::layerDisk LayerDisk, phiRegions Phi, int size> const ap_uint<size>* getBendCutInnerTable(){
+  static const std::vector<ap_uint<size> > tables = readBendCutTables<size>(BendCutTableNames<LayerDisk, Phi>::inner());
+  return tables.empty() ? nullptr : tables.data();
+}
+template<TF::layerDisk LayerDisk, phiRegions Phi, int size> const ap_uint<size>* getBendCutOverlapTable(){
+  static const std::vector<ap_uint<size> > tables = readBendCutTables<size>(BendCutTableNames<LayerDisk, Phi>::overlap());
+  return tables.empty() ? nullptr : tables.data();
+}
+template<TF::layerDisk LayerDisk, phiRegions Phi, int size> const ap_uint<size>* getBendCutOuterTable(){
+  static const std::vector<ap_uint<size> > tables = readBendCutTables<size>(BendCutTableNames<LayerDisk, Phi>::outer());
+  return tables.empty() ? nullptr : tables.data();
+}
+
+#else // LUT_RUNTIME
+
 // VMPhiCorr LUTs
 template<> inline const int* getPhiCorrTable<TF::L1>(){
   static int lut[] = 
@@ -210,6 +310,8 @@ template<> inline const int* getRzBitsOuterTable<TF::D5>(){
 }
 
 
+#endif // LUT_RUNTIME
+
 ////////////////
 // VMR_L1PHID //
 ////////////////
@@ -235,6 +337,13 @@ template<> constexpr int getBendCutTableSize<TF::L1, phiRegions::D>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L1, phiRegions::D> {
+  static const char* inner() {return "L1PHID13n1-5 L1PHID14n1-5 L1PHID15n1-5 L1PHID16n1-5";}
+  static const char* overlap() {return "L1PHIW7n1-3 L1PHIW8n1-3";}
+  static const char* outer() {return "";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L1, phiRegions::D>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L1PHID_finebin.tab"
@@ -326,6 +435,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L1, phiRegions::D>()>* g
 template<> inline const ap_uint<getBendCutTableSize<TF::L1, phiRegions::D>()>* getBendCutOuterTable<TF::L1, phiRegions::D>(){
   return nullptr;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -353,6 +463,13 @@ template<> constexpr int getBendCutTableSize<TF::L1, phiRegions::E>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L1, phiRegions::E> {
+  static const char* inner() {return "L1PHIE17n1-5 L1PHIE18n1-5 L1PHIE19n1-5 L1PHIE20n1-5";}
+  static const char* overlap() {return "L1PHIQ9n1-3 L1PHIQ10n1-3";}
+  static const char* outer() {return "";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L1, phiRegions::E>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L1PHIE_finebin.tab"
@@ -449,6 +566,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L1, phiRegions::E>()>* g
 template<> inline const ap_uint<getBendCutTableSize<TF::L1, phiRegions::E>()>* getBendCutOuterTable<TF::L1, phiRegions::E>(){
   return nullptr;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -476,6 +594,13 @@ template<> constexpr int getBendCutTableSize<TF::L2, phiRegions::A>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L2, phiRegions::A> {
+  static const char* inner() {return "L2PHII1n1-2 L2PHII2n1-3 L2PHII3n1-3 L2PHII4n1-3";}
+  static const char* overlap() {return "L2PHIX1n5-7 L2PHIX2n5-8";}
+  static const char* outer() {return "L2PHIA1n1-3 L2PHIA2n1-4 L2PHIA3n1-5 L2PHIA4n1-5 L2PHIA5n1-5 L2PHIA6n1-5 L2PHIA7n1-5 L2PHIA8n1-5";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L2, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L2PHIA_finebin.tab"
@@ -651,6 +776,7 @@ ap_uint<1> tmpBendOuterTable6_n3[bendCutTableSize] =
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -678,6 +804,13 @@ template<> constexpr int getBendCutTableSize<TF::L2, phiRegions::B>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L2, phiRegions::B> {
+  static const char* inner() {return "L2PHIJ5n1-3 L2PHIJ6n1-3 L2PHIJ7n1-3 L2PHIJ8n1-3";}
+  static const char* overlap() {return "L2PHIY3n5-8 L2PHIY4n5-8";}
+  static const char* outer() {return "L2PHIB9n1-5 L2PHIB10n1-5 L2PHIB11n1-5 L2PHIB12n1-5 L2PHIB13n1-5 L2PHIB14n1-5 L2PHIB15n1-5 L2PHIB16n1-5";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L2, phiRegions::B>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L2PHIB_finebin.tab"
@@ -858,6 +991,7 @@ ap_uint<1> tmpBendOuterTable6_n3[bendCutTableSize] =
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -885,6 +1019,13 @@ template<> constexpr int getBendCutTableSize<TF::L3, phiRegions::A>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L3, phiRegions::A> {
+  static const char* inner() {return "L3PHIA1n1-4 L3PHIA2n1-6 L3PHIA3n1-6 L3PHIA4n1-6";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "L3PHII1n1-2 L3PHII2n1-3 L3PHII3n1-3 L3PHII4n1-3";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L3, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L3PHIA_finebin.tab"
@@ -998,6 +1139,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L3, phiRegions::A>()>* g
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -1025,6 +1167,13 @@ template<> constexpr int getBendCutTableSize<TF::L4, phiRegions::A>(){
   return 16;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L4, phiRegions::A> {
+  static const char* inner() {return "";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "L4PHIA1n1-2 L4PHIA2n1-2 L4PHIA3n1-3 L4PHIA4n1-3 L4PHIA5n1-3 L4PHIA6n1-3 L4PHIA7n1-3 L4PHIA8n1-3";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L4, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L4PHIA_finebin.tab"
@@ -1109,6 +1258,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L4, phiRegions::A>()>* g
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -1136,6 +1286,13 @@ template<> constexpr int getBendCutTableSize<TF::L5, phiRegions::A>(){
   return 16;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L5, phiRegions::A> {
+  static const char* inner() {return "L5PHIA1n1-5 L5PHIA2n1-7 L5PHIA3n1-8 L5PHIA4n1-8";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L5, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L5PHIA_finebin.tab"
@@ -1226,6 +1383,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L5, phiRegions::A>()>* g
 template<> inline const ap_uint<getBendCutTableSize<TF::L5, phiRegions::A>()>* getBendCutOuterTable<TF::L5, phiRegions::A>(){
   return nullptr;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -1253,6 +1411,13 @@ template<> constexpr int getBendCutTableSize<TF::L6, phiRegions::A>(){
   return 16;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::L6, phiRegions::A> {
+  static const char* inner() {return "";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "L6PHIA1n1-2 L6PHIA2n1-3 L6PHIA3n1-3 L6PHIA4n1-4 L6PHIA5n1-4 L6PHIA6n1-4 L6PHIA7n1-4 L6PHIA8n1-4";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::L6, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_L6PHIA_finebin.tab"
@@ -1351,6 +1516,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::L6, phiRegions::A>()>* g
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -1378,6 +1544,13 @@ template<> constexpr int getBendCutTableSize<TF::D1, phiRegions::A>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::D1, phiRegions::A> {
+  static const char* inner() {return "D1PHIA1n1-2 D1PHIA2n1-3 D1PHIA3n1-3 D1PHIA4n1-3";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "D1PHIX1n1-2,5 D1PHIX2n1-3,5-6 D1PHIX3n1-3,5-6 D1PHIX4n1-3,5-6";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::D1, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_D1PHIA_finebin.tab"
@@ -1483,6 +1656,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::D1, phiRegions::A>()>* g
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 
 
 ////////////////
@@ -1510,6 +1684,13 @@ template<> constexpr int getBendCutTableSize<TF::D2, phiRegions::A>(){
   return 8;
 }
 
+#ifdef LUT_RUNTIME
+template<> struct BendCutTableNames<TF::D2, phiRegions::A> {
+  static const char* inner() {return "";}
+  static const char* overlap() {return "";}
+  static const char* outer() {return "D2PHIA1n1-2 D2PHIA2n1-3 D2PHIA3n1-3 D2PHIA4n1-3";}
+};
+#else // LUT_RUNTIME
 template<> inline const int* getFineBinTable<TF::D2, phiRegions::A>(){
   static int lut[] =
 #include "../emData/VMR/tables/VMR_D2PHIA_finebin.tab"
@@ -1560,6 +1741,7 @@ template<> inline const ap_uint<getBendCutTableSize<TF::D2, phiRegions::A>()>* g
 
   return bendCutOuterTable;
 }
+#endif // LUT_RUNTIME
 // Add more layers and phi regions
 
 #endif // TrackletAlgorithm_VMRouter_parameters_h
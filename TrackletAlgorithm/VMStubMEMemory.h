@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_VMStubMEMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplateBinned.h"
 
 // VMStubMEBase is where we define the bit widths, which depend on the class template parameter
@@ -79,11 +80,11 @@ public:
 
   // Constructors
   VMStubME(const VMStubMEData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<VMStubMEBase<VMSMEType>::kVMStubMESize>(newdata))
   {}
 
  VMStubME(const VMSMEID id, const VMSMEBEND bend, const VMSMEFINEPHI finephi, const VMSMEFINEZ finez):
-    data_( (id, bend, finephi, finez) )
+    data_(toMemoryWord<VMStubMEBase<VMSMEType>::kVMStubMESize>((id, bend, finephi, finez)))
   {}
 
   VMStubME():
@@ -94,51 +95,51 @@ public:
   VMStubME(const char* datastr, int base=16)
   {
     VMStubMEData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<VMStubMEBase<VMSMEType>::kVMStubMESize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return VMStubMEBase<VMSMEType>::kVMStubMESize;}
 
-  VMStubMEData raw() const {return data_;}
+  VMStubMEData raw() const {return fromMemoryWord<VMStubMEBase<VMSMEType>::kVMStubMESize>(data_);}
 
   VMSMEID getIndex() const {
-    return data_.range(kVMSMEIndexMSB,kVMSMEIndexLSB);
+    return getBits<kVMSMEIndexMSB,kVMSMEIndexLSB>(data_);
   }
 
   VMSMEBEND getBend() const {
-    return data_.range(kVMSMEBendMSB,kVMSMEBendLSB);
+    return getBits<kVMSMEBendMSB,kVMSMEBendLSB>(data_);
   }
 
   VMSMEFINEPHI getFinePhi() const {
-    return data_.range(kVMSMEFinePhiMSB,kVMSMEFinePhiLSB);
+    return getBits<kVMSMEFinePhiMSB,kVMSMEFinePhiLSB>(data_);
   }
 
   VMSMEFINEZ getFineZ() const {
-    return data_.range(kVMSMEFineZMSB,kVMSMEFineZLSB);
+    return getBits<kVMSMEFineZMSB,kVMSMEFineZLSB>(data_);
   }
 
   // Setter
   void setIndex(const VMSMEID index) {
-    data_.range(kVMSMEIndexMSB,kVMSMEIndexLSB) = index;
+    setBits<kVMSMEIndexMSB,kVMSMEIndexLSB>(data_, index);
   }
 
   void setBend(const VMSMEBEND bend) {
-    data_.range(kVMSMEBendMSB,kVMSMEBendLSB) = bend;
+    setBits<kVMSMEBendMSB,kVMSMEBendLSB>(data_, bend);
   }
 
   void setFinePhi(const VMSMEFINEPHI finephi) {
-    data_.range(kVMSMEFinePhiMSB,kVMSMEFinePhiLSB) = finephi;
+    setBits<kVMSMEFinePhiMSB,kVMSMEFinePhiLSB>(data_, finephi);
   }
 
   void setFineZ(const VMSMEFINEZ finez) {
-    data_.range(kVMSMEFineZMSB,kVMSMEFineZLSB) = finez;
+    setBits<kVMSMEFineZMSB,kVMSMEFineZLSB>(data_, finez);
   }
 
 private:
 
-  VMStubMEData data_;
+  typename MemoryWord<VMStubMEBase<VMSMEType>::kVMStubMESize>::type data_;
 
 };
 
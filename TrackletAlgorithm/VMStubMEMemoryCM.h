@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_VMStubMEMemoryCM_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplateBinnedCM.h"
 
 // VMStubMECMBase is where we define the bit widths, which depend on the class template parameter.
@@ -78,11 +79,11 @@ public:
 
   // Constructors
   VMStubMECM(const VMStubMECMData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<VMStubMECMBase<VMSMEType>::kVMStubMECMSize>(newdata))
   {}
 
  VMStubMECM(const VMSMEID id, const VMSMEBEND bend, const VMSMEFINEPHI finephi, const VMSMEFINEZ finez):
-    data_( (id, bend,finephi, finez) )
+    data_(toMemoryWord<VMStubMECMBase<VMSMEType>::kVMStubMECMSize>((id, bend,finephi, finez)))
   {}
 
   VMStubMECM():
@@ -93,51 +94,51 @@ public:
   VMStubMECM(const char* datastr, int base=16)
   {
     VMStubMECMData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<VMStubMECMBase<VMSMEType>::kVMStubMECMSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return VMStubMECMBase<VMSMEType>::kVMStubMECMSize;}
 
-  VMStubMECMData raw() const {return data_;}
+  VMStubMECMData raw() const {return fromMemoryWord<VMStubMECMBase<VMSMEType>::kVMStubMECMSize>(data_);}
 
   VMSMEID getIndex() const {
-    return data_.range(kVMSMEIDMSB,kVMSMEIDLSB);
+    return getBits<kVMSMEIDMSB,kVMSMEIDLSB>(data_);
   }
 
   VMSMEBEND getBend() const {
-    return data_.range(kVMSMEBendMSB,kVMSMEBendLSB);
+    return getBits<kVMSMEBendMSB,kVMSMEBendLSB>(data_);
   }
 
   VMSMEFINEPHI getFinePhi() const {
-    return data_.range(kVMSMEFinePhiMSB, kVMSMEFinePhiLSB);
+    return getBits<kVMSMEFinePhiMSB,kVMSMEFinePhiLSB>(data_);
   }
 
   VMSMEFINEZ getFineZ() const {
-    return data_.range(kVMSMEFineZMSB,kVMSMEFineZLSB);
+    return getBits<kVMSMEFineZMSB,kVMSMEFineZLSB>(data_);
   }
 
   // Setter
   void setIndex(const VMSMEID id) {
-    data_.range(kVMSMEIDMSB,kVMSMEIDLSB) = id;
+    setBits<kVMSMEIDMSB,kVMSMEIDLSB>(data_, id);
   }
 
   void setBend(const VMSMEBEND bend) {
-    data_.range(kVMSMEBendMSB,kVMSMEBendLSB) = bend;
+    setBits<kVMSMEBendMSB,kVMSMEBendLSB>(data_, bend);
   }
 
   void setFinePhi(const VMSMEFINEPHI finephi) {
-    data_.range(kVMSMEFinePhiMSB,kVMSMEFinePhiLSB) = finephi;
+    setBits<kVMSMEFinePhiMSB,kVMSMEFinePhiLSB>(data_, finephi);
   }
 
   void setFineZ(const VMSMEFINEZ finez) {
-    data_.range(kVMSMEFineZMSB,kVMSMEFineZLSB) = finez;
+    setBits<kVMSMEFineZMSB,kVMSMEFineZLSB>(data_, finez);
   }
 
 private:
 
-  VMStubMECMData data_;
+  typename MemoryWord<VMStubMECMBase<VMSMEType>::kVMStubMECMSize>::type data_;
 
 };
 
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_VMStubTEInnerMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplate.h"
 
 // VMStubTEInnerBase is where we define the bit widths, which depend on the class template parameter.
@@ -122,11 +123,11 @@ public:
 
   // Constructors
   VMStubTEInner(const VMStubTEInnerData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize>(newdata))
   {}
 
   VMStubTEInner(const VMSTEIID id, const VMSTEIBEND bend, const VMSTEIFINEPHI finephi, const VMSTEIZBITS zbits):
-    data_( (((id,bend),finephi),zbits) )
+    data_(toMemoryWord<VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize>((((id,bend),finephi),zbits)))
   {}
 
   VMStubTEInner():
@@ -137,67 +138,67 @@ public:
   VMStubTEInner(const char* datastr, int base=16)
   {
     VMStubTEInnerData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize;}
 
-  VMStubTEInnerData raw() const {return data_;}
+  VMStubTEInnerData raw() const {return fromMemoryWord<VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize>(data_);}
 
   VMSTEIID getIndex() const {
-    return data_.range(kVMSTEIIDMSB,kVMSTEIIDLSB);
+    return getBits<kVMSTEIIDMSB,kVMSTEIIDLSB>(data_);
   }
 
   VMSTEIBEND getBend() const {
-    return data_.range(kVMSTEIBendMSB,kVMSTEIBendLSB);
+    return getBits<kVMSTEIBendMSB,kVMSTEIBendLSB>(data_);
   }
 
   VMSTEIFINEPHI getFinePhi() const {
-    return data_.range(kVMSTEIFinePhiMSB,kVMSTEIFinePhiLSB);
+    return getBits<kVMSTEIFinePhiMSB,kVMSTEIFinePhiLSB>(data_);
   }
 
   VMSTEIZBITS getZBits() const {
-    return data_.range(kVMSTEIZBitsMSB,kVMSTEIZBitsLSB);
+    return getBits<kVMSTEIZBitsMSB,kVMSTEIZBitsLSB>(data_);
   }
 
   VMSTEIZDIFFMAX getZDiffMax() const {
-    return data_.range(kVMSTEIZDiffMaxMSB,kVMSTEIZDiffMaxLSB);
+    return getBits<kVMSTEIZDiffMaxMSB,kVMSTEIZDiffMaxLSB>(data_);
   }
 
   VMSTEIZBINSTART getZBinStart() const {
-    return data_.range(kVMSTEIZBinStartMSB,kVMSTEIZBinStartLSB);
+    return getBits<kVMSTEIZBinStartMSB,kVMSTEIZBinStartLSB>(data_);
   }
 
   VMSTEIZBINDIFF getZBinDiff() const {
-    return data_.range(kVMSTEIZBinDiffMSB,kVMSTEIZBinDiffLSB);
+    return getBits<kVMSTEIZBinDiffMSB,kVMSTEIZBinDiffLSB>(data_);
   }
 
   VMSTEIZBINFIRST getZBinFirst() const {
-    return data_.range(kVMSTEIZBinFirstMSB,kVMSTEIZBinFirstLSB);
+    return getBits<kVMSTEIZBinFirstMSB,kVMSTEIZBinFirstLSB>(data_);
   }
 
   // Setter
   void setIndex(const VMSTEIID id) {
-    data_.range(kVMSTEIIDMSB,kVMSTEIIDLSB) = id;
+    setBits<kVMSTEIIDMSB,kVMSTEIIDLSB>(data_, id);
   }
 
   void setBend(const VMSTEIBEND bend) {
-    data_.range(kVMSTEIBendMSB,kVMSTEIBendLSB) = bend;
+    setBits<kVMSTEIBendMSB,kVMSTEIBendLSB>(data_, bend);
   }
 
   void setFinePhi(const VMSTEIFINEPHI finephi) {
-    data_.range(kVMSTEIFinePhiMSB,kVMSTEIFinePhiLSB) = finephi;
+    setBits<kVMSTEIFinePhiMSB,kVMSTEIFinePhiLSB>(data_, finephi);
   }
 
   void setZBits(const VMSTEIZBITS zbits) {
-    data_.range(kVMSTEIZBitsMSB,kVMSTEIZBitsLSB) = zbits;
+    setBits<kVMSTEIZBitsMSB,kVMSTEIZBitsLSB>(data_, zbits);
   }
 
 private:
 
-  VMStubTEInnerData data_;
+  typename MemoryWord<VMStubTEInnerBase<VMSTEIType>::kVMStubTEInnerSize>::type data_;
 
 };
 
@@ -2,6 +2,7 @@
 #define TrackletAlgorithm_VMStubTEOuterMemory_h
 
 #include "Constants.h"
+#include "MemoryWord.h"
 #include "MemoryTemplateBinnedCM.h"
 
 // VMStubTEOuterBase is where we define the bit widths, which depend on the class template parameter.
@@ -78,11 +79,11 @@ public:
 
   // Constructors
   VMStubTEOuter(const VMStubTEOuterData& newdata):
-    data_(newdata)
+    data_(toMemoryWord<VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize>(newdata))
   {}
 
   VMStubTEOuter(const VMSTEOID id, const VMSTEOBEND bend, const VMSTEOFINEPHI finephi, const VMSTEOFINEZ finez):
-    data_( (((id,bend),finephi),finez) )
+    data_(toMemoryWord<VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize>((((id,bend),finephi),finez)))
   {}
 
   VMStubTEOuter():
@@ -93,51 +94,51 @@ public:
   VMStubTEOuter(const char* datastr, int base=16)
   {
     VMStubTEOuterData newdata(datastr, base);
-    data_ = newdata;
+    data_ = toMemoryWord<VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize>(newdata);
   }
   #endif
 
   // Getter
   static constexpr int getWidth() {return VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize;}
   
-  VMStubTEOuterData raw() const {return data_;}
+  VMStubTEOuterData raw() const {return fromMemoryWord<VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize>(data_);}
 
   VMSTEOID getIndex() const {
-    return data_.range(kVMSTEOIDMSB,kVMSTEOIDLSB);
+    return getBits<kVMSTEOIDMSB,kVMSTEOIDLSB>(data_);
   }
 
   VMSTEOBEND getBend() const {
-    return data_.range(kVMSTEOBendMSB,kVMSTEOBendLSB);
+    return getBits<kVMSTEOBendMSB,kVMSTEOBendLSB>(data_);
   }
 
   VMSTEOFINEPHI getFinePhi() const {
-    return data_.range(kVMSTEOFinePhiMSB,kVMSTEOFinePhiLSB);
+    return getBits<kVMSTEOFinePhiMSB,kVMSTEOFinePhiLSB>(data_);
   }
 
   VMSTEOFINEZ getFineZ() const {
-    return data_.range(kVMSTEOFineZMSB,kVMSTEOFineZLSB);
+    return getBits<kVMSTEOFineZMSB,kVMSTEOFineZLSB>(data_);
   }
 
   // Setter
   void setIndex(const VMSTEOID id) {
-    data_.range(kVMSTEOIDMSB,kVMSTEOIDLSB) = id;
+    setBits<kVMSTEOIDMSB,kVMSTEOIDLSB>(data_, id);
   }
 
   void setBend(const VMSTEOBEND bend) {
-    data_.range(kVMSTEOBendMSB,kVMSTEOBendLSB) = bend;
+    setBits<kVMSTEOBendMSB,kVMSTEOBendLSB>(data_, bend);
   }
 
   void setFinePhi(const VMSTEOFINEPHI finephi) {
-    data_.range(kVMSTEOFinePhiMSB,kVMSTEOFinePhiLSB) = finephi;
+    setBits<kVMSTEOFinePhiMSB,kVMSTEOFinePhiLSB>(data_, finephi);
   }
 
   void setFineZ(const VMSTEOFINEZ finez) {
-    data_.range(kVMSTEOFineZMSB,kVMSTEOFineZLSB) = finez;
+    setBits<kVMSTEOFineZMSB,kVMSTEOFineZLSB>(data_, finez);
   }
 
 private:
 
-  VMStubTEOuterData data_;
+  typename MemoryWord<VMStubTEOuterBase<VMSTEOType>::kVMStubTEOuterSize>::type data_;
 
 };
 
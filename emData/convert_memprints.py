@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+
+# This script converts the memory prints (.dat files) from the emulation into
+# the binary format read by BinaryMemPrint in TestBenches/FileReadUtility.h,
+# writing a .bin file next to each .dat file. All numbers are little endian:
+#
+#   char     magic[8]            "MEMPRBIN"
+#   uint32_t nbits               width of the data words
+#   uint32_t nwords              number of 64-bit words per data word
+#   uint32_t binned              1 if each entry is preceded by its bin
+#   uint32_t nevents
+#   uint64_t offsets[nevents+1]  index of the first entry of each event
+#
+# followed by the entries, each (binned + nwords) 64-bit words long with the
+# least significant data word first.
+#
+# Usage (from emData/, after download.sh):
+#   ./convert_memprints.py                 converts every .dat file below emData/
+#   ./convert_memprints.py PR/PR_L3PHIC    converts the given files or directories
+
+import os, struct, sys
+
+def parse_memprint(filename):
+    # Returns the word width, whether the memory is binned and, for each
+    # event, a list of (bin, data) pairs
+    events = []
+    nbits = 0
+    binned = False
+    with open(filename, 'r') as f:
+        for line in f:
+            if 'Event' in line:
+                events.append([])
+                continue
+            tokens = line.split()
+            if not tokens or not events:
+                continue
+            # Same convention as writeMemFromFile: binned memories have four
+            # columns, the first one being the bin in hexadecimal
+            binned = (len(tokens) == 4)
+            bin = int(tokens[0], 16) if binned else 0
+            data = int(tokens[-1], 16)
+            if len(tokens) >= 3:
+                nbits = max(nbits, len(tokens[-2].replace('|', '')))
+            else:
+                nbits = max(nbits, 4 * len(tokens[-1].lower().replace('0x', '')))
+            events[-1].append((bin, data))
+    return nbits, binned, events
+
+def is_memprint(filename):
+    # Memory prints start with a "BX = ... Event : 1" line, unlike the other
+    # .dat files (e.g. LUTs/wires.dat)
+    with open(filename, 'r') as f:
+        return 'Event' in f.readline()
+
+def convert(filename):
+    if not is_memprint(filename):
+        return
+    nbits, binned, events = parse_memprint(filename)
+    nwords = (nbits + 63) // 64
+    mask = (1 << 64) - 1
+
+    offsets = [0]
+    for event in events:
+        offsets.append(offsets[-1] + len(event))
+
+    out = bytearray(b'MEMPRBIN')
+    out += struct.pack('<IIII', nbits, nwords, int(binned), len(events))
+    out += struct.pack('<%dQ' % len(offsets), *offsets)
+    for event in events:
+        for bin, data in event:
+            if binned:
+                out += struct.pack('<Q', bin)
+            out += struct.pack('<%dQ' % nwords, *[(data >> (64 * i)) & mask for i in range(nwords)])
+
+    with open(os.path.splitext(filename)[0] + '.bin', 'wb') as f:
+        f.write(out)
+
+def find_memprints(paths):
+    for path in paths:
+        if os.path.isdir(path):
+            for root, dirs, files in os.walk(path, followlinks=True):
+                for name in sorted(files):
+                    if name.endswith('.dat'):
+                        yield os.path.join(root, name)
+        else:
+            yield path
+
+if __name__ == '__main__':
+    paths = sys.argv[1:] if len(sys.argv) > 1 else ['.']
+    for filename in find_memprints(paths):
+        convert(filename)
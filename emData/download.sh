@@ -93,6 +93,9 @@ declare -a processing_modules=(
   # TrackBuilder (aka FitTrack)
   "FT_L1L2"
 
+  # PurgeDuplicate (DuplicateRemoval), with the TrackFit and CleanTrack memories of all seeds
+  "PD"
+
   # Tracklet Processor
   "TP_L1L2D" 
 )
@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+
+# This script generates TrackletCalculator_calculate_LXLY_native.h and
+# TrackletCalculator_calculate_LXLY_batch.h in the TrackletAlgorithm/
+# directory from TrackletCalculator_calculate_LXLY.h, which is generated by the
+# emulation. It has to be run again whenever the latter changes.
+#
+# The native version, TC::calculate_LXLY_native, does the same calculations
+# with the ap_int<N> variables replaced by NativeInt<N> (see
+# TrackletAlgorithm/NativeInt.h), which hold them in 64-bit integers with the
+# same truncation and sign extension. It has the same arguments and is used by
+# the C simulation, while the synthesis uses TC::calculate_LXLY.
+#
+# The batched version, TC::calculate_LXLY_batch, does the calculations of the
+# native version for N stub pairs at once: its inputs and outputs are 64-bit
+# integers, the stub inputs and the outputs being arrays of N values, and the
+# calculations are done in a loop over the N stub pairs that the compiler can
+# vectorize. It is used by the C simulation of the TrackletCalculator.
+#
+# The test bench TestBenches/TrackletCalculator_calculate_LXLY_test.cpp checks
+# that all versions give the same results.
+
+import os, re, sys
+
+algoDir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "TrackletAlgorithm")
+inputFileName = sys.argv[1] if len(sys.argv) > 1 else os.path.join(algoDir, "TrackletCalculator_calculate_LXLY.h")
+outputDir = sys.argv[2] if len(sys.argv) > 2 else algoDir
+
+lines = open(inputFileName).read().splitlines()
+
+# The signature is kept as is; the body starts after the first line with "{".
+signatureEnd = next(i for i, line in enumerate(lines) if line.strip() == "{")
+header = lines[:signatureEnd + 1]
+body = lines[signatureEnd + 1:]
+
+# Drop the include guard and comment of the generated file, and the endif
+# closing the guard.
+firstCode = next(i for i, line in enumerate(header) if line.startswith("template"))
+header = header[firstCode:]
+while body and not body[-1].strip():
+    body.pop()
+if body[-1].startswith("#endif"):
+    body.pop()
+while body and not body[-1].strip():
+    body.pop()
+
+nativeBody = []
+for line in body:
+    if not line.startswith("#include"):
+        line = re.sub(r"\bap_int<", "NativeInt<", line)
+        line = re.sub(r"\bap_uint<", "NativeUInt<", line)
+        # The outputs are ap_int or ap_uint, assigned from the 64-bit value
+        line = re.sub(r"^(\*\w+_output = )(\w+);", r"\1\2.value();", line)
+    nativeBody.append(line)
+
+def writeHeader(fileName, guard, comment, lines):
+    outputFile = open(os.path.join(outputDir, fileName), "w")
+    outputFile.write(
+        "#ifndef TrackletAlgorithm_" + guard + "_h\n"
+        "#define TrackletAlgorithm_" + guard + "_h\n"
+        "\n" + comment +
+        "#ifndef __SYNTHESIS__\n"
+        "\n"
+        "#include \"NativeInt.h\"\n"
+        "\n"
+        "namespace TC {\n"
+        "\n"
+    )
+    outputFile.write("\n".join(lines) + "\n")
+    outputFile.write(
+        "\n"
+        "} // namespace TC\n"
+        "\n"
+        "#endif // __SYNTHESIS__\n"
+        "\n"
+        "#endif\n"
+    )
+    outputFile.close()
+
+writeHeader("TrackletCalculator_calculate_LXLY_native.h", "TrackletCalculator_calculate_LXLY_native",
+    "// Native version of TC::calculate_LXLY for the C simulation, bit-identical\n"
+    "// to it. It is automatically generated from TrackletCalculator_calculate_LXLY.h\n"
+    "// by emData/generate_TC_native.py.\n",
+    [line.replace("TC::calculate_LXLY", "calculate_LXLY_native") for line in header] + nativeBody)
+
+# Batched version: the inputs and outputs are 64-bit integers, the stub inputs
+# and the outputs being arrays with one value per stub pair, and the body of the
+# native version is run in a loop over them. The body has no branches once Seed
+# is known, so the loop can be vectorized.
+stubInputs = []
+batchHeader = []
+for line in header:
+    line = line.replace("template<TF::seed Seed, regionType InnerRegion, regionType OuterRegion>",
+                        "template<TF::seed Seed, regionType InnerRegion, regionType OuterRegion, int N>")
+    line = line.replace("TC::calculate_LXLY", "calculate_LXLY_batch")
+    stubInput = re.match(r"^(\s*)const typename AllStub<\w+>::\w+ (\w+_input)(,?)$", line)
+    if stubInput:
+        stubInputs.append(stubInput.group(2))
+        line = stubInput.group(1) + "const int64_t " + stubInput.group(2) + "[N]" + stubInput.group(3)
+    line = re.sub(r"^(\s*)const [\w:]+ (\w+_input)(,?)$", r"\1const int64_t \2\3", line)
+    line = re.sub(r"^(\s*)[\w:]+ \* const (\w+_output)(,?)$", r"\1int64_t \2[N]\3", line)
+    batchHeader.append(line)
+
+batchBody = ["for (int i = 0; i < N; i++) {"]
+for line in nativeBody:
+    if not line.startswith("#include"):
+        line = re.sub(r"\b(" + "|".join(stubInputs) + r")\b", r"\1[i]", line)
+        line = re.sub(r"^\*(\w+_output) = ", r"\1[i] = ", line)
+    batchBody.append(line)
+batchBody.append("}")
+
+writeHeader("TrackletCalculator_calculate_LXLY_batch.h", "TrackletCalculator_calculate_LXLY_batch",
+    "// Batched version of TC::calculate_LXLY_native for the C simulation, doing\n"
+    "// the calculations for N stub pairs at once. It is automatically generated\n"
+    "// from TrackletCalculator_calculate_LXLY.h by emData/generate_TC_native.py.\n",
+    batchHeader + batchBody)
@@ -0,0 +1,40 @@
+# Script to generate project for the TB -> TQ chain
+#   vivado_hls -f script_TBTQ.tcl
+#   vivado_hls -p trackBuilderTrackQuality
+# WARNING: this will wipe out the original project by the same name
+
+# The BDT is written by the track quality conversion, see the README
+if { [file exists ../TrackQuality/parameters_static.h ] == 0} {
+    puts "parameters_static.h not present, follow track quality instructions in README"
+    exit
+}
+
+# get some information about the executable and environment
+source env_hls.tcl
+
+# create new project (deleting any existing one of same name)
+open_project -reset trackBuilderTrackQuality
+
+# source files
+set CFLAGS {-std=c++11 -I../TrackletAlgorithm -I../TrackQuality}
+set_top TrackBuilderTrackQualityTop
+add_files ../TrackQuality/TrackQualityTop.cc -cflags "$CFLAGS"
+add_files -tb ../TrackletAlgorithm/TrackBuilderTop.cc -cflags "$CFLAGS"
+add_files -tb ../TestBenches/TrackBuilderTrackQuality_test.cpp -cflags "$CFLAGS"
+
+open_solution "solution1"
+
+# Define FPGA, clock frequency & common HLS settings.
+source settings_hls.tcl
+
+# data files
+add_files -tb ../emData/FT/FT_L1L2/
+
+csim_design -compiler gcc -mflags "-j8"
+csynth_design
+cosim_design
+export_design -format ip_catalog
+# Adding "-flow impl" runs full Vivado implementation, providing accurate resource use numbers (very slow).
+#export_design -format ip_catalog -flow impl
+
+exit
@@ -25,6 +25,12 @@ if { [file exists ../TrackQuality/parameters.h ] == 1} {
 
     }
 
+# parameters_static.h is written from parameters.h by the same conversion
+if { [file exists ../TrackQuality/parameters_static.h ] == 0} {
+    puts "parameters_static.h not present, rerun conversion"
+    exit
+}
+
 # create new project (deleting any existing one of same name)
 open_project -reset trackquality
 